@@ -21,6 +21,7 @@
 
 
 #include "BCSystem/BCType.h"
+#include "BCSystem/BCBoundarySet.h"
 
 using namespace std;
 
@@ -37,6 +38,7 @@ public:
         _Parameters.clear();
         _BoundaryNameList.clear();
         _IsTimeDependent=false;
+        _BoundarySetList.clear();
     }
 
     string         _BCBlockName;
@@ -48,6 +50,7 @@ public:
     vector<double> _Parameters;
     vector<string> _BoundaryNameList;// it could be either an element set or a node set
     bool           _IsTimeDependent;
+    vector<BCBoundarySet> _BoundarySetList;// the rank-local set of each boundary name, see BCSystem::CreateBCBoundarySets
 
     void Init(){
         _BCBlockName.clear();
@@ -59,6 +62,7 @@ public:
         _Parameters.clear();
         _BoundaryNameList.clear();
         _IsTimeDependent=false;
+        _BoundarySetList.clear();
     }
     
 };
@@ -0,0 +1,167 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.27
+//+++ Purpose: Define the rank-local boundary set of one boundary
+//+++          name in one [bcs] sub block, the elements, nodes,
+//+++          coordinates and dofs index are resolved once after
+//+++          the dofs map is created, so no physical group search
+//+++          is required during the BC assembly. For the element
+//+++          set, the gauss point geometry(JxW, normals, shape
+//+++          functions) of each boundary element is cached as well
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Utils/Span.h"
+#include "Mesh/Nodes.h"
+#include "Utils/Vector3d.h"
+
+using namespace std;
+
+class BCBoundarySet{
+public:
+    BCBoundarySet(){
+        Init();
+    }
+    void Init(){
+        _BoundaryName.clear();
+        _IsNodeSet=false;
+        _nDim=0;
+        _nNodesPerElmt=0;
+        _nDofs=0;
+        _ElmtIDs.clear();
+        _ElmtConnOffset.assign(1,0);
+        _ElmtConn.clear();
+        _ElmtNodeCoords.clear();
+        _ElmtDofIDs.clear();
+        _NodeIDs.clear();
+        _NodeCoords.clear();
+        _NodeDofIDs.clear();
+        _nGPoints=0;
+        _GPJxW.clear();
+        _GPNormals.clear();
+        _GPCoords.clear();
+        _GPShapeValues.clear();
+        _GPShapeGrads.clear();
+    }
+
+    //*** for the boundary elements
+    /**
+     * get the number of the rank-local boundary elements
+     */
+    inline int GetElmtsNum()const{return static_cast<int>(_ElmtIDs.size());}
+    /**
+     * get the global element id of the i-th local boundary element
+     * @param i the local element id, start from 1
+     */
+    inline int GetIthElmtID(const int &i)const{return _ElmtIDs[i-1];}
+    inline int GetIthElmtNodesNum(const int &i)const{return _ElmtConnOffset[i]-_ElmtConnOffset[i-1];}
+    /**
+     * get the global node ids of the i-th local boundary element
+     * @param i the local element id, start from 1
+     */
+    inline Span<const int> GetIthElmtNodeIDs(const int &i)const{
+        return Span<const int>(_ElmtConn.data()+_ElmtConnOffset[i-1],GetIthElmtNodesNum(i));
+    }
+    inline int GetIthElmtJthNodeID(const int &i,const int &j)const{return _ElmtConn[_ElmtConnOffset[i-1]+j-1];}
+    /**
+     * get the k-th coordinate of the j-th node of the i-th local boundary element
+     */
+    inline double GetIthElmtJthNodeKthCoord(const int &i,const int &j,const int &k)const{
+        return _ElmtNodeCoords[3*(_ElmtConnOffset[i-1]+j-1)+k-1];
+    }
+    /**
+     * copy the cached nodal coordinates of the i-th local boundary element to the nodes array
+     */
+    inline void GetIthElmtNodes(const int &i,Nodes &nodes)const{
+        const double *coords=_ElmtNodeCoords.data()+3*_ElmtConnOffset[i-1];
+        for(int j=1;j<=GetIthElmtNodesNum(i);j++){
+            nodes(j,0)=0.0;
+            nodes(j,1)=coords[3*(j-1)  ];
+            nodes(j,2)=coords[3*(j-1)+1];
+            nodes(j,3)=coords[3*(j-1)+2];
+        }
+    }
+    /**
+     * get the dofs index(start from 0, used by PETSc directly) of the j-th node of the i-th local boundary element,
+     * the order is the same as the 'dofs=' of current [bcs] sub block
+     */
+    inline Span<const int> GetIthElmtJthNodeDofIDs(const int &i,const int &j)const{
+        return Span<const int>(_ElmtDofIDs.data()+(_ElmtConnOffset[i-1]+j-1)*_nDofs,_nDofs);
+    }
+    /**
+     * get all the dofs index(start from 0) of the i-th local boundary element, the dofs of one node are continuous,
+     * so it can be used by VecSetValues/MatSetValues directly
+     */
+    inline Span<const int> GetIthElmtDofIDs(const int &i)const{
+        return Span<const int>(_ElmtDofIDs.data()+_ElmtConnOffset[i-1]*_nDofs,GetIthElmtNodesNum(i)*_nDofs);
+    }
+
+    //*** for the cached gauss point geometry of the boundary elements
+    /**
+     * get the number of the gauss points of each boundary element
+     */
+    inline int GetGPointsNum()const{return _nGPoints;}
+    /**
+     * get the JxW(jacobian times weight) of the j-th gauss point in the i-th local boundary element
+     */
+    inline double GetIthElmtJthGPJxW(const int &i,const int &j)const{return _GPJxW[(i-1)*_nGPoints+j-1];}
+    inline const Vector3d& GetIthElmtJthGPNormal(const int &i,const int &j)const{return _GPNormals[(i-1)*_nGPoints+j-1];}
+    inline const Vector3d& GetIthElmtJthGPCoords(const int &i,const int &j)const{return _GPCoords[(i-1)*_nGPoints+j-1];}
+    /**
+     * get the shape function value of the k-th node on the j-th gauss point of the i-th local boundary element
+     */
+    inline double GetIthElmtJthGPKthShapeValue(const int &i,const int &j,const int &k)const{
+        return _GPShapeValues[_ElmtConnOffset[i-1]*_nGPoints+(j-1)*GetIthElmtNodesNum(i)+k-1];
+    }
+    inline const Vector3d& GetIthElmtJthGPKthShapeGrad(const int &i,const int &j,const int &k)const{
+        return _GPShapeGrads[_ElmtConnOffset[i-1]*_nGPoints+(j-1)*GetIthElmtNodesNum(i)+k-1];
+    }
+
+    //*** for the unique boundary nodes
+    /**
+     * get the number of the unique nodes of the rank-local boundary elements(or the rank-local nodes for the node set)
+     */
+    inline int GetNodesNum()const{return static_cast<int>(_NodeIDs.size());}
+    inline int GetIthNodeID(const int &i)const{return _NodeIDs[i-1];}
+    inline double GetIthNodeJthCoord(const int &i,const int &j)const{return _NodeCoords[3*(i-1)+j-1];}
+    /**
+     * get the dofs index(start from 0) of the i-th unique node
+     */
+    inline Span<const int> GetIthNodeDofIDs(const int &i)const{
+        return Span<const int>(_NodeDofIDs.data()+(i-1)*_nDofs,_nDofs);
+    }
+
+public:
+    string         _BoundaryName;
+    bool           _IsNodeSet;     // true for the node set, then only the node list is available
+    int            _nDim;          // the dim of the boundary elements
+    int            _nNodesPerElmt; // the nodes number of the boundary elements(from the physical group)
+    int            _nDofs;         // the dofs number of current [bcs] sub block
+    vector<int>    _ElmtIDs;       // the global id of the rank-local boundary elements
+    vector<int>    _ElmtConnOffset;// the nodes of the i-th element are in [_ElmtConnOffset[i-1],_ElmtConnOffset[i])
+    vector<int>    _ElmtConn;
+    vector<double> _ElmtNodeCoords;// 3 coordinates for each entry of _ElmtConn
+    vector<int>    _ElmtDofIDs;    // _nDofs dofs index for each entry of _ElmtConn
+    vector<int>    _NodeIDs;       // the unique nodes(ascending order)
+    vector<double> _NodeCoords;
+    vector<int>    _NodeDofIDs;
+    //*** the gauss point geometry, it is only changed if the mesh is changed
+    int              _nGPoints;    // the gauss points number of each boundary element(1 for the point)
+    vector<double>   _GPJxW;       // _nGPoints for each element
+    vector<Vector3d> _GPNormals;   // the outward normal of each gauss point
+    vector<Vector3d> _GPCoords;    // the coordinates of each gauss point
+    vector<double>   _GPShapeValues;// nodes number for each gauss point of each element
+    vector<Vector3d> _GPShapeGrads;
+};
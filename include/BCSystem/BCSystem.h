@@ -38,6 +38,7 @@
 #include "FESystem/FECalcType.h"
 
 #include "Utils/Vector3d.h"
+#include "Utils/ScratchArena.h"
 
 /**
  * For built-in and user-defined boundary condition sub-classes
@@ -103,9 +104,18 @@ public:
     void AddBCBlock2List(BCBlock &bcblock);
 
     void InitBCSystem(const Mesh &mesh);
+    /**
+     * create the rank-local boundary set(elements, unique nodes, coordinates and dofs index) of each boundary name
+     * in each [bcs] sub block, the gauss point geometry of the boundary elements is cached as well,
+     * it must be called once the dofs map is created and the FE space is initialized
+     * @param mesh the mesh class
+     * @param dofHandler the dofs handler with the created dofs map
+     * @param fe the FE class for the boundary quadrature and shape functions
+     */
+    void CreateBCBoundarySets(const Mesh &mesh,const DofHandler &dofHandler,FE &fe);
 
     inline int GetBCBlockNums()const{return _nBCBlocks;}
-    inline BCBlock GetIthBCBlock(const int &i)const{return _BCBlockList[i-1];}
+    inline const BCBlock& GetIthBCBlock(const int &i)const{return _BCBlockList[i-1];}
 
     bool CheckAppliedBCNameIsValid(const Mesh &mesh);
     //**************************************************************
@@ -124,6 +134,11 @@ public:
 
     void PrintBCSystemInfo()const;
 
+    /**
+     * release the PETSc scatter and the sequential vectors used by the integrated BCs
+     */
+    void ReleaseMem();
+
 private:
     //**************************************************************
     //*** some basic get functions
@@ -135,14 +150,36 @@ private:
     //**************************************************************
     //*** for different boundary conditions
     //**************************************************************
-    void ApplyDirichletBC(const FECalcType &calctype,const BCType &bctype,const vector<string> bcnamelist,const vector<int> &dofindex,const double &bcvalue,const vector<double> &params,const Mesh &mesh,const DofHandler &dofHandler,Vec &U,Mat &K,Vec &RHS);
+    void ApplyDirichletBC(const FECalcType &calctype,const BCType &bctype,const vector<BCBoundarySet> &bcsetlist,const double &bcvalue,const vector<double> &params,Vec &U,Mat &K,Vec &RHS);
     
-    void ApplyNodalDirichletBC(const FECalcType &calctype,const BCType &bctype,const vector<string> bcnamelist,const vector<int> &dofindex,const double &bcvalue,const vector<double> &params,const Mesh &mesh,const DofHandler &dofHandler,Vec &U,Mat &K,Vec &RHS);
+    void ApplyNodalDirichletBC(const FECalcType &calctype,const BCType &bctype,const vector<BCBoundarySet> &bcsetlist,const double &bcvalue,const vector<double> &params,Vec &U,Mat &K,Vec &RHS);
 
     //**************************************************************
     //*** for nodal type boundary conditions
     //**************************************************************
-    void ApplyNodalNeumannBC(const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const vector<int> &dofsindex,const double &bcvalue,const vector<string> &bcnamelist,Vec &RHS);
+    void ApplyNodalNeumannBC(const vector<BCBoundarySet> &bcsetlist,const double &bcvalue,Vec &RHS);
+
+    //**************************************************************
+    //*** for integrated boundary conditions
+    //**************************************************************
+    /**
+     * calculate the gauss point geometry of the boundary elements in the given set
+     */
+    void CreateBCBoundarySetGeometry(FE &fe,BCBoundarySet &bcset);
+    /**
+     * scatter U and V to the local sequential vectors, the scatter context is created only once
+     */
+    void ScatterBCSolution(Vec &U,Vec &V);
+    /**
+     * integrate the neumann/flux/user-defined bc on the boundary elements of the given bc block,
+     * the local face vector/matrix is assembled once for each boundary element
+     */
+    void ApplyIntegratedBC(const FECalcType &calctype,const BCBlock &bcblock,const double &bcvalue,const double (&ctan)[3],Mat &AMATRIX,Vec &RHS);
+    /**
+     * allocate the gauss point's arrays of _soln from the scratch arena, the index starts from 1
+     * @param n the length of each array
+     */
+    void InitLocalSolution(const int &n);
 
     //**************************************************************
     //*** for other general boundary conditions
@@ -167,27 +204,28 @@ private:
     LocalElmtInfo _elmtinfo;
     LocalShapeFun _shp;
     LocalElmtSolution _soln;
+    ScratchArena _solnArena;/**< the memory of _soln >*/
 
     vector<int> _dofids;/**< the active dofs id for assemble (start from 0!!!) >*/
 
 private:
     double _PenaltyFactor;
     int _nBCDim,_nDim,_nBulkDim,_nNodesPerBCElmt;
+    int _nMaxBCDofs;/**< the maximum dofs number of all the [bcs] sub blocks >*/
     PetscMPIInt _rank,_size;
 
     //*******************************
     //*** for boundary integration
     //*******************************
-    double _xi,_eta,_JxW;
-    Nodes _elNodes;
-    double _xs[3][3],_dist;
-
     Vector3d _normals;
     VectorXd _localR;
     MatrixXd _localK;
+    vector<double> _faceR,_faceK;/**< the local vector/matrix of one boundary element(row-major) >*/
 
     // for PETSc scatter
+    bool _IsScatterCreated;
     Vec _Useq,_Vseq;
-    VecScatter _scatteru,_scatterv;
+    VecScatter _scatteru;
+    const PetscScalar *_Useqvals,*_Vseqvals;
 
 };
@@ -22,11 +22,14 @@
 #include <map>
 #include <string>
 #include <algorithm>
+#include <cstdint>
 
 #include "Utils/MessagePrinter.h"
 #include "Mesh/Mesh.h"
 #include "BCSystem/BCSystem.h"
 #include "ElmtSystem/ElmtSystem.h"
+#include "DofHandler/DofRenumberType.h"
+#include "Utils/Span.h"
 
 using namespace std;
 
@@ -58,6 +61,22 @@ public:
      */
     void CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,ElmtSystem &elmtSystem);
 
+    /**
+     * set the renumbering method of the nodes, which is used to reduce the bandwidth of the system matrix
+     * @param type the renumbering type, i.e., none, rcm, sfc
+     */
+    void SetDofRenumberType(const DofRenumberType &type){_DofRenumberType=type;}
+    /**
+     * get the renumbering method of the nodes
+     */
+    inline DofRenumberType GetDofRenumberType()const{return _DofRenumberType;}
+    /**
+     * get the bulk element id of the e-th element in the (renumbered) element loop, the
+     * element loop follows the new node order, while the element id is still the one of the mesh
+     * @param e the index of the element loop, which starts from 1
+     */
+    inline int GetIthBulkElmtIDInLoopOrder(const int &e)const{return _BulkElmtLoopOrder[e-1];}
+
     /**
      * get the i-th dof's name(here the dofs means the one defined in [dofs] block)
      * @param i the index of dofs in [dofs] block
@@ -134,9 +153,9 @@ public:
      * @param elDofsActiveFlag the active flags of the elemental dofs' ID, 1-> for active status,0-> for deactive status
      */
     inline void GetBulkMeshIthBulkElmtDofIndex(const int &e,vector<int> &elDofs,vector<double> &elDofsActiveFlag)const{
-        for(int i=0;i<static_cast<int>(_BulkElmtDofsMap[e-1].size());i++){
-            elDofs[i]=_BulkElmtDofsMap[e-1][i];
-            elDofsActiveFlag[i]=_BulkElmtDofFlag[e-1][i];
+        for(int i=_BulkElmtDofsOffset[e-1],k=0;i<_BulkElmtDofsOffset[e];i++,k++){
+            elDofs[k]=_BulkElmtDofsMap[i];
+            elDofsActiveFlag[k]=_BulkElmtDofFlag[i];
         }
     }
 
@@ -146,8 +165,8 @@ public:
      * @param elDofs the int vector which stores the elemental dofs' ID
      */
     inline void GetBulkMeshIthBulkElmtDofIndex(const int &e,vector<int> &elDofs)const{
-        for(int i=0;i<static_cast<int>(_BulkElmtDofsMap[e-1].size());i++){
-            elDofs[i]=_BulkElmtDofsMap[e-1][i];
+        for(int i=_BulkElmtDofsOffset[e-1],k=0;i<_BulkElmtDofsOffset[e];i++,k++){
+            elDofs[k]=_BulkElmtDofsMap[i];
         }
     }
 
@@ -158,9 +177,9 @@ public:
      * @param elDofsActiveFlag the elemental dofs' flag list
      */
     inline void GetBulkMeshIthBulkElmtDofIndex0(const int &e,vector<int> &elDofs,vector<double> &elDofsActiveFlag)const{
-        for(int i=0;i<static_cast<int>(_BulkElmtDofsMap[e-1].size());i++){
-            elDofs[i]=_BulkElmtDofsMap[e-1][i]-1;
-            elDofsActiveFlag[i]=_BulkElmtDofFlag[e-1][i];
+        for(int i=_BulkElmtDofsOffset[e-1],k=0;i<_BulkElmtDofsOffset[e];i++,k++){
+            elDofs[k]=_BulkElmtDofsMap[i]-1;
+            elDofsActiveFlag[k]=_BulkElmtDofFlag[i];
         }
     }
 
@@ -170,8 +189,8 @@ public:
      * @param elDofs the elemental dofs' id list, start from 0
      */
     inline void GetBulkMeshIthBulkElmtDofIndex0(const int &e,vector<int> &elDofs)const{
-        for(int i=0;i<static_cast<int>(_BulkElmtDofsMap[e-1].size());i++){
-            elDofs[i]=_BulkElmtDofsMap[e-1][i]-1;
+        for(int i=_BulkElmtDofsOffset[e-1],k=0;i<_BulkElmtDofsOffset[e];i++,k++){
+            elDofs[k]=_BulkElmtDofsMap[i]-1;
         }
     }
 
@@ -181,8 +200,8 @@ public:
      * @param elDofs integer array's pointer
      */
     inline void GetBulkMeshIthBulkElmtDofIndex0(const int &e,int *elDofs)const{
-        for(int i=0;i<static_cast<int>(_BulkElmtDofsMap[e-1].size());i++){
-            elDofs[i]=_BulkElmtDofsMap[e-1][i]-1;
+        for(int i=_BulkElmtDofsOffset[e-1],k=0;i<_BulkElmtDofsOffset[e];i++,k++){
+            elDofs[k]=_BulkElmtDofsMap[i]-1;
         }
     }
     
@@ -192,17 +211,41 @@ public:
      * @param elDofs integer array's pointer
      */
     inline void GetBulkMeshIthBulkElmtDofIndex(const int &e,int *elDofs)const{
-        for(int i=0;i<static_cast<int>(_BulkElmtDofsMap[e-1].size());i++){
-            elDofs[i]=_BulkElmtDofsMap[e-1][i];
+        for(int i=_BulkElmtDofsOffset[e-1],k=0;i<_BulkElmtDofsOffset[e];i++,k++){
+            elDofs[k]=_BulkElmtDofsMap[i];
         }
     }
 
+    /**
+     * get the dofs id(start from 1) of the i-th bulk element, no copy is made
+     * @param e the bulk element's id
+     */
+    inline Span<const int> GetBulkMeshIthBulkElmtDofIDs(const int &e)const{
+        return Span<const int>(_BulkElmtDofsMap.data()+_BulkElmtDofsOffset[e-1],GetBulkMeshIthBulkElmtDofsNum(e));
+    }
+
+    /**
+     * get the dofs' active flags(1->active, 0->dirichlet bc) of the i-th bulk element, no copy is made
+     * @param e the bulk element's id
+     */
+    inline Span<const uint8_t> GetBulkMeshIthBulkElmtDofFlags(const int &e)const{
+        return Span<const uint8_t>(_BulkElmtDofFlag.data()+_BulkElmtDofsOffset[e-1],GetBulkMeshIthBulkElmtDofsNum(e));
+    }
+
     /**
      * get i-th bulk element dofs number
      * @param e the element index, start from 1
      */
     inline int GetBulkMeshIthBulkElmtDofsNum(const int &e)const{
-        return static_cast<int>(_BulkElmtDofsMap[e-1].size());
+        return _BulkElmtDofsOffset[e]-_BulkElmtDofsOffset[e-1];
+    }
+
+    /**
+     * get the number of the sub-elements(the [elmt] blocks) of the i-th bulk element
+     * @param e the bulk element id
+     */
+    inline int GetBulkMeshIthBulkElmtSubElmtsNum(const int &e)const{
+        return _BulkElmtSubElmtOffset[e]-_BulkElmtSubElmtOffset[e-1];
     }
 
     /**
@@ -210,8 +253,9 @@ public:
      * @param i bulk element id
      * @param j sub-element id
      */
-    inline vector<int> GetBulkMeshIthBulkElmtJthSubElmtDofIndex(const int &i,const int &j)const{
-        return _BulkElmtLocalDofIndex[i-1][j-1];
+    inline Span<const int> GetBulkMeshIthBulkElmtJthSubElmtDofIndex(const int &i,const int &j)const{
+        const vector<int> &dofindex=_ElmtBlockLocalDofIndex[GetBulkMeshIthBulkElmtJthSubElmtBlockID(i,j)-1];
+        return Span<const int>(dofindex.data(),static_cast<int>(dofindex.size()));
     }
 
     /**
@@ -220,7 +264,53 @@ public:
      * @param j sub element id
      */
     inline int GetBulkMeshIthBulkElmtJthSubElmtMateIndex(const int &i,const int &j)const{
-        return _BulkElmtElmtMateIndexList[i-1][j-1];
+        return _ElmtBlockMateIndexList[GetBulkMeshIthBulkElmtJthSubElmtBlockID(i,j)-1];
+    }
+
+    //*********************************************
+    //*** for the quadrature of each [elmt] block
+    //*********************************************
+    /**
+     * get the [elmt] block id which decides the gauss points of the e-th bulk element, all the sub-elements
+     * of one bulk element share the same quadrature, 0 is returned if no [elmt] block is assigned
+     * @param e the bulk element id
+     */
+    inline int GetBulkMeshIthBulkElmtQpBlockID(const int &e)const{
+        if(GetBulkMeshIthBulkElmtSubElmtsNum(e)<1) return 0;
+        return GetBulkMeshIthBulkElmtJthSubElmtBlockID(e,1);
+    }
+    /**
+     * get the gauss point order of each [elmt] block, 0 means the one in [qpoints] block is used
+     */
+    inline const vector<int>& GetElmtBlockQpOrderList()const{return _ElmtBlockQpOrderList;}
+    /**
+     * get the reduced integration flag of each [elmt] block
+     */
+    inline const vector<bool>& GetElmtBlockReducedIntegrationList()const{return _ElmtBlockReducedIntList;}
+    /**
+     * get the hourglass stabilization modulus of the i-th bulk element's j-th sub-element, 0 for no stabilization
+     * @param i bulk element id
+     * @param j sub element id
+     */
+    inline double GetBulkMeshIthBulkElmtJthSubElmtHourglassStiffness(const int &i,const int &j)const{
+        return _ElmtBlockHourglassList[GetBulkMeshIthBulkElmtJthSubElmtBlockID(i,j)-1];
+    }
+    /**
+     * check whether the i-th bulk element's j-th sub-element uses the lumped time derivative terms
+     * @param i bulk element id
+     * @param j sub element id
+     */
+    inline bool IsBulkMeshIthBulkElmtJthSubElmtLumpedMass(const int &i,const int &j)const{
+        return _ElmtBlockLumpedMassList[GetBulkMeshIthBulkElmtJthSubElmtBlockID(i,j)-1];
+    }
+    /**
+     * check whether any [elmt] block uses the one-point reduced integration
+     */
+    inline bool HasReducedIntegrationElmtBlock()const{
+        for(const auto &it:_ElmtBlockReducedIntList){
+            if(it) return true;
+        }
+        return false;
     }
 
     /**
@@ -229,7 +319,7 @@ public:
      * @param j coordinate component, start from 1
      */
     inline int GetBulkMeshIthNodeJthDofIndex(const int &i,const int &j)const{
-        return _NodeDofsMap[i-1][j-1];
+        return _NodeDofsMap[(i-1)*_nDofsPerNode+j-1];
     }
 
     /**
@@ -238,7 +328,7 @@ public:
      * @param j coordinate component, start from 0
      */
     inline int GetBulkMeshIthNodeJthDofIndex0(const int &i,const int &j)const{
-        return _NodeDofsMap[i-1][j-1]-1;
+        return _NodeDofsMap[(i-1)*_nDofsPerNode+j-1]-1;
     }
 
     //*********************************************
@@ -263,7 +353,11 @@ public:
      * @param e the element id
      */
     inline vector<pair<ElmtType,MateType>> GetBulkMeshIthBulkElmtElmtMateTypePair(const int &e)const{
-        return _BulkElmtElmtMateTypePairList[e-1];
+        vector<pair<ElmtType,MateType>> temp;temp.clear();
+        for(int j=1;j<=GetBulkMeshIthBulkElmtSubElmtsNum(e);j++){
+            temp.push_back(_ElmtBlockElmtMateTypePairList[GetBulkMeshIthBulkElmtJthSubElmtBlockID(e,j)-1]);
+        }
+        return temp;
     }
 
     /**
@@ -272,7 +366,7 @@ public:
      * @param j j-th sub element
      */
     inline ElmtType GetBulkMeshIthBulkElmtJthSubElmtElmtType(const int &i,const int &j)const{
-        return _BulkElmtElmtMateTypePairList[i-1][j-1].first;
+        return _ElmtBlockElmtMateTypePairList[GetBulkMeshIthBulkElmtJthSubElmtBlockID(i,j)-1].first;
     }
 
     /**
@@ -281,8 +375,8 @@ public:
      */
     inline vector<ElmtType> GetBulkMeshIthBulkElmtElmtTypeVec(const int &e)const{
         vector<ElmtType> temp;temp.clear();
-        for(auto it:_BulkElmtElmtMateTypePairList[e-1]){
-            temp.push_back(it.first);
+        for(int j=1;j<=GetBulkMeshIthBulkElmtSubElmtsNum(e);j++){
+            temp.push_back(GetBulkMeshIthBulkElmtJthSubElmtElmtType(e,j));
         }
         return temp;
     }
@@ -293,7 +387,7 @@ public:
      * @param j sub element id
      */
     inline MateType GetBulkMeshIthBulkElmtJthSubElmtMateType(const int &i,const int &j)const{
-        return _BulkElmtElmtMateTypePairList[i-1][j-1].second;
+        return _ElmtBlockElmtMateTypePairList[GetBulkMeshIthBulkElmtJthSubElmtBlockID(i,j)-1].second;
     }
     
     /**
@@ -302,12 +396,37 @@ public:
      */
     inline vector<MateType> GetBulkMeshIthBulkElmtMateTypeVec(const int &e)const{
         vector<MateType> temp;temp.clear();
-        for(auto it:_BulkElmtElmtMateTypePairList[e-1]){
-            temp.push_back(it.second);
+        for(int j=1;j<=GetBulkMeshIthBulkElmtSubElmtsNum(e);j++){
+            temp.push_back(GetBulkMeshIthBulkElmtJthSubElmtMateType(e,j));
         }
         return temp;
     }
 
+    /**
+     * get the [elmt] block id(start from 1) of the i-th bulk element's j-th sub-element
+     */
+    inline int GetBulkMeshIthBulkElmtJthSubElmtBlockID(const int &i,const int &j)const{
+        return _BulkElmtSubElmtBlockIDList[_BulkElmtSubElmtOffset[i-1]+j-1];
+    }
+    /**
+     * get the element and material type of each [elmt] block
+     */
+    inline const vector<pair<ElmtType,MateType>>& GetElmtBlockElmtMateTypePairList()const{return _ElmtBlockElmtMateTypePairList;}
+
+private:
+    /**
+     * create the new node order and the element loop order according to the renumbering type,
+     * the bandwidth and the profile of the node graph before and after the renumbering are calculated as well
+     */
+    void CreateNodesRenumberMap(const Mesh &mesh);
+    void CreateRCMNodesOrder(const Mesh &mesh,const vector<int> &node2elmtoffset,const vector<int> &node2elmt);
+    void CreateSFCNodesOrder(const Mesh &mesh,const vector<int> &node2elmtoffset);
+    /**
+     * calculate the bandwidth and the profile of the node graph for the given node index (new index of each node)
+     */
+    void GetNodesGraphBandwidth(const Mesh &mesh,const vector<int> &nodeindex,int &bandwidth,long long &profile)const;
+
+public:
     /**
      * print out the information of the bulk dofs system
      */
@@ -316,6 +435,10 @@ public:
      * print out the details of the bulk dofs system 
      */
     void PrintBulkDofDetailInfo()const;
+    /**
+     * get the memory usage(in bytes) of all the dofs maps on the current rank
+     */
+    double GetMemoryUsage()const;
 
 protected:
     //*************************************************
@@ -333,13 +456,34 @@ protected:
     vector<pair<int,string>> _DofID2NameList;
     vector<pair<string,int>> _DofName2IDList;
 
-    vector<vector<int>> _NodeDofsMap;
-    vector<vector<double>> _NodalDofFlag,_BulkElmtDofFlag;
-    vector<vector<int>> _BulkElmtDofsMap;
+    //*************************************************
+    //*** all the maps are stored in flat arrays, the nodal ones use the fixed
+    //*** stride(_nDofsPerNode), the elemental ones use the offset array(CSR)
+    //*************************************************
+    vector<int>     _NodeDofsMap;    // the dof id(start from 1) of the i-th node's j-th dof
+    vector<int8_t>  _NodalDofFlag;   // -1 for the unused dof, 0 for the dirichlet bc, 1 for the others
+    vector<int>     _BulkElmtDofsOffset;// the dofs of the e-th bulk element are in [_BulkElmtDofsOffset[e-1],_BulkElmtDofsOffset[e])
+    vector<int>     _BulkElmtDofsMap;
+    vector<uint8_t> _BulkElmtDofFlag;// 1 for the active dof, 0 for the dirichlet bc
+
+    vector<int> _BulkElmtSubElmtOffset;// the sub-elements of the e-th bulk element are in [_BulkElmtSubElmtOffset[e-1],_BulkElmtSubElmtOffset[e])
+    vector<int> _BulkElmtSubElmtBlockIDList;// the [elmt] block id of each sub-element
+    vector<pair<ElmtType,MateType>> _ElmtBlockElmtMateTypePairList;// the element and material type of each [elmt] block
+    vector<int>                     _ElmtBlockMateIndexList;
+    vector<vector<int>>             _ElmtBlockLocalDofIndex;
+    vector<int>                     _ElmtBlockQpOrderList;// 0 for the global [qpoints] order
+    vector<bool>                    _ElmtBlockReducedIntList;
+    vector<double>                  _ElmtBlockHourglassList;
+    vector<bool>                    _ElmtBlockLumpedMassList;
 
-    vector<vector<pair<ElmtType,MateType>>> _BulkElmtElmtMateTypePairList;
-    vector<vector<int>> _BulkElmtElmtMateIndexList; 
-    vector<vector<vector<int>>> _BulkElmtLocalDofIndex;
+    //*************************************************
+    //*** for the renumbering of the nodes
+    //*************************************************
+    DofRenumberType _DofRenumberType=DofRenumberType::NONE;
+    vector<int> _NodesOrder;// the old node id(start from 1) of the i-th node in the new order
+    vector<int> _BulkElmtLoopOrder;// the bulk element id(start from 1) of the i-th element in the loop
+    int _BandwidthOld=0,_BandwidthNew=0;
+    long long _ProfileOld=0,_ProfileNew=0;
 
     // for the length of non-zero element per row
     vector<int> _RowNNZ;
@@ -0,0 +1,22 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.24
+//+++ Purpose: Define the renumbering method of the DoFs, the nodes
+//+++          are reordered before the DoFs map is created
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+enum class DofRenumberType{
+    NONE,// the raw node order of the mesh
+    RCM, // reverse Cuthill-McKee
+    SFC  // space filling curve (Morton order)
+};
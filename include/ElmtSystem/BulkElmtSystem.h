@@ -114,16 +114,6 @@ public:
         return _nBulkElmtBlocks;
     }
 
-
-    void RunBulkElmtLibs(const FECalcType &calctype,const ElmtType &elmtytype,
-                         const double (&ctan)[3],
-                         const LocalElmtInfo &elmtinfo,
-                         const LocalElmtSolution &soln,
-                         const LocalShapeFun &shp,
-                         const Materials &Mate,const Materials &MateOld,
-                         ScalarMateType &gpProj,
-                         MatrixXd &localK,VectorXd &localR);
-
     void PrintBulkElmtInfo()const;
 
 protected:
@@ -37,6 +37,10 @@ public:
         _ElmtType=ElmtType::NULLELMT;
         _MateType=MateType::NULLMATE;
         _MateIndex=0;
+        _QpOrder=0;
+        _IsReducedIntegration=false;
+        _HourglassStiffness=0.0;
+        _IsLumpedMass=false;
     }
 
     vector<int>    _DofsIDList;
@@ -49,6 +53,10 @@ public:
     ElmtType       _ElmtType=ElmtType::NULLELMT;
     MateType       _MateType=MateType::NULLMATE;
     int            _MateIndex=0;
+    int            _QpOrder=0;                 // the gauss point order of current block, 0 for the one in [qpoints]
+    bool           _IsReducedIntegration=false;// true for the one-point integration(quad4/hex8 only)
+    double         _HourglassStiffness=0.0;    // the hourglass stabilization modulus for the reduced integration
+    bool           _IsLumpedMass=false;        // true for the row-sum lumped time derivative(mass/capacity) terms
     
     void Init(){
         _DofsIDList.clear();
@@ -61,6 +69,10 @@ public:
         _ElmtType=ElmtType::NULLELMT;
         _MateType=MateType::NULLMATE;
         _MateIndex=0;
+        _QpOrder=0;
+        _IsReducedIntegration=false;
+        _HourglassStiffness=0.0;
+        _IsLumpedMass=false;
     }
 
     void PrintInfo()const{
@@ -80,5 +92,18 @@ public:
 
         str="   domain name ="+_DomainName;
         MessagePrinter::PrintNormalTxt(str);
+
+        if(_IsReducedIntegration){
+            str="   integration= reduced(one point), hourglass stiffness="+to_string(_HourglassStiffness);
+            MessagePrinter::PrintNormalTxt(str);
+        }
+        else if(_QpOrder>0){
+            str="   qpoint order="+to_string(_QpOrder);
+            MessagePrinter::PrintNormalTxt(str);
+        }
+        if(_IsLumpedMass){
+            str="   mass matrix= lumped(row-sum)";
+            MessagePrinter::PrintNormalTxt(str);
+        }
     }
 };
\ No newline at end of file
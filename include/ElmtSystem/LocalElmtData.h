@@ -20,6 +20,7 @@
 #include <iostream>
 #include <vector>
 #include "Utils/Vector3d.h"
+#include "Utils/Span.h"
 
 using namespace std;
 
@@ -56,15 +57,16 @@ struct LocalShapeFun{
 
 /**
  * This structure stores the displacement 'u', the velocity 'v' and their gradient 
- * for the local element
+ * for the local element, they are the views of the scratch arrays owned by FESystem(or BCSystem),
+ * so no copy is needed for each gauss point. The index starts from 1 !!!
  */
 struct LocalElmtSolution{
-    vector<double> gpU;   /**< the solution vector of local displacement 'u'*/
-    vector<double> gpUold;/**< the solution vector of local displacement 'u' in the previous step*/
-    vector<double> gpV;   /**< the solution vector of local displacement 'v'*/
-    vector<double> gpVold;/**< the solution vector of local displacement 'v' in the previous step*/
-    vector<Vector3d> gpGradU;   /**< the gradient vector of local disp 'u'*/
-    vector<Vector3d> gpGradUold;/**< the gradient vector of local disp 'u' in the previous step*/
-    vector<Vector3d> gpGradV;   /**< the gradient vector of local disp 'u'*/
-    vector<Vector3d> gpGradVold;/**< the gradient vector of local disp 'u' in the previous step*/
+    Span<double> gpU;   /**< the solution vector of local displacement 'u'*/
+    Span<double> gpUold;/**< the solution vector of local displacement 'u' in the previous step*/
+    Span<double> gpV;   /**< the solution vector of local displacement 'v'*/
+    Span<double> gpVold;/**< the solution vector of local displacement 'v' in the previous step*/
+    Span<Vector3d> gpGradU;   /**< the gradient vector of local disp 'u'*/
+    Span<Vector3d> gpGradUold;/**< the gradient vector of local disp 'u' in the previous step*/
+    Span<Vector3d> gpGradV;   /**< the gradient vector of local disp 'u'*/
+    Span<Vector3d> gpGradVold;/**< the gradient vector of local disp 'u' in the previous step*/
 };
@@ -30,6 +30,11 @@ public:
     void InitEquationSystem(const int &ndofs,const int &maxrownnz);
     void CreateSparsityPattern(DofHandler &dofHandler);
 
+    /**
+     * get the memory usage(in bytes) of the local rows of the matrix and the residual vector
+     */
+    double GetMemoryUsage()const;
+
     void ReleaseMem();
 
 public:
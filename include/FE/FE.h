@@ -21,6 +21,7 @@
 #include "Mesh/Mesh.h"
 #include "FE/QPoint.h"
 #include "FE/ShapeFun.h"
+#include "FE/TensorProductKernel.h"
 
 class Mesh;
 
@@ -37,6 +38,13 @@ public:
     void SetBulkQpOrder(int order);
     void SetBCQpOrder(int order);
     void CreateQPoints(Mesh &mesh);
+    /**
+     * create the gauss points of each [elmt] block, the block without its own order shares the bulk one
+     * @param mesh the mesh class
+     * @param qporders the gauss point order of each [elmt] block, 0 for the global one
+     * @param reducedflags true for the one-point reduced integration(quad4/hex8 only)
+     */
+    void CreateBlockBulkQPoints(Mesh &mesh,const vector<int> &qporders,const vector<bool> &reducedflags);
     //***********************************************
     //*** for shape functions
     //***********************************************
@@ -50,6 +58,27 @@ public:
     inline int GetMinDim()const{return _nMinDim;}
 
     QPoint& GetBulkQPointPtr(){return _BulkQPoint;}
+    /**
+     * get the gauss points of the i-th [elmt] block, the bulk one is returned for i<1
+     * @param i the [elmt] block id, start from 1
+     */
+    inline QPoint& GetIthBlockBulkQPointPtr(const int &i){
+        if(i<1||i>static_cast<int>(_BlockBulkQPoints.size())) return _BulkQPoint;
+        return _BlockBulkQPoints[i-1];
+    }
+    /**
+     * get the maximum gauss points number of all the bulk elements, it is the stride of the materials storage
+     */
+    inline int GetMaxBulkQpPointsNum()const{return _nMaxBulkQpPoints;}
+    /**
+     * get the sum-factorization kernel of the i-th [elmt] block, the bulk one is returned for i<1,
+     * the kernel is inactive for the non-tensor-product elements
+     * @param i the [elmt] block id, start from 1
+     */
+    inline TensorProductKernel& GetIthBlockBulkKernelPtr(const int &i){
+        if(i<1||i>static_cast<int>(_BlockBulkKernels.size())) return _BulkKernel;
+        return _BlockBulkKernels[i-1];
+    }
     QPoint& GetLineQPointPtr(){return _LineQPoint;}
     QPoint& GetSurfaceQPointPtr(){return _SurfaceQPoint;}
 
@@ -70,5 +99,9 @@ private:
     bool _HasDimSet=false;
     bool _IsInit=false;
     int _nBulkQpOrder,_nBCQpOrder;
+    int _nMaxBulkQpPoints=1;
+    vector<QPoint> _BlockBulkQPoints;// the gauss points of each [elmt] block
+    TensorProductKernel _BulkKernel;// the sum-factorization kernel for the bulk gauss points
+    vector<TensorProductKernel> _BlockBulkKernels;// the sum-factorization kernel of each [elmt] block
     
 };
\ No newline at end of file
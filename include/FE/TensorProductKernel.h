@@ -0,0 +1,99 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.02
+//+++ Purpose: the sum-factorization kernel for the tensor-product
+//+++          lagrange elements, i.e. quad4,quad9,hex8 and hex27
+//+++          the interpolation on all the gauss points is done
+//+++          by the 1D basis direction by direction, which costs
+//+++          O(n^(d+1)) instead of O(n^(2d)) of the node-by-node
+//+++          loop, the transpose one is also offered for the
+//+++          residual evaluation and matrix-free applications
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <vector>
+
+#include "Mesh/MeshType.h"
+#include "Mesh/Nodes.h"
+#include "FE/QPoint.h"
+#include "Utils/Vector3d.h"
+
+using std::vector;
+
+class TensorProductKernel{
+public:
+    TensorProductKernel();
+
+    /**
+     * setup the 1D basis and the gauss point tables, the kernel is inactive if the element(i.e. quad8/hex20)
+     * or the gauss points are not tensor-product ones
+     * @param dim the dimension of the bulk element
+     * @param meshtype the bulk element type
+     * @param qpoint the gauss points of the bulk element
+     */
+    bool Init(const int &dim,const MeshType &meshtype,const QPoint &qpoint);
+    /**
+     * return true if the sum-factorization can be used for current element and gauss points
+     */
+    inline bool IsActive()const{return _IsActive;}
+    inline int GetQpPointsNum()const{return _nQpPoints;}
+    /**
+     * calculate the jacobian, its inverse and the coordinates on all the gauss points
+     * @param elNodes the nodal coordinates of current element
+     */
+    bool CalcGeometry(const Nodes &elNodes);
+    /**
+     * get the determinant of the jacobian on the i-th gauss point, i starts from 1(the order of qpoint class)
+     */
+    inline double GetIthQpDetJac(const int &i)const{return _DetJac[i-1];}
+    /**
+     * get the j-th coordinate of the i-th gauss point, both i and j start from 1
+     */
+    inline double GetIthQpJthCoord(const int &i,const int &j)const{return _QpCoords[(i-1)*3+j-1];}
+
+    /**
+     * interpolate the nodal values to all the gauss points, CalcGeometry must be called first
+     * @param nodal the nodal values, the a-th node's value is nodal[a*stride] (a starts from 0)
+     * @param stride the stride of the nodal array
+     * @param val the values on the gauss points, in the order of qpoint class
+     * @param grad the physical gradients on the gauss points, in the order of qpoint class
+     */
+    void Interpolate(const double *nodal,const int &stride,double *val,Vector3d *grad);
+    /**
+     * the transpose of Interpolate, nodal[a*stride]+=sum_q(N_a*val_q+grad(N_a).grad_q), the JxW should be
+     * included in val and grad by the caller
+     * @param val the values on the gauss points, in the order of qpoint class
+     * @param grad the physical vectors(i.e. flux) on the gauss points, in the order of qpoint class
+     * @param stride the stride of the nodal array
+     * @param nodal the nodal array to be accumulated
+     */
+    void Integrate(const double *val,const Vector3d *grad,const int &stride,double *nodal);
+
+private:
+    /**
+     * the reference gradients(and values) on all the gauss points in the lexicographic order
+     */
+    void InterpolateReference(const double *ulex,double *vlex,double *glex);
+    void IntegrateReference(const double *vlex,const double *glex,double *ulex);
+
+private:
+    bool _IsActive;
+    int _nDim;
+    int _n1DNodes,_n1DQpPoints;// nodes and gauss points along one direction
+    int _nNodes,_nQpPoints;
+    vector<double> _B,_D;// the 1D basis and its derivative on the 1D gauss points, [q*_n1DNodes+a]
+    vector<int> _NodeLex;// the lexicographic index of the a-th node
+    vector<int> _QpLex;// the lexicographic index of the q-th gauss point
+    vector<double> _DetJac,_XJac,_QpCoords;// XJac(c,r)=_XJac[q*9+(c-1)*3+r-1], the inverse of jacobian
+    vector<double> _ULex,_VLex,_GLex;// the nodal/gauss point buffers in lexicographic order
+    vector<double> _Tmp1,_Tmp2;// the buffers for the partial contraction
+};
@@ -39,6 +39,7 @@
 #include "FEProblem/FEJobType.h"
 #include "FEProblem/FEControlInfo.h"
 #include "FEProblem/FEJobBlock.h"
+#include "FEProblem/MemoryReport.h"
 
 using namespace std;
 
@@ -49,6 +50,20 @@ public:
     void InitFEProblem(int args,char *argv[]);
 
     void Run();
+    /**
+     * read the input file and initialize all the components, no solve is done, it is called by Run
+     */
+    void Setup();
+    /**
+     * run the bulk element loop once on current solution, it is used by the benchmarks
+     * @param calctype the calculation type, i.e. residual or jacobian
+     * @param t the current time
+     * @param dt the current time increment
+     */
+    void FormBulkSystem(const FECalcType &calctype,const double &t,const double &dt);
+
+    inline const Mesh& GetMesh()const{return _mesh;}
+    inline SolutionSystem& GetSolutionSystem(){return _solutionSystem;}
 
     void Finalize();
 
@@ -58,6 +73,10 @@ private:
 
     void RunStaticAnalysis();
     void RunTransientAnalysis();
+    /**
+     * initialize the materials and report the memory usage, no solve is done
+     */
+    void RunDryRun();
 
 private:
     InputSystem _inputSystem;
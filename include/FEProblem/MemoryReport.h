@@ -0,0 +1,63 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.15
+//+++ Purpose: Collect the memory usage of each major component,
+//+++          the report is given after the setup and at the
+//+++          step with the peak memory(only for '--profile')
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "Utils/MemoryUsage.h"
+#include "Utils/Profiler.h"
+
+#include "Mesh/Mesh.h"
+#include "DofHandler/DofHandler.h"
+#include "SolutionSystem/SolutionSystem.h"
+#include "EquationSystem/EquationSystem.h"
+#include "NonlinearSolver/NonlinearSolver.h"
+#include "OutputSystem/OutputSystem.h"
+
+using namespace std;
+
+class MemoryReport{
+public:
+    /**
+     * collect the memory usage(in bytes) of all the major components on the current rank
+     * @param IsEstimate if true, the factorization is estimated from the system matrix(i.e. before any solve)
+     */
+    static void Collect(const Mesh &mesh,const DofHandler &dofHandler,
+                        const SolutionSystem &solutionSystem,const EquationSystem &equationSystem,
+                        const NonlinearSolver &nonlinearSolver,const OutputSystem &outputSystem,
+                        const bool &IsEstimate,
+                        vector<MemoryRecord> &records);
+    /**
+     * print the memory usage after the setup, it is stored in the profiling report as well, since no solve is
+     * done yet, the factorization is estimated from the system matrix, this is collective
+     */
+    static void PrintSetupReport(const Mesh &mesh,const DofHandler &dofHandler,
+                                 const SolutionSystem &solutionSystem,const EquationSystem &equationSystem,
+                                 const NonlinearSolver &nonlinearSolver,const OutputSystem &outputSystem);
+    /**
+     * if the process memory reaches a new peak, the memory usage of current step is stored in the profiling
+     * report, nothing is done if the profiling is disabled, this is collective
+     * @param step the current time step
+     */
+    static void UpdatePeak(const int &step,const Mesh &mesh,const DofHandler &dofHandler,
+                           const SolutionSystem &solutionSystem,const EquationSystem &equationSystem,
+                           const NonlinearSolver &nonlinearSolver,const OutputSystem &outputSystem);
+
+private:
+    static double _PeakUsage;// the max process memory over all the ranks of the previous peak
+};
@@ -41,10 +41,23 @@
 #include "Utils/Vector3d.h"
 #include "Utils/VectorXd.h"
 #include "Utils/MatrixXd.h"
+#include "Utils/ScratchArena.h"
 #include "ElmtSystem/LocalElmtData.h"
 
 using namespace std;
 
+/**
+ * The addresses of the projected quantities inside one name->value map. The nodes of std::map are never moved
+ * by an insertion, so the addresses are only resolved again once the map is changed or its generation is renewed,
+ * i.e. the map is cleaned or copied by its owner
+ */
+template<class T>
+struct ProjSlots{
+    vector<const T*> values;/**< the address of each projected quantity, in the order of the projection names */
+    const map<string,T> *owner=nullptr;/**< the map which the addresses belong to */
+    size_t generation=0;/**< the generation of the map when the addresses are resolved */
+};
+
 /**
  * This class responsible for the system matrix calculation, i.e., the calculation of global
  * residual and jacobian, the local to global space assemble.
@@ -70,6 +83,11 @@ public:
     inline double GetMaxAMatrixValue()const {return _MaxKMatrixValue;}
     inline double GetBulkVolume() const {return _BulkVolumes;}
 
+    /**
+     * release the PETSc objects used by the projection and the solution scatter
+     */
+    void ReleaseMem();
+
     /**
      * This function will do the calculation for residual, jacobian, and projection
      */
@@ -78,6 +96,14 @@ public:
                 ElmtSystem &elmtSystem,MateSystem &mateSystem,
                 SolutionSystem &solutionSystem,
                 Mat &AMATRIX,Vec &RHS);
+    /**
+     * Do the projection only if the projected quantities are outdated, otherwise the cached ones will be used
+     */
+    void UpdateProjection(const double &t,const double &dt,const double (&ctan)[3],
+                Mesh &mesh,const DofHandler &dofHandler,FE &fe,
+                ElmtSystem &elmtSystem,MateSystem &mateSystem,
+                SolutionSystem &solutionSystem,
+                Mat &AMATRIX,Vec &RHS);
     
     
 private:
@@ -127,36 +153,87 @@ private:
     //*** for projection
     //*********************************************************
     /**
-     * Assemble the projected quantities to the global array
+     * Resolve the projected names to the slots of the nodal block, and allocate the local buffers
      */
-    void AssembleLocalProjectionToGlobal(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                         const map<string,double> &ProjVariables,
-                                         const ScalarMateType &ScalarMate,
-                                         const VectorMateType &VectorMate,
-                                         const Rank2MateType &Rank2Mate,
-                                         const Rank4MateType &Rank4Mate,
-                                         SolutionSystem &solutionSystem);
-
-    void AssembleLocalProjVariable2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                          const int &nProj,vector<string> ProjNameVec,const map<string,double> &elProj,Vec &ProjVec);
-
-    void AssembleLocalProjScalarMate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                            const int &nProj,vector<string> ProjNameVec,const ScalarMateType &ScalarMate,Vec &ProjVec);
+    void InitProjection(const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem);
+    /**
+     * Accumulate the projected quantities of current gauss point to the local element's buffer
+     */
+    void AccumulateLocalProjection(const int &nNodes,const double &JxW,const ShapeFun &shp,
+                                   const map<string,double> &ProjVariables,
+                                   const ScalarMateType &ScalarMate,
+                                   const VectorMateType &VectorMate,
+                                   const Rank2MateType &Rank2Mate,
+                                   const Rank4MateType &Rank4Mate,
+                                   const size_t &MateGeneration);
+    /**
+     * Assemble the local element's buffer to the global blocked projection vector
+     */
+    void AssembleLocalProjectionToGlobal(const int &nNodes,Vec &ProjVec);
 
-    void AssembleLocalProjVectorMate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                            const int &nProj,vector<string> ProjNameVec,const VectorMateType &VectorMate,Vec &ProjVec);
+    void PackProjVariable(const map<string,double> &elProj);
+    void PackProjScalarMate(const ScalarMateType &ScalarMate,const size_t &MateGeneration);
+    void PackProjVectorMate(const VectorMateType &VectorMate,const size_t &MateGeneration);
+    void PackProjRank2Mate(const Rank2MateType &Rank2Mate,const size_t &MateGeneration);
+    void PackProjRank4Mate(const Rank4MateType &Rank4Mate,const size_t &MateGeneration);
 
-    void AssembleLocalProjRank2Mate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                            const int &nProj,vector<string> ProjNameVec,const Rank2MateType &Rank2Mate,Vec &ProjVec);
+    /**
+     * the final projection function for the quantities from gauss point to the nodal one,
+     * the assembled right-hand side is either scaled by the lumped mass or solved with the consistent mass
+     */
+    void Projection(SolutionSystem &solutionSystem);
+    /**
+     * Finish the assembly of the projection mass matrix, this is only done once for the first projection
+     */
+    void FinalizeProjectionMass();
 
-    void AssembleLocalProjRank4Mate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                            const int &nProj,vector<string> ProjNameVec,const Rank4MateType &Rank4Mate,Vec &ProjVec);
 
+    //*********************************************************
+    //*** for the hourglass control
+    //*********************************************************
     /**
-     * the final projection function for the quantities from gauss point to the nodal one
+     * add the hourglass stabilization of the one-point integrated quad4/hex8 element to the local residual/jacobian,
+     * the shape functions should be evaluated on the element center
+     * @param dofindex the dofs index of the [elmt] block, the first nDim ones are the displacements
+     * @param hgstiffness the hourglass stabilization modulus of the [elmt] block
      */
-    void Projection(const int &nTotalNodes,SolutionSystem &solutionSystem);
+    void AccumulateHourglassStabilization(const FECalcType &calctype,const int &nDim,const int &nNodes,
+                                          const int &nDofsPerNode,const Span<const int> &dofindex,
+                                          const double &hgstiffness,const double &elVolume,const double (&ctan)[3],
+                                          const ShapeFun &shp,const Nodes &elNodes,const Span<const double> &elU,
+                                          const vector<double> &dofsactiveflag,
+                                          vector<double> &sumK,vector<double> &sumR);
 
+    //*********************************************************
+    //*** for the element kernels
+    //*********************************************************
+    /**
+     * the node(pair) loops of one sub element on current gauss point, which is instantiated for each element class,
+     * the kernel is called directly(not through the virtual function) inside the residual/jacobian/projection loops
+     * @param elmtSystem the element system, BulkElmt is one of its base class
+     * @param nDofsPerSubElmt the dofs number of the [elmt] block
+     * @param IsLumpedMass true if the lumped mass is used for the time derivative terms
+     * @param IsResidualFlux true if only the value/flux parts of the residual(_gpResVal,_gpResFlux) are calculated,
+     *                       then the node loop is done by TensorProductKernel::Integrate, shp is not used in this case
+     * @param shp the shape functions on current gauss point
+     */
+    template<class BulkElmt>
+    void RunSubElmtLoop(const FECalcType &calctype,const double (&ctan)[3],ElmtSystem &elmtSystem,
+                        const int &nNodes,const int &nDofsPerNode,const int &nDofsPerSubElmt,
+                        const bool &IsLumpedMass,const bool &IsResidualFlux,const ShapeFun &shp,
+                        const Materials &Mate,const Materials &MateOld);
+    /**
+     * the pointer to one instance of RunSubElmtLoop
+     */
+    typedef void (FESystem::*SubElmtLoop)(const FECalcType &calctype,const double (&ctan)[3],ElmtSystem &elmtSystem,
+                                          const int &nNodes,const int &nDofsPerNode,const int &nDofsPerSubElmt,
+                                          const bool &IsLumpedMass,const bool &IsResidualFlux,const ShapeFun &shp,
+                                          const Materials &Mate,const Materials &MateOld);
+    /**
+     * select the node loops of the given element type, nullptr is returned for the element without any kernel
+     * @param elmttype the element type of the [elmt] block
+     */
+    static SubElmtLoop SelectSubElmtLoop(const ElmtType &elmttype);
 
     //*********************************************************
     //*** for material properties  variables
@@ -185,22 +262,35 @@ private:
     Nodes _elNodes;
     vector<int> _elConn,_elDofs;
     vector<double> _elDofsActiveFlag;
-    vector<double> _elU,_elV;
-    vector<double> _elUold,_elVold;
-    vector<double> _gpU,_gpV;
-    vector<double> _gpUOld,_gpVOld;
+    //*** the local element's solution and the gauss point's ones are the views of _elArena,
+    //*** which is allocated once in InitBulkFESystem, then no heap memory is touched inside the element loop
+    ScratchArena _elArena;
+    Span<double> _elU,_elV;
+    Span<double> _elUold,_elVold;
+    Span<double> _gpU,_gpV;
+    Span<double> _gpUOld,_gpVOld;
+    Span<double> _gpVLumped;// the nodal rate of the test function, for the lumped mass
+    Span<double> _gpResVal;// the residual=test*val+grad_test.flux on current gauss point(sum-factorization)
+    Span<Vector3d> _gpResFlux;
     vector<double> _gpHist,_gpHistOld;
     ScalarMateType _gpProj;
-    vector<Vector3d> _gpGradU,_gpGradV;
-    vector<Vector3d> _gpGradUOld,_gpGradVOld;
+    size_t _gpProjGeneration=0;// it is renewed once _gpProj is cleaned
+    Span<Vector3d> _gpGradU,_gpGradV;
+    Span<Vector3d> _gpGradUOld,_gpGradVOld;
+    vector<double> _tpU,_tpV,_tpUOld,_tpVOld;// the solution on all the gauss points(sum-factorization)
+    vector<Vector3d> _tpGradU,_tpGradV,_tpGradUOld,_tpGradVOld;
+    vector<double> _tpResVal;// the value/flux parts of the residual on all the gauss points(times JxW)
+    vector<Vector3d> _tpResFlux;
+    vector<SubElmtLoop> _SubElmtLoops;// the node loops of each [elmt] block, they are selected only once
+    vector<MateBatch> _MateBatches;// the batched materials of each sub element(sum-factorization)
+    vector<bool> _IsBatchMate;
     vector<double> _MaterialValues;
     Vector3d _gpCoord;
     int _nHist,_nProj,_nGPoints;
     double _MaxKMatrixValue=-1.0e9,_KMatrixFactor=0.1;
 
-    ElmtType elmttype;
     MateType matetype;
-    vector<int> localDofIndex;
+    Span<const int> localDofIndex;
     int mateindex;
 
 
@@ -208,12 +298,43 @@ private:
     LocalElmtSolution _elmtsoln;
     LocalShapeFun _elmtshp;
 
+    //************************************
+    //*** For projection
+    int _nProjBlockSize=1;
+    int _ProjVariableOffset,_ScalarMateProjOffset,_VectorMateProjOffset;
+    int _Rank2MateProjOffset,_Rank4MateProjOffset;
+    vector<string> _ProjNameList,_ScalarMateProjNameList,_VectorMateProjNameList;
+    vector<string> _Rank2MateProjNameList,_Rank4MateProjNameList;
+    vector<double> _gpProjValues;// the packed quantities on current gauss point
+    ProjSlots<double> _ProjVariableSlots,_ScalarMateProjSlots;
+    ProjSlots<Vector3d> _VectorMateProjSlots;
+    ProjSlots<RankTwoTensor> _Rank2MateProjSlots;
+    ProjSlots<RankFourTensor> _Rank4MateProjSlots;
+    vector<double> _elProj;// the local element's nodal blocks
+    vector<int> _elProjNodes;// the block index of each node (start from 0)
+    //*** for the L2 projection, the mass matrix (or its lumped diagonal) is assembled
+    //*** during the first projection and reused for all the projected fields and steps
+    ProjectionType _ProjectionType=ProjectionType::LUMPED;
+    bool _IsProjMassAssembled=false;
+    vector<double> _elProjMass;// the local consistent mass matrix
+    vector<double> _elProjMassDiag;// the local lumped mass
+    Mat _ProjMass=nullptr;
+    Vec _ProjMassDiag=nullptr,_ProjRHS=nullptr,_ProjSol=nullptr;
+    KSP _ProjKSP=nullptr;
+
 private:
     //************************************
     //*** For PETSc related vairables
     PetscMPIInt _rank,_size;
-    VecScatter _scatteru,_scatterv,_scatterproj,_scatteruold,_scattervold;
-    Vec _Useq,_Uoldseq;// this can contain the ghost node from other processor
-    Vec _Vseq,_Voldseq;
-    Vec _ProjSeq;
+    /**
+     * create the scatter of the dofs used by the local elements, it is created only once and shared by
+     * U, V and their old ones, since they have the same parallel layout and the elements of each rank never change
+     */
+    void InitLocalElmtScatter(const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solution);
+    VecScatter _scatteru=nullptr;
+    Vec _Useq=nullptr,_Uoldseq=nullptr;// they contain the ghost node from other processor
+    Vec _Vseq=nullptr,_Voldseq=nullptr;
+    vector<PetscInt> _LocalDofs;// the sorted global dofs(start from 0) of the local elements
+    vector<PetscInt> _LocalElmtDofsOffset;// the offset of each local element(in the loop order) in _LocalElmtDofs
+    vector<PetscInt> _LocalElmtDofs;// the index of each element's dof in the sequential vectors
 };
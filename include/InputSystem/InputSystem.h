@@ -94,6 +94,23 @@ public:
                        FEJobBlock &feJobBlock);
 
     bool IsReadOnlyMode()const{return _IsReadOnly;}
+    bool IsRestart()const{return _IsRestart;}
+    string GetRestartFileName()const{return _RestartFileName;}
+    /**
+     * '--profile' can be given anywhere after the executable, the report is printed at the end of the run
+     */
+    bool IsProfile()const{return _IsProfile;}
+    /**
+     * in the dry-run mode, all the components are initialized and the memory usage is estimated, no solve is done
+     */
+    bool IsDryRun()const{return _IsDryRun;}
+    string GetInputFileName()const{return _InputFileName;}
+
+private:
+    /**
+     * reset the input file name and the command line options to their default values
+     */
+    void SetDefaultOptions();
 
 private:
     
@@ -103,8 +120,12 @@ private:
     MeshIO _meshio;
     NonlinearSolverBlock _nonlinearSolverBlock;
     string _InputFileName,_MeshFileName;
+    string _RestartFileName;
     bool _HasInputFileName=false;
     bool _IsBuiltInMesh=true;
     bool _IsReadOnly=false;
+    bool _IsRestart=false;
+    bool _IsProfile=false;
+    bool _IsDryRun=false;
 
 };
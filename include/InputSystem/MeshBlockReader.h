@@ -46,6 +46,14 @@ public:
      * Implement the helper function for [mesh] block
      */
     virtual void PrintHelper() override;
+private:
+    /**
+     * read the value of the 'cache=' option, it is shared by all the imported mesh types
+     * @param str the lower case string of current line
+     * @param linenum the line number of current line
+     */
+    bool ReadCacheOption(const string &str,const int &linenum);
+
 private:
     string _InputFileName;/**< this string store the input file name, it should be initiliazed in the InputSystem class */
     string _MeshFileName; /**< this string store the name for the output mesh file, defaul format is vtu */
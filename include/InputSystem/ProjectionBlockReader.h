@@ -31,7 +31,7 @@ public:
      * The basic structure of this block should look like: <br>
      * <pre>
      * [projection]
-     *   type=mate-type-1
+     *   type=lumped [consistent]
      *   name=projection-variable-name
      *   scalarmate=scalar-material-name
      *   vectormate=vector-material-name
@@ -39,6 +39,8 @@ public:
      *   rank4mate=rank4-material-name
      * [end]
      * </pre>
+     * 'type=lumped' scales the assembled gauss point quantities by the lumped mass,
+     * while 'type=consistent' solves the consistent mass system with CG (more accurate, but slower)
      * @param in the ifstream for input file reading
      * @param str the string variable constains '[projection]' line
      * @param linenum the current line number, which should be update during the file reading
@@ -31,6 +31,7 @@
 #include "Utils/MessagePrinter.h"
 #include "MateSystem/MateBlock.h"
 #include "MateSystem/Materials.h"
+#include "MateSystem/MateBatch.h"
 
 #include "Utils/Vector3d.h"
 #include "Utils/RankTwoTensor.h"
@@ -117,6 +118,8 @@ public:
         _BulkMateBlockList=newbulkmatesystem._BulkMateBlockList;
         _Materials=newbulkmatesystem._Materials;
         _MaterialsOld=newbulkmatesystem._MaterialsOld;
+        _BatchMateSlots=BatchMateSlots();
+        RenewMaterialsGeneration();
         return *this;
     }
 
@@ -201,6 +204,28 @@ public:
         return _MaterialsOld.GetRank4MatePtr();
     }
 
+    /**
+     * exchange the old materials with the ones of one gauss point, nothing is copied. Call it again with the
+     * same maps to give them back, the old materials are read-only in between
+     * @param scalarold the old scalar materials of the gauss point
+     * @param vectorold the old vector materials of the gauss point
+     * @param rank2old the old rank-2 materials of the gauss point
+     * @param rank4old the old rank-4 materials of the gauss point
+     */
+    inline void SwapMaterialsOld(ScalarMateType &scalarold,VectorMateType &vectorold,
+                                 Rank2MateType &rank2old,Rank4MateType &rank4old){
+        _MaterialsOld.GetScalarMatePtr().swap(scalarold);
+        _MaterialsOld.GetVectorMatePtr().swap(vectorold);
+        _MaterialsOld.GetRank2MatePtr().swap(rank2old);
+        _MaterialsOld.GetRank4MatePtr().swap(rank4old);
+    }
+
+    /**
+     * get the generation of the current material maps, it is changed once the maps are cleaned or copied, then
+     * the addresses resolved inside the old maps can not be used anymore
+     */
+    inline size_t GetMaterialsGeneration()const{return _MaterialsGeneration;}
+
     /**
      * get the reference of materials class
      */
@@ -347,6 +372,52 @@ public:
                           const LocalElmtInfo &elmtinfo,
                           const LocalElmtSolution &elmtsoln);
 
+    //***************************************************************************
+    //*** For the batched evaluation of the built-in materials
+    //***************************************************************************
+    /**
+     * return true if the material has a batched kernel, i.e. the small strain materials whose only input is
+     * the displacement gradient of the first nDim dofs
+     * @param imate the type of the bulk material
+     */
+    inline static bool IsBatchMateType(const MateType &imate){
+        return imate==MateType::LINEARELASTICMATE||imate==MateType::J2PLASTICITYMATE;
+    }
+    /**
+     * return the number of history variables per point used by the batched kernel
+     * @param imate the type of the bulk material
+     */
+    inline static int GetBatchMateHistNum(const MateType &imate){
+        if(imate==MateType::J2PLASTICITYMATE) return 10;
+        return 0;
+    }
+    /**
+     * copy the history variables of the previous step of the q-th point(start from 0) to the batch
+     * @param imate the type of the bulk material
+     * @param q the index of the point in the batch
+     * @param scalarold the scalar materials of the previous step of the q-th point
+     * @param rank2old the rank-2 materials of the previous step of the q-th point
+     * @param batch the batch data
+     */
+    void PackBulkMateBatchOld(const MateType &imate,const int &q,
+                              const ScalarMateType &scalarold,const Rank2MateType &rank2old,
+                              MateBatch &batch)const;
+    /**
+     * calculate the materials of all the points in the batch by the batched kernel
+     * @param imate the type of the bulk material
+     * @param mateindex the index of the material block, its the order you defined in your input file
+     * @param batch the batch data, the displacement gradient and the old history variables must be filled
+     */
+    void RunBulkMateBatchLibs(const MateType &imate,const int &mateindex,MateBatch &batch);
+    /**
+     * copy the results of the q-th point(start from 0) of the batch to the materials of current gauss point,
+     * the materials are the same ones of RunBulkMateLibs
+     * @param imate the type of the bulk material
+     * @param q the index of the point in the batch
+     * @param batch the batch data
+     */
+    void UnpackBulkMateBatch(const MateType &imate,const int &q,const MateBatch &batch);
+
 
 
     /**
@@ -363,5 +434,23 @@ protected:
     Materials _Materials;/**< the materials class for current time step, it contains scalar,vector,rank-2,rank-4 materials */
     Materials _MaterialsOld;/**< the materials class from previous step */
 
+    /**
+     * give the material maps a new generation, it must be called once the maps are cleaned or copied
+     */
+    void RenewMaterialsGeneration();
+
+private:
+    /**
+     * the addresses of the materials written by UnpackBulkMateBatch, they are resolved by its first call, since
+     * _Materials is only cleaned during the initialization, the map nodes are never moved later
+     */
+    struct BatchMateSlots{
+        double *VonMises=nullptr,*EffectivePlasticStrain=nullptr;
+        RankTwoTensor *Strain=nullptr,*Stress=nullptr,*PlasticStrain=nullptr;
+        RankFourTensor *Jacobian=nullptr;
+    };
+    BatchMateSlots _BatchMateSlots;
+    size_t _MaterialsGeneration=0;/**< the generation of _Materials, unique among all the material systems */
+
 
 };
@@ -15,6 +15,8 @@
 #pragma once
 
 #include "MateSystem/PlasticMaterialBase.h"
+#include "Utils/SymmetricRankFourTensor.h"
+#include "MateSystem/MateBatch.h"
 
 /**
  * This class implement the J2 plasticity model in 2D case
@@ -31,6 +33,12 @@ public:
      */ 
     virtual void ComputeMaterialProperties(const vector<double> &InputParams,const LocalElmtInfo &elmtinfo,const LocalElmtSolution &elmtsoln,const Materials &MateOld,Materials &Mate) override;
 
+    /**
+     * Compute the radial return of all the points in the batch, the displacement gradient and the history
+     * variables(plastic strain 0~8, effective plastic strain 9) of the previous step must be filled by the caller
+     */
+    void ComputeBatchMaterialProperties(const vector<double> &InputParams,MateBatch &batch);
+
 private:
     /**
      * Compute the strain, it could be small strain \f$\mathbf{\varepsilon}\f$, Green-Lagrange tensor \f$\mathbf{E}=\frac{1}{2}(\mathbf{F}^{T}\mathbf{F}-\mathbf{I})\f$.
@@ -61,6 +69,11 @@ private:
      */
     virtual void ComputeAdmissibleStressState(const vector<double> &InputParams,const LocalElmtInfo &elmtinfo,const LocalElmtSolution &elmtsoln,const RankTwoTensor &Strain,const Materials &MateOld,Materials &Mate,RankTwoTensor &Stress,RankFourTensor &Jac) override;
 
+    /**
+     * build the elastic tangent(Mandel and full-index) and the constant identities, nothing is done if E and nu are not changed
+     */
+    void UpdateElasticTangent(const double &E,const double &nu);
+
 
 private:
     inline double Sign(const double &x){
@@ -76,7 +89,10 @@ private:
     RankTwoTensor _devStress,_devStrain;
     RankTwoTensor _plastic_strain_old;
     RankTwoTensor _STrial,_N;
-    RankFourTensor _Jac,_I4Sym;
+    RankFourTensor _ElasticJac;// the full-index copy of the cached elastic tangent
+    SymmetricRankFourTensor _SymJac,_I4Sym,_IxI,_NxN;// the consistent tangent is built in Mandel notation
+    bool _IsTangentReady=false;
+    double _TangentE=0.0,_TangentNu=0.0;// the parameters of the cached elastic tangent
     double _E,_nu,_Lambda,_Mu,_Effect_Plastic_Strain_Old;
     double _F,_DeltaGamma;
     double _hardening_modulus;
@@ -14,6 +14,8 @@
 #pragma once
 
 #include "MateSystem/MechanicsMaterialBase.h"
+#include "Utils/SymmetricRankFourTensor.h"
+#include "MateSystem/MateBatch.h"
 
 /**
  * This class implement the isotropic linear elastic material for the small strain case.
@@ -30,6 +32,12 @@ public:
      */ 
     virtual void ComputeMaterialProperties(const vector<double> &InputParams, const LocalElmtInfo &elmtinfo, const LocalElmtSolution &elmtsoln, const Materials &MateOld, Materials &Mate) override;
 
+    /**
+     * Compute the strain, stress, jacobian and von-Mises stress of all the points in the batch,
+     * the displacement gradient must be filled by the caller
+     */
+    void ComputeBatchMaterialProperties(const vector<double> &InputParams,MateBatch &batch);
+
 private:
     /**
      * compute small strain
@@ -41,8 +49,16 @@ private:
      */
     virtual void ComputeStressAndJacobian(const vector<double> &InputParams, const RankTwoTensor &Strain, RankTwoTensor &Stress, RankFourTensor &Jacobian) override;
 
+    /**
+     * build the Mandel elasticity tensor and its full-index copy, nothing is done if E and nu are not changed
+     */
+    void UpdateElasticTangent(const double &E,const double &nu);
+
 
 private:
     RankTwoTensor _GradU,_Strain,_Stress,_I,_devStress;
     RankFourTensor _Jac;
+    SymmetricRankFourTensor _SymJac;// the elasticity tensor in Mandel notation
+    bool _IsTangentReady=false;
+    double _TangentE=0.0,_TangentNu=0.0;// the parameters of the cached tangent
 };
@@ -0,0 +1,82 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.08
+//+++ Purpose: Define the data binder for the batched material
+//+++          evaluation, the quantities of all the gauss points
+//+++          are stored in the structure-of-arrays layout, so the
+//+++          built-in materials can be vectorized over the points
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <vector>
+
+#include "Utils/RankTwoTensor.h"
+#include "Utils/RankFourTensor.h"
+
+using namespace std;
+
+/**
+ * This structure stores the inputs and outputs of the batched material calculation on nPoints gauss points.
+ * The c-th component of the q-th point is stored in [c*nPoints+q](both start from 0), the rank-2 tensors have
+ * 9 components in the order of 11,12,13,21,...,33, the rank-4 tensor has 81 components in the order of RankFourTensor
+ */
+struct MateBatch{
+    int nPoints=0;/**< the number of gauss points in current batch*/
+    int nHist=0;  /**< the number of history variables per point*/
+    vector<double> GradU;   /**< the displacement gradient, 9 components*/
+    vector<double> Strain;  /**< the strain tensor, 9 components*/
+    vector<double> Stress;  /**< the stress tensor, 9 components*/
+    vector<double> Jacobian;/**< the jacobian, 81 components*/
+    vector<double> VonMises;/**< the von-Mises stress, 1 component*/
+    vector<double> HistOld; /**< the history variables of the previous step, nHist components*/
+    vector<double> Hist;    /**< the updated history variables, nHist components*/
+    vector<double> Work;    /**< the scratch array for the material kernels, 16 components*/
+
+    /**
+     * resize all the arrays, the memory is only reallocated if the batch becomes larger
+     * @param npoints the number of gauss points
+     * @param nhist the number of history variables per point
+     */
+    inline void Resize(const int &npoints,const int &nhist){
+        nPoints=npoints;nHist=nhist;
+        if(static_cast<int>(GradU.size())<9*npoints){
+            GradU.resize(9*npoints,0.0);
+            Strain.resize(9*npoints,0.0);
+            Stress.resize(9*npoints,0.0);
+            Jacobian.resize(81*npoints,0.0);
+            VonMises.resize(npoints,0.0);
+            Work.resize(16*npoints,0.0);
+        }
+        if(static_cast<int>(Hist.size())<nhist*npoints){
+            HistOld.resize(nhist*npoints,0.0);
+            Hist.resize(nhist*npoints,0.0);
+        }
+    }
+    /**
+     * copy the q-th point of a 9-component array to the rank-2 tensor, q starts from 0
+     */
+    inline void GetRank2(const vector<double> &a,const int &q,RankTwoTensor &t)const{
+        for(int c=0;c<9;c++) t[c+1]=a[c*nPoints+q];
+    }
+    /**
+     * copy the rank-2 tensor to the q-th point of a 9-component array, q starts from 0
+     */
+    inline void SetRank2(const RankTwoTensor &t,const int &q,vector<double> &a)const{
+        for(int c=0;c<9;c++) a[c*nPoints+q]=t[c+1];
+    }
+    /**
+     * copy the q-th point of the jacobian array to the rank-4 tensor, q starts from 0
+     */
+    inline void GetJacobian(const int &q,RankFourTensor &t)const{
+        for(int c=0;c<81;c++) t[c+1]=Jacobian[c*nPoints+q];
+    }
+};
@@ -72,9 +72,9 @@ public:
     ScalarMateType& GetScalarMatePtr(){return _ScalarMaterials;}
 
     /**
-     * Get the copy of scalar materials 
+     * Get the read-only reference to scalar materials
      */
-    ScalarMateType  GetScalarMate()const{return _ScalarMaterials;}
+    const ScalarMateType& GetScalarMate()const{return _ScalarMaterials;}
     
     /**
      * Get the reference to vector materials 
@@ -82,9 +82,9 @@ public:
     VectorMateType& GetVectorMatePtr(){return _VectorMaterials;}
     
     /**
-     * Get the copy of vector material
+     * Get the read-only reference to vector materials
      */
-    VectorMateType GetVectorMate()const{return _VectorMaterials;}
+    const VectorMateType& GetVectorMate()const{return _VectorMaterials;}
 
     /**
      * Get the reference to rank-2 materials
@@ -92,9 +92,9 @@ public:
     Rank2MateType&  GetRank2MatePtr(){return _Rank2Materials;}
    
     /**
-     * Get the copy of rank-2 materials
+     * Get the read-only reference to rank-2 materials
      */ 
-    Rank2MateType GetRank2Mate()const{return _Rank2Materials;}
+    const Rank2MateType& GetRank2Mate()const{return _Rank2Materials;}
 
     /**
      * Get the reference to rank-4 materials 
@@ -102,9 +102,9 @@ public:
     Rank4MateType&  GetRank4MatePtr(){return _Rank4Materials;}
 
     /**
-     * Get the copy of rank-4 materials
+     * Get the read-only reference to rank-4 materials
      */
-    Rank4MateType  GetRank4Mate()const{return _Rank4Materials;}
+    const Rank4MateType& GetRank4Mate()const{return _Rank4Materials;}
 
     /**
      * This function will clean all the materials
@@ -75,5 +75,7 @@ private:
     RankTwoTensor I,Stress,StressPos,StressNeg,DevStress,GradU;
     RankTwoTensor Strain,EpsPos,EpsNeg;
     RankFourTensor I4Sym,ProjPos,ProjNeg,Jacobian;
+    double EigVal[3];
+    RankTwoTensor EigVec;
 
 };
@@ -77,5 +77,8 @@ private:
     RankTwoTensor _I,_Stress,_StressPos,_StressNeg,_DevStress,_GradU;
     RankTwoTensor _Strain;
     RankFourTensor _I4Sym,_ProjPos,_ProjNeg,_Jacobian,_Cijkl0,_Cijkl;
+    RankFourTensor _DegProj;// the degraded projection, i.e. I4Sym-(1-g-k)*ProjPos
+    double _EigVal[3];
+    RankTwoTensor _EigVec;
 
 };
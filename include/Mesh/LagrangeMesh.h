@@ -28,9 +28,13 @@
 #include<numeric>
 #include<algorithm>
 #include<fstream>
+#include<string>
+#include<cstdint>
+#include<unordered_map>
 
 #include "petsc.h"
 #include "Utils/MessagePrinter.h"
+#include "Utils/Span.h"
 
 #include "Mesh/MeshType.h"
 #include "Mesh/Nodes.h"
@@ -45,6 +49,27 @@ public:
     bool CreateLagrangeMesh();
     void SaveLagrangeMesh(string inputfilename="") const;
     //************************************************************
+    //*** for the binary mesh cache
+    //************************************************************
+    /**
+     * save the whole mesh (nodes, connectivity, physical groups and node sets) to a binary file,
+     * the hash of the source mesh file is stored to check whether the cache is outdated
+     * @param filename the binary file name
+     * @param srchash the content hash of the source mesh file
+     */
+    bool SaveLagrangeMeshToBinaryFile(const string &filename,const uint64_t &srchash)const;
+    /**
+     * read the mesh from the binary file (mmap), false will be returned if the file doesn't exist,
+     * is broken or is generated from a different source mesh file
+     * @param filename the binary file name
+     * @param srchash the content hash of the source mesh file
+     */
+    bool ReadLagrangeMeshFromBinaryFile(const string &filename,const uint64_t &srchash);
+    /**
+     * get the content hash (FNV-1a) of the given file, 0 is returned if the file can not be opened
+     */
+    static uint64_t GetFileContentHash(const string &filename);
+    //************************************************************
     //*** for the basic settings
     //************************************************************
     void SetBulkMeshDim(const int &ndim) {_nMaxDim=ndim;_nMinDim=ndim-1;}
@@ -85,7 +110,25 @@ public:
     //*** for advanced getting functions (allow value modify externally!)
     //************************************************************
     vector<double>&      GetBulkMeshNodeCoordsPtr(){return _NodeCoords;}
-    vector<vector<int>>& GetBulkMeshElmtConnPtr(){return _ElmtConn;}
+    /**
+     * allocate the flat connectivity array of all the elements, the element size must be given before the node ids are set
+     * @param elmtnodesnum the nodes number of each element(bulk+surface+line+node elements)
+     */
+    void AllocateBulkMeshElmtConn(const vector<int> &elmtnodesnum);
+    /**
+     * allocate the flat connectivity array, the first nbcelmts elements(lower dimension) have nnodesperbcelmt nodes,
+     * and the remaining ones are the bulk elements with _nNodesPerBulkElmt nodes
+     * @param nbcelmts the number of the lower dimension elements
+     * @param nnodesperbcelmt the nodes number of each lower dimension element
+     */
+    void AllocateBulkMeshElmtConn(const int &nbcelmts,const int &nnodesperbcelmt);
+    /**
+     * get the node ids of the i-th element(allow value modify externally), the array must be allocated before
+     * @param i the element id, start from 1
+     */
+    inline Span<int> GetBulkMeshIthElmtNodeIDsPtr(const int &i){
+        return Span<int>(_ElmtConn.data()+_ElmtConnOffset[i-1],_ElmtConnOffset[i]-_ElmtConnOffset[i-1]);
+    }
     vector<double>&      GetBulkMeshElmtVolumePtr(){return _ElmtVolume;}
 
     vector<int>&         GetBulkMeshElmtVTKCellTypeListPtr(){return _ElmtVTKCellTypeList;}
@@ -180,45 +223,42 @@ public:
     inline int  GetBulkMeshIthElmtVTKCellType(const int &i)const{return _ElmtVTKCellTypeList[i-1];}
     inline int  GetBulkMeshIthBulkElmtVTKCellType(const int &i)const{return _ElmtVTKCellTypeList[i+_nElmts-_nBulkElmts-1];}
     
-    inline int  GetBulkMeshIthElmtNodesNum(const int &i)const{return _ElmtConn[i-1][0];}
-    inline int  GetBulkMeshIthBulkElmtNodesNum(const int &i)const{return _ElmtConn[i+_nElmts-_nBulkElmts-1][0];}
+    inline int  GetBulkMeshIthElmtNodesNum(const int &i)const{return _ElmtConnOffset[i]-_ElmtConnOffset[i-1];}
+    inline int  GetBulkMeshIthBulkElmtNodesNum(const int &i)const{
+        return _BulkElmtConnStride>0?_BulkElmtConnStride:GetBulkMeshIthElmtNodesNum(i+_nElmts-_nBulkElmts);
+    }
     
-    inline int  GetBulkMeshIthElmtJthNodeID(const int &i,const int &j)const{return _ElmtConn[i-1][j];}
-    inline int  GetBulkMeshIthBulkElmtJthNodeID(const int &i,const int &j)const{return _ElmtConn[i+_nElmts-_nBulkElmts-1][j];}
-    inline void GetBulkMeshIthElmtNodeIDs(const int &i,vector<int> &elConn)const{
-        for(int j=1;j<=_ElmtConn[i-1][0];j++) elConn[j-1]=_ElmtConn[i-1][j];
+    inline int  GetBulkMeshIthElmtJthNodeID(const int &i,const int &j)const{return _ElmtConn[_ElmtConnOffset[i-1]+j-1];}
+    inline int  GetBulkMeshIthBulkElmtJthNodeID(const int &i,const int &j)const{return _ElmtConn[GetBulkMeshIthBulkElmtConnStart(i)+j-1];}
+    /**
+     * get the node ids of the i-th element, no copy is made
+     * @param i the element id, start from 1
+     */
+    inline Span<const int> GetBulkMeshIthElmtNodeIDs(const int &i)const{
+        return Span<const int>(_ElmtConn.data()+_ElmtConnOffset[i-1],GetBulkMeshIthElmtNodesNum(i));
     }
-    inline vector<int> GetBulkMeshIthElmtNodesID(const int &i)const{
-        vector<int> conn(_ElmtConn[i-1][0],0);
-        for(int j=1;j<=_ElmtConn[i-1][0];j++) conn[j-1]=_ElmtConn[i-1][j];
-        return conn;
+    /**
+     * get the node ids of the i-th bulk element, no copy is made
+     * @param i the bulk element id, start from 1
+     */
+    inline Span<const int> GetBulkMeshIthBulkElmtNodeIDs(const int &i)const{
+        return Span<const int>(_ElmtConn.data()+GetBulkMeshIthBulkElmtConnStart(i),GetBulkMeshIthBulkElmtNodesNum(i));
     }
-    inline int GetBulkMeshIthElmtIDViaPhyName(string phyname,const int &id)const{
-        for(const auto &it:_PhysicalName2ElmtIDsList){
-            if(it.first==phyname){
-                return it.second[id-1];
-            }
-        }
-        return -1;
+    inline void GetBulkMeshIthElmtNodeIDs(const int &i,vector<int> &elConn)const{
+        for(int j=1;j<=GetBulkMeshIthElmtNodesNum(i);j++) elConn[j-1]=GetBulkMeshIthElmtJthNodeID(i,j);
     }
-    inline int GetBulkMeshIthElmtNodesNumViaPhyName(const string phyname,const int &id)const{
-        int e;
-        for(const auto &it:_PhysicalName2ElmtIDsList){
-            if(it.first==phyname){
-                e=it.second[id-1];
-                return _ElmtConn[e-1][0];
-            }
-        }
-        return -1;
+    inline int GetBulkMeshIthElmtIDViaPhyName(const string &phyname,const int &id)const{
+        const int i=FindPhysicalNameIndex(_PhysicalName2ElmtIDsIndex,phyname);
+        return i<0?-1:_PhysicalName2ElmtIDsList[i].second[id-1];
     }
-    inline vector<int> GetBulkMeshIthElmtNodeIDs(const int &i)const{
-        vector<int> temp(_ElmtConn[i-1][0],0);
-        for(int j=1;j<=_ElmtConn[i-1][0];j++) temp[j-1]=_ElmtConn[i-1][j];
-        return temp;
+    inline int GetBulkMeshIthElmtNodesNumViaPhyName(const string &phyname,const int &id)const{
+        const int i=FindPhysicalNameIndex(_PhysicalName2ElmtIDsIndex,phyname);
+        return i<0?-1:GetBulkMeshIthElmtNodesNum(_PhysicalName2ElmtIDsList[i].second[id-1]);
     }
     inline void GetBulkMeshIthBulkElmtConn(const int &e,vector<int> &conn)const{
-        for(int i=1;i<=GetBulkMeshIthBulkElmtNodesNum(e);i++){
-            conn[i-1]=GetBulkMeshIthBulkElmtJthNodeID(e,i);
+        const int *elConn=_ElmtConn.data()+GetBulkMeshIthBulkElmtConnStart(e);
+        for(int i=0;i<GetBulkMeshIthBulkElmtNodesNum(e);i++){
+            conn[i]=elConn[i];
         }
     }
     //*** for physical group information
@@ -227,77 +267,47 @@ public:
     inline int GetBulkMeshIthPhysicalID(const int &i)const{return _PhysicalGroupIDList[i-1];}
     inline int GetBulkMeshIthPhysicalDim(const int &i)const{return _PhysicalGroupDimList[i-1];}
     inline string GetBulkMeshIthPhysicalName(const int &i)const{return _PhysicalGroupNameList[i-1];}
-    inline int GetBulkMeshDimViaPhyName(string phyname)const{
-        for(int i=0;i<static_cast<int>(_PhysicalGroupNameList.size());i++){
-            if(_PhysicalGroupNameList[i]==phyname){
-                return _PhysicalGroupDimList[i];
-            }
-        }
-        return -1;
+    inline int GetBulkMeshDimViaPhyName(const string &phyname)const{
+        const int i=FindPhysicalNameIndex(_PhysicalGroupNameIndex,phyname);
+        return i<0?-1:_PhysicalGroupDimList[i];
     }
     inline string GetBulkMeshPhysicalNameViaPhyID(const int &phyid)const{
-        for(const auto &it:_PhysicalGroupID2NameList){
-            if(it.first==phyid){
-                return it.second;
-            }
-        }
-        return "";
+        auto it=_PhysicalID2NameIndex.find(phyid);
+        return it==_PhysicalID2NameIndex.end()?"":_PhysicalGroupID2NameList[it->second].second;
     }
-    inline int GetBulkMeshPhysicalIDViaName(string phyname)const{
-        for(const auto &it:_PhysicalGroupName2IDList){
-            if(it.first==phyname){
-                return it.second;
-            }
-        }
-        return -1;
+    inline int GetBulkMeshPhysicalIDViaName(const string &phyname)const{
+        const int i=FindPhysicalNameIndex(_PhysicalName2IDIndex,phyname);
+        return i<0?-1:_PhysicalGroupName2IDList[i].second;
     }
-    inline int GetBulkMeshNodesNumPerElmtViaPhysicalName(string phyname)const{
-        for(const auto &it:_PhysicalGroupName2NodesNumPerElmtList){
-            if(it.first==phyname){
-                return it.second;
-            }
-        }
-        return -1;
+    inline int GetBulkMeshNodesNumPerElmtViaPhysicalName(const string &phyname)const{
+        const int i=FindPhysicalNameIndex(_PhysicalName2NodesNumPerElmtIndex,phyname);
+        return i<0?-1:_PhysicalGroupName2NodesNumPerElmtList[i].second;
     }
-    inline vector<int> GetBulkMeshElmtIDsViaPhysicalName(string phyname)const{
-        for(const auto &it:_PhysicalName2ElmtIDsList){
-            if(it.first==phyname){
-                return it.second;
-            }
-        }
-        return vector<int>(0);
+    /**
+     * get the element ids of the given physical group, no copy is made, an empty list is returned if the name doesn't exist
+     * @param phyname the name of the physical group
+     */
+    inline const vector<int>& GetBulkMeshElmtIDsViaPhysicalName(const string &phyname)const{
+        const int i=FindPhysicalNameIndex(_PhysicalName2ElmtIDsIndex,phyname);
+        return i<0?_EmptyIDList:_PhysicalName2ElmtIDsList[i].second;
     }
-    inline int GetBulkMeshElmtsNumViaPhysicalName(string phyname)const{
-        for(const auto &it:_PhysicalName2ElmtIDsList){
-            if(it.first==phyname){
-                return static_cast<int>(it.second.size());
-            }
-        }
-        return 0;
+    inline int GetBulkMeshElmtsNumViaPhysicalName(const string &phyname)const{
+        return static_cast<int>(GetBulkMeshElmtIDsViaPhysicalName(phyname).size());
     }
-    inline vector<int> GetBulkMeshNodeIDsViaPhysicalName(string phyname)const{
-        for(const auto &it:_NodeSetPhysicalName2NodeIDsList){
-            if(it.first==phyname){
-                return it.second;
-            }
-        }
-        return vector<int>(0);
+    /**
+     * get the node ids of the given node set, no copy is made, an empty list is returned if the name doesn't exist
+     * @param phyname the name of the node set
+     */
+    inline const vector<int>& GetBulkMeshNodeIDsViaPhysicalName(const string &phyname)const{
+        const int i=FindPhysicalNameIndex(_NodeSetPhysicalName2NodeIDsIndex,phyname);
+        return i<0?_EmptyIDList:_NodeSetPhysicalName2NodeIDsList[i].second;
     }
-    inline int GetBulkMeshNodeIDsNumViaPhysicalName(string phyname)const{
-        for(const auto &it:_NodeSetPhysicalName2NodeIDsList){
-            if(it.first==phyname){
-                return static_cast<int>(it.second.size());
-            }
-        }
-        return 0;
+    inline int GetBulkMeshNodeIDsNumViaPhysicalName(const string &phyname)const{
+        return static_cast<int>(GetBulkMeshNodeIDsViaPhysicalName(phyname).size());
     }
-    inline int GetBulkMeshIthNodeIDViaPhyName(const string phyname,const int &id)const{
-        for(const auto &it:_NodeSetPhysicalName2NodeIDsList){
-            if(it.first==phyname){
-                return it.second[id-1];
-            }
-        }
-        return -1;
+    inline int GetBulkMeshIthNodeIDViaPhyName(const string &phyname,const int &id)const{
+        const int i=FindPhysicalNameIndex(_NodeSetPhysicalName2NodeIDsIndex,phyname);
+        return i<0?-1:_NodeSetPhysicalName2NodeIDsList[i].second[id-1];
     }
     inline int GetBulkMeshIthNodeSetPhysicalID(const int &i)const{
         return _NodeSetPhysicalGroupIDList[i-1];
@@ -313,7 +323,36 @@ public:
     void PrintBulkMeshInfo()const;
     void PrintBulkMeshInfoDetails()const;
 
+    /**
+     * build the hash index (name->position) of all the physical group lists, it must be called once the physical
+     * groups are generated or imported, then all the '...ViaPhyName' functions are O(1) instead of the linear search
+     */
+    void UpdateBulkMeshPhysicalGroupIndex();
+
+    /**
+     * get the memory usage(in bytes) of the mesh on the current rank, the whole mesh is stored on each rank
+     */
+    double GetBulkMeshMemoryUsage()const;
+
 private:
+    /**
+     * get the position of the physical name in the related list, -1 is returned if the name doesn't exist
+     */
+    static inline int FindPhysicalNameIndex(const unordered_map<string,int> &index,const string &phyname){
+        auto it=index.find(phyname);
+        return it==index.end()?-1:it->second;
+    }
+    /**
+     * get the start position of the i-th bulk element in the flat connectivity array
+     */
+    inline int GetBulkMeshIthBulkElmtConnStart(const int &i)const{
+        return _BulkElmtConnStride>0?_BulkElmtConnOffset+(i-1)*_BulkElmtConnStride:_ElmtConnOffset[i+_nElmts-_nBulkElmts-1];
+    }
+    /**
+     * check whether all the bulk elements have the same nodes number, if so, the fixed stride is used for the bulk elements
+     */
+    void UpdateBulkMeshElmtConnStride();
+
     bool Create1DLagrangeMesh();
     bool Create2DLagrangeMesh();
     bool Create3DLagrangeMesh();
@@ -332,7 +371,10 @@ protected:
     int _nOrder;
     MeshType _BulkMeshType,_SurfaceMeshType,_LineMeshType;
     vector<double>      _NodeCoords;// store all the nodes/controlpts' coordinate
-    vector<vector<int>> _ElmtConn;  // store all the element(bulk+surface+line+node elements)
+    vector<int>         _ElmtConn;  // store all the element(bulk+surface+line+node elements) in one flat array
+    vector<int>         _ElmtConnOffset;// the i-th element's nodes are in [_ElmtConnOffset[i-1],_ElmtConnOffset[i])
+    int                 _BulkElmtConnStride=0;// the nodes number of all the bulk elements, 0 for the mixed mesh
+    int                 _BulkElmtConnOffset=0;// the start position of the first bulk element
     vector<double>      _ElmtVolume;// it could be: volume(3D), area(2D) or length(1D)
 
     vector<int>         _ElmtVTKCellTypeList;
@@ -362,5 +404,13 @@ protected:
     vector<pair<int,string>>         _NodeSetPhysicalGroupID2NameList;
     vector<pair<string,int>>         _NodeSetPhysicalGroupName2IDList;
     vector<pair<string,vector<int>>> _NodeSetPhysicalName2NodeIDsList;
+    //*** the hash index of the lists above(name->position in the list), see UpdateBulkMeshPhysicalGroupIndex
+    unordered_map<string,int>        _PhysicalGroupNameIndex;
+    unordered_map<int,int>           _PhysicalID2NameIndex;
+    unordered_map<string,int>        _PhysicalName2IDIndex;
+    unordered_map<string,int>        _PhysicalName2NodesNumPerElmtIndex;
+    unordered_map<string,int>        _PhysicalName2ElmtIDsIndex;
+    unordered_map<string,int>        _NodeSetPhysicalName2NodeIDsIndex;
+    vector<int>                      _EmptyIDList;
 
 };
\ No newline at end of file
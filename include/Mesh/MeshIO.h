@@ -36,6 +36,11 @@ public:
     virtual bool ReadMeshFromFile(Mesh &mesh) override;
     virtual void SetMeshFileName(string filename) override;
     virtual string GetMeshFileName()const override;
+    /**
+     * read the mesh from the binary cache file if it is valid, otherwise, the mesh
+     * file is parsed and the cache is (re)generated for the next run
+     */
+    bool ReadMeshFromFileWithCache(Mesh &mesh);
 
 private:
     MeshIOType _MeshIOType=MeshIOType::GMSH2;
@@ -149,6 +149,18 @@ public:
      * Print the basic information of nonlinearsolver
      */
     void PrintInfo()const;
+
+    /**
+     * Get the memory usage(in bytes) of the factorized matrix of the preconditioner on the current rank,
+     * 0 is returned before the first solve or if the preconditioner has no factorization
+     */
+    double GetFactorMemoryUsage()const;
+    /**
+     * Estimate the memory usage(in bytes) of the factorized matrix before any solve, the default fill
+     * ratio of PETSc is used, i.e. 5 for LU and 1 for ILU(0)
+     * @param A the assembled or preallocated system matrix
+     */
+    double EstimateFactorMemoryUsage(const Mat &A)const;
 private:
     //*********************************************
     //*** For nonlinear solver information
@@ -173,6 +185,7 @@ private:
     SNES _snes;
     SNESLineSearch _sneslinesearch;
     SNESConvergedReason _snesreason;
+    bool _HasFactor=false;// true once the preconditioner is set up by SNESSolve
     AppCtx _appctx;
     MonitorCtx _monctx;
 
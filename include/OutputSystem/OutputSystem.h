@@ -62,8 +62,19 @@ public:
     void WritePVDFileHeader();
     void WritePVDFileEnd();
     void WriteResultToPVDFile(const double &timestep,string resultfilename);
+    /**
+     * For restart, reuse the existing pvd file and remove the records whose time is larger than t
+     */
+    void ReopenPVDFile(const double &t);
 
     void PrintInfo()const;
+
+    /**
+     * get the memory usage(in bytes) of the output buffers on the current rank, the solution and the projection
+     * vectors are gathered to each rank(with the scatter context) while the result file is written
+     * @param solutionSystem the solution system class
+     */
+    double GetMemoryUsage(const SolutionSystem &solutionSystem)const;
     
 private:
     void WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem);
@@ -85,9 +96,8 @@ private:
     //****************************************
     //*** for PETSc vec
     //****************************************
-    Vec _Useq,_ProjSeq,_ProjScalarSeq,_ProjVectorSeq,_ProjRank2Seq,_ProjRank4Seq;
-    VecScatter _scatterU,_scatterProj,_scatterProjScalar;
-    VecScatter _scatterProjVector,_scatterProjRank2,_scatterProjRank4;
+    Vec _Useq,_ProjSeq;
+    VecScatter _scatterU,_scatterProj;
     PetscMPIInt _rank;
 
 private:
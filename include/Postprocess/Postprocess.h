@@ -21,6 +21,7 @@
 #include <iomanip>
 #include <string>
 #include <vector>
+#include <algorithm>
 
 #include "Postprocess/PostprocessBlock.h"
 
@@ -42,31 +43,93 @@ public:
     inline int GetOutputIntervalNum()const{return _OutputInterval;}
     void AddPostprocessBlock(PostprocessBlock &postprocessblock);
 
-    void InitPPSOutput();
+    void InitPPSOutput(const bool &isrestart=false);
+    /**
+     * For restart, remove the records of the csv file whose time is larger than t
+     */
+    void RemovePPSOutputAfter(const double &t);
+    /**
+     * run all the postprocessors, the solution is scattered once for all the blocks, each rank only integrates
+     * its own elements, and the values of all the blocks are summed up by one MPI_Allreduce
+     */
     void RunPostprocess(const double &time,const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem);
 
     void CheckWhetherPPSIsValid(const Mesh &mesh);
+    /**
+     * Check whether any postprocessor reads the projected quantities
+     */
+    bool IsProjectionRequired()const;
 
     void PrintPostprocessInfo()const;
 
+    /**
+     * release the PETSc scatters and the sequential vectors
+     */
+    void ReleaseMem();
+
 
 private:
+    /**
+     * run all the postprocess blocks of current rank, the values are stored in _PPSValues
+     */
+    void RunPPSBlocks(const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem);
+    /**
+     * scatter the solution and the projected quantities(only if they are required) to the sequential vectors,
+     * only the entries read by current rank are scattered, the scatter contexts are created in the first call
+     * and reused later, since the elements/nodes of each block never change
+     */
+    void ScatterPPSSolution(const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem,
+                            const bool &IsSolutionRequired,const bool &IsProjRequired);
+    /**
+     * get the solution of the global dof index(start from 0), it must be scattered by ScatterPPSSolution,
+     * in the collecting pass, the index is recorded and 0 is returned
+     */
+    inline double GetPPSSolutionValue(const PetscInt &iInd){
+        if(_IsCollectingIndices){
+            _UIndices.push_back(iInd);
+            return 0.0;
+        }
+        return _Useqvals[lower_bound(_UIndices.begin(),_UIndices.end(),iInd)-_UIndices.begin()];
+    }
+    /**
+     * get the projected quantity of the global index(start from 0), see GetPPSSolutionValue
+     */
+    inline double GetPPSProjValue(const PetscInt &iInd){
+        if(_IsCollectingIndices){
+            _ProjIndices.push_back(iInd);
+            return 0.0;
+        }
+        return _ProjSeqvals[lower_bound(_ProjIndices.begin(),_ProjIndices.end(),iInd)-_ProjIndices.begin()];
+    }
+    /**
+     * get the rank-local range [iStart,iEnd) of n items, it is the same contiguous split as the bulk assembly
+     * @param n the total number of the items
+     * @param iStart the start index(start from 0)
+     * @param iEnd the end index(not included)
+     */
+    inline void GetRankLocalRange(const int &n,int &iStart,int &iEnd)const{
+        int rankn=n/_size;
+        iStart=_rank*rankn;
+        iEnd=(_rank+1)*rankn;
+        if(_rank==_size-1) iEnd=n;
+    }
+
     //******************************************************
     //*** for node pps
     //******************************************************
     double NodeValuePostProcess(const int &nodeid,string variablename,
-                                const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem);
+                                const Mesh &mesh,const DofHandler &dofHandler);
 
     //******************************************************
     //*** for element pps
     //******************************************************
     double ElementValuePostProcess(const int &elmtid,string variablename,
-                                   const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem);
+                                   const Mesh &mesh,const DofHandler &dofHandler);
     //****************************************************************
     //*** do the elemental integration over specific domain name
     //****************************************************************
     double ElementalIntegralPostProcess(vector<string> domainnamelist,string variablename,
-                                        const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem);
+                                        const Mesh &mesh,const DofHandler &dofHandler,FE &fe);
 
     double AreaPostProcess(vector<string> sidenamelist,const Mesh &mesh,FE &fe);
     double VolumePostProcess(vector<string> domainnamelist,const Mesh &mesh,FE &fe);
@@ -76,7 +139,7 @@ private:
     //*** DoFs
     //****************************************************************
     double SideIntegralPostProcess(vector<string> sidenamelist,string dofname,
-                                   const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem);
+                                   const Mesh &mesh,const DofHandler &dofHandler,FE &fe);
     //****************************************************************
     //*** do the side integration over specific side-set name for
     //*** projected variable
@@ -104,8 +167,13 @@ private:
     //*************************************************
     //*** for PETSc
     //*************************************************
-    PetscMPIInt _rank;
+    PetscMPIInt _rank,_size;
+    bool _IsUScatterCreated,_IsProjScatterCreated;
     VecScatter _scatteru,_scatterproj;
     Vec _Useq,_ProjSeq;
+    PetscInt _UStart,_UEnd;/**< the ownership range of the solution vector on current rank >*/
+    const PetscScalar *_Useqvals,*_ProjSeqvals;
+    bool _IsCollectingIndices;/**< if true, the postprocessors only record the indices they read >*/
+    vector<PetscInt> _UIndices,_ProjIndices;/**< the sorted global indices read by current rank >*/
 
 };
\ No newline at end of file
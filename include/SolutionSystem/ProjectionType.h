@@ -0,0 +1,22 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.20
+//+++ Purpose: Define the type of the L2 projection from gauss
+//+++          point to nodal point, i.e. the lumped mass (diagonal
+//+++          scaling) or the consistent mass (linear solve)
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+enum class ProjectionType{
+    LUMPED,
+    CONSISTENT
+};
@@ -18,12 +18,14 @@
 
 #include <iostream>
 #include <iomanip>
+#include <fstream>
 #include <string>
 #include <vector>
 
 #include "petsc.h"
 
 #include "MateSystem/MateNameDefine.h"
+#include "SolutionSystem/ProjectionType.h"
 
 #include "Utils/MessagePrinter.h"
 
@@ -62,6 +64,7 @@ public:
     void SetHistNumPerGPoint(const int &nhist){_nHistPerGPoint=nhist;}
     void SetProjNumPerNode(const int &nproj){_nProjPerNode=nproj;}
     void SetProjectionStatus(bool flag){_IsProjection=flag;}
+    void SetProjectionType(const ProjectionType &type){_ProjectionType=type;}
 
     //**************************************
     //*** Basic get funs
@@ -136,12 +139,62 @@ public:
     }
     inline vector<string> GetRank4MateNameVec()const{return _Rank4MateProjectionNameList;}
     //**********************************************
+    //*** for the layout of the packed projection vector,
+    //*** the offsets are the ones inside each nodal block
+    //**********************************************
+    inline int GetProjBlockSize()const{return _nProjBlockSize;}
+    inline int GetProjVariableOffset()const{return 0;}
+    inline int GetScalarMateProjOffset()const{return GetProjVariableOffset()+_nProjPerNode;}
+    inline int GetVectorMateProjOffset()const{return GetScalarMateProjOffset()+_nScalarProjPerNode;}
+    inline int GetRank2MateProjOffset()const{return GetVectorMateProjOffset()+3*_nVectorProjPerNode;}
+    inline int GetRank4MateProjOffset()const{return GetRank2MateProjOffset()+9*_nRank2ProjPerNode;}
+    //**********************************************
+    bool IsInit()const{return _IsInit;}
     bool IsProjection()const{return _IsProjection;}
+    inline ProjectionType GetProjectionType()const{return _ProjectionType;}
+    /**
+     * the projected quantities are cached until the solution or the history variables are changed
+     */
+    bool IsProjectionUpToDate()const{return _IsProjectionUpToDate;}
+    void MarkProjectionUpdated(){_IsProjectionUpToDate=true;}
+    void MarkProjectionOutdated(){_IsProjectionUpToDate=false;}
 
     void UpdateMaterials();
 
+    //**************************************
+    //*** for checkpoint/restart
+    //**************************************
+    /**
+     * Write U, Uold, V and Vold to a PETSc binary file (parallel, collective call)
+     */
+    void WriteSolutionToBinaryFile(const string &filename)const;
+    /**
+     * Read U, Uold, V and Vold from a PETSc binary file written by WriteSolutionToBinaryFile
+     */
+    void ReadSolutionFromBinaryFile(const string &filename);
+    /**
+     * Write the gauss point material history (current and old) of the local rank to a binary stream
+     */
+    void WriteMaterialsToBinaryFile(ofstream &out)const;
+    /**
+     * Read the gauss point material history (current and old) from a binary stream, return false if the size doesn't match
+     */
+    bool ReadMaterialsFromBinaryFile(ifstream &in);
+
     void PrintProjectionInfo()const;
 
+    //**************************************
+    //*** for memory usage(in bytes) on the current rank
+    //**************************************
+    /**
+     * the local part of all the solution vectors and the projection vector
+     */
+    double GetVecMemoryUsage()const;
+    /**
+     * the current and old material properties on all the gauss points
+     */
+    double GetMaterialsMemoryUsage()const;
+
     void ReleaseMem();
 
 public:
@@ -149,8 +202,7 @@ public:
     Vec _Utemp;
     Vec _Uold,_Vold;
 
-    Vec _Proj;// this is used for projection quantities in each element
-    Vec _ProjScalarMate,_ProjVectorMate,_ProjRank2Mate,_ProjRank4Mate;// this is used for the material properties
+    Vec _Proj;// the blocked vector for all the projected quantities (variables and materials) on each node
 
     // store all the material properties on each gauss point
     // this is different from the ProjMaterials, the ProjMaterials
@@ -164,12 +216,14 @@ public:
 
 private:
     bool _IsInit=false,_IsProjection=false;
+    bool _IsProjectionUpToDate=false;
+    ProjectionType _ProjectionType=ProjectionType::LUMPED;
     vector<string> _DofNameList;
     vector<string> _ProjectionNameList;
     vector<string> _ScalarMateProjectionNameList,_VectorMateProjctionNameList;
     vector<string> _Rank2MateProjectionNameList,_Rank4MateProjectionNameList;
 
-    int _nHistPerGPoint,_nProjPerNode;
+    int _nHistPerGPoint,_nProjPerNode,_nProjBlockSize;
     int _nScalarProjPerNode,_nVectorProjPerNode,_nRank2ProjPerNode,_nRank4ProjPerNode;
     int _nGPointsPerBulkElmt;
     int _nDofs,_nNodes,_nElmts;
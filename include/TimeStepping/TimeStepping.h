@@ -17,6 +17,7 @@
 
 #include <iostream>
 #include <string>
+#include <deque>
 
 #include "Utils/MessagePrinter.h"
 
@@ -44,6 +45,7 @@
 #include "TimeStepping/TimeSteppingType.h"
 
 #include "FEProblem/FEControlInfo.h"
+#include "FEProblem/MemoryReport.h"
 
 using namespace std;
 
@@ -70,6 +72,19 @@ public:
      */
     bool IsAdaptive()const{return _Adaptive;}
 
+    /**
+     * Set the prefix of the checkpoint files, normally it is the input file name without '.i'
+     */
+    void SetCheckPointFilePrefix(string prefix){_CheckPointFilePrefix=prefix;}
+    /**
+     * Set the checkpoint file we restart from, the IC will not be applied for this case
+     */
+    void SetRestartFileName(string filename){_RestartFileName=filename;_IsRestart=true;}
+    /**
+     * Check whether the current simulation is restarted from a checkpoint
+     */
+    bool IsRestart()const{return _IsRestart;}
+
     /**
      * Do the time stepping until the maximum step is arrived
      */
@@ -87,6 +102,34 @@ public:
      * Print out the basic information of time stepping class to your terminal
      */
     void PrintTimeSteppingInfo()const;
+private:
+    /**
+     * Write the solution, the material history and the time stepping state to the checkpoint files
+     */
+    void WriteCheckPoint(SolutionSystem &solutionSystem,const FEControlInfo &fectrlinfo);
+    /**
+     * Restore the solution, the material history and the time stepping state from the checkpoint files
+     */
+    void ReadCheckPoint(SolutionSystem &solutionSystem,FEControlInfo &fectrlinfo);
+    /**
+     * Put the existing checkpoint files of the previous run back to the list, so they are removed after _CheckPointKeep new ones are written
+     * @param step the step of the restart checkpoint
+     */
+    void SeedCheckPointFileList(const int &step);
+    /**
+     * Get the checkpoint file name of the given step
+     */
+    string GetCheckPointFileName(const int &step)const{
+        char buff[30];
+        snprintf(buff,30,"-chk-%08d.bin",step);
+        return _CheckPointFilePrefix+string(buff);
+    }
+    /**
+     * Get the per-rank history file name of the given checkpoint file
+     */
+    string GetCheckPointHistFileName(const string &filename,const int &rank)const{
+        return filename+".hist"+to_string(rank);
+    }
 private:
     //*****************************************************************
     //*** basic variables for time stepping
@@ -103,4 +146,13 @@ private:
     double _DtMin,_DtMax;
     int _IterHist[2];
 
+    //*****************************************************************
+    //*** for checkpoint/restart
+    //*****************************************************************
+    int _CheckPointInterval=0,_CheckPointKeep=2;
+    string _CheckPointFilePrefix="asfem";
+    string _RestartFileName;
+    bool _IsRestart=false;
+    deque<string> _CheckPointFileList;
+
 };
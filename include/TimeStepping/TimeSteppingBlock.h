@@ -39,6 +39,9 @@ public:
     double _DtMin=1.0e-12;
     double _DtMax=1.0e2;
 
+    int _CheckPointInterval=0;// 0 means no checkpoint file will be written
+    int _CheckPointKeep=2;// how many checkpoint files we keep on the disk
+
     void Init(){
         _TimeSteppingType=TimeSteppingType::BACKWARDEULER;
         _TimeSteppingTypeName="backward-euler";
@@ -50,5 +53,7 @@ public:
         _DtMin=1.0e-12;
         _DtMax=1.0e2;
         _FinalT=1.0e-3;
+        _CheckPointInterval=0;
+        _CheckPointKeep=2;
     }
 };
\ No newline at end of file
@@ -0,0 +1,80 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.29
+//+++ Purpose: Define the read-only memory view of a whole file,
+//+++          it is shared by the binary mesh cache and the mesh
+//+++          file importers
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <fstream>
+
+#if defined(_WIN32)
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/**
+ * the read-only memory view of a whole file, mmap is used on POSIX system, otherwise, the file is read into the buffer
+ */
+class MappedFile{
+public:
+    MappedFile(const string &filename){
+#if defined(_WIN32)
+        ifstream in(filename,ios::in|ios::binary|ios::ate);
+        if(!in.is_open()) return;
+        _Size=static_cast<size_t>(in.tellg());
+        _Buffer.resize(_Size);
+        in.seekg(0,ios::beg);
+        in.read(_Buffer.data(),_Size);
+        if(!in.good()) return;
+        _Data=_Buffer.data();
+#else
+        int fd=open(filename.c_str(),O_RDONLY);
+        if(fd<0) return;
+        struct stat st;
+        if(fstat(fd,&st)==0&&st.st_size>0){
+            void *ptr=mmap(nullptr,static_cast<size_t>(st.st_size),PROT_READ,MAP_PRIVATE,fd,0);
+            if(ptr!=MAP_FAILED){
+                _Data=static_cast<const char*>(ptr);
+                _Size=static_cast<size_t>(st.st_size);
+                madvise(ptr,_Size,MADV_SEQUENTIAL);
+            }
+        }
+        close(fd);
+#endif
+    }
+    ~MappedFile(){
+#if !defined(_WIN32)
+        if(_Data) munmap(const_cast<char*>(_Data),_Size);
+#endif
+    }
+    MappedFile(const MappedFile&)=delete;
+    MappedFile& operator=(const MappedFile&)=delete;
+
+    inline bool IsOpen()const{return _Data!=nullptr;}
+    inline const char* GetData()const{return _Data;}
+    inline size_t GetSize()const{return _Size;}
+private:
+    const char *_Data=nullptr;
+    size_t _Size=0;
+#if defined(_WIN32)
+    vector<char> _Buffer;
+#endif
+};
@@ -0,0 +1,145 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.15
+//+++ Purpose: Estimate the memory footprint(in bytes) of the STL
+//+++          containers and the PETSc objects, then each major
+//+++          component can report its own memory usage per rank
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <type_traits>
+
+#include "petsc.h"
+
+#include "Utils/MessagePrinter.h"
+
+using namespace std;
+
+/**
+ * the memory usage of one component on the current rank
+ */
+struct MemoryRecord{
+    string Name;
+    double Bytes;
+};
+
+/**
+ * the estimation of the memory footprint, the capacity(not the size) of the containers is counted, for
+ * the node based containers, the node overhead of the common STL implementations is used
+ */
+class MemoryUsage{
+public:
+    //***************************************************
+    //*** for the STL containers
+    //***************************************************
+    /**
+     * the heap memory owned by one element, the fixed-size types(i.e. int, double, RankTwoTensor) own nothing
+     */
+    template<class T>
+    static double HeapOf(const T &val){
+        (void)val;
+        return 0.0;
+    }
+    static double HeapOf(const string &str){return Of(str);}
+    template<class T>
+    static double HeapOf(const vector<T> &vec){return Of(vec);}
+    template<class T1,class T2>
+    static double HeapOf(const pair<T1,T2> &val){return Of(val);}
+    template<class K,class V>
+    static double HeapOf(const map<K,V> &m){return Of(m);}
+    template<class K,class V>
+    static double HeapOf(const unordered_map<K,V> &m){return Of(m);}
+
+    static double Of(const string &str){
+        // the short strings are stored inside the string object itself
+        return str.capacity()>15?static_cast<double>(str.capacity()+1):0.0;
+    }
+
+    template<class T>
+    static double Of(const vector<T> &vec){
+        double bytes=static_cast<double>(vec.capacity()*sizeof(T));
+        if constexpr(!is_trivially_copyable<T>::value){
+            for(const auto &it:vec) bytes+=HeapOf(it);
+        }
+        return bytes;
+    }
+
+    static double Of(const vector<bool> &vec){
+        return static_cast<double>(vec.capacity()/8+1);
+    }
+
+    template<class T1,class T2>
+    static double Of(const pair<T1,T2> &val){
+        return HeapOf(val.first)+HeapOf(val.second);
+    }
+
+    template<class K,class V>
+    static double Of(const map<K,V> &m){
+        // the red-black tree node has the color, parent, left and right fields
+        double bytes=static_cast<double>(m.size()*(sizeof(pair<const K,V>)+4*sizeof(void*)));
+        for(const auto &it:m) bytes+=HeapOf(it.first)+HeapOf(it.second);
+        return bytes;
+    }
+
+    template<class K,class V>
+    static double Of(const unordered_map<K,V> &m){
+        // each node has the next pointer and the cached hash value
+        double bytes=static_cast<double>(m.size()*(sizeof(pair<const K,V>)+2*sizeof(void*))
+                                        +m.bucket_count()*sizeof(void*));
+        for(const auto &it:m) bytes+=HeapOf(it.first)+HeapOf(it.second);
+        return bytes;
+    }
+
+    //***************************************************
+    //*** for the PETSc objects
+    //***************************************************
+    /**
+     * the local part of the vector(including the ghost part), 0 is returned for the null vector
+     */
+    static double Of(const Vec &v);
+    /**
+     * the allocated nonzeros(values and column indices) of the local rows, 0 is returned for the null matrix
+     */
+    static double Of(const Mat &A);
+    /**
+     * the allocated nonzeros of the local rows
+     */
+    static double GetMatNNZ(const Mat &A);
+
+    //***************************************************
+    //*** for the report
+    //***************************************************
+    /**
+     * the memory usage of the whole process(resident set size), in bytes
+     */
+    static double GetCurrentUsage();
+    /**
+     * get the max/sum value over all the ranks of each component, this is collective
+     */
+    static void ReduceRecords(const vector<MemoryRecord> &records,vector<double> &maxbytes,vector<double> &sumbytes);
+    /**
+     * print the max/sum value over all the ranks of each component
+     * @param title the title of the table
+     * @param records the memory usage of the current rank
+     * @param maxbytes the max value over all the ranks, see ReduceRecords
+     * @param sumbytes the summed value over all the ranks, see ReduceRecords
+     * @param color the color of the text
+     */
+    static void PrintReport(const string &title,const vector<MemoryRecord> &records,
+                            const vector<double> &maxbytes,const vector<double> &sumbytes,
+                            MessageColor color=MessageColor::WHITE);
+};
@@ -0,0 +1,141 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.10
+//+++ Purpose: the per-subsystem profiler based on the PETSc log
+//+++          events, each subsystem(residual, jacobian, bcs,
+//+++          projection, output ...) is registered as one event,
+//+++          the counts, time, flops and MPI messages are
+//+++          collected by PETSc, and are reported at the end of
+//+++          the simulation if '--profile' is given
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "petsc.h"
+
+#include "Utils/MessagePrinter.h"
+#include "Utils/MemoryUsage.h"
+
+using namespace std;
+
+/**
+ * the subsystems profiled by AsFem itself, the PETSc built-in events(i.e. SNESSolve, KSPSolve) are
+ * reported as well
+ */
+enum class ProfileEvent{
+    FORMRESIDUAL=0,
+    FORMJACOBIAN,
+    UPDATEMATERIAL,
+    APPLYBC,
+    PROJECTION,
+    OUTPUT,
+    POSTPROCESS,
+    CHECKPOINT
+};
+
+class Profiler{
+public:
+    /**
+     * register all the events, this must be called after PetscInitialize
+     * @param enable if true, the PETSc default logging is activated and the report will be given in Finalize
+     */
+    static void Init(const bool &enable);
+    /**
+     * return true if the profiling is active
+     */
+    inline static bool IsActive(){return _IsActive;}
+
+    inline static void Begin(const ProfileEvent &event){
+        PetscLogEventBegin(_Events[static_cast<int>(event)],0,0,0,0);
+    }
+    inline static void End(const ProfileEvent &event){
+        PetscLogEventEnd(_Events[static_cast<int>(event)],0,0,0,0);
+    }
+
+    /**
+     * print the summary table and write it to the json file, this must be called before PetscFinalize
+     * @param jsonfilename the name of the json file, nothing is written if it is empty
+     */
+    static void Finalize(const string &jsonfilename);
+
+    /**
+     * accumulate the iterations of one nonlinear solve, they are reported together with the events
+     * @param snesiters the nonlinear iterations of the current solve
+     * @param kspiters the linear iterations summed over all the nonlinear iterations
+     * @param converged false if the current solve is failed
+     */
+    inline static void AddSolverIters(const int &snesiters,const int &kspiters,const bool &converged){
+        if(!_IsActive) return;
+        _nSolves+=1;
+        _SNESIters+=snesiters;
+        _KSPIters+=kspiters;
+        if(!converged) _nFailedSolves+=1;
+    }
+
+    /**
+     * store the memory usage of all the components at one stage(i.e. 'setup', 'peak'), the previous records
+     * of the same stage are replaced, they are reported in Finalize
+     * @param stage the name of the stage
+     * @param step the time step of the records
+     * @param records the memory usage of the current rank
+     */
+    static void SetMemoryRecords(const string &stage,const int &step,const vector<MemoryRecord> &records);
+
+private:
+    /**
+     * the memory usage of all the components at one stage, the values are the local ones of the current rank
+     */
+    struct MemoryStage{
+        string Name;
+        int Step;
+        vector<MemoryRecord> Records;
+        vector<double> MaxBytes,SumBytes;// the reduced values over all the ranks, they are filled in Finalize
+    };
+    /**
+     * the statistics of one event, the time is the maximum one over all the ranks, the others are summed
+     */
+    struct ProfileRecord{
+        string Name;
+        int Count;
+        double Time,Flops,Messages,MessageLength,Reductions;
+    };
+    static void CollectRecord(const string &name,const PetscLogEvent &event,vector<ProfileRecord> &records);
+    static void PrintSummary(const vector<ProfileRecord> &records);
+    static void WriteJsonFile(const string &jsonfilename,const vector<ProfileRecord> &records);
+
+private:
+    static const int _nEvents=8;
+    static bool _IsActive;
+    static double _StartTime;
+    static long int _nSolves,_nFailedSolves,_SNESIters,_KSPIters;
+    static double _MaxPeakMemory,_SumPeakMemory;
+    static vector<MemoryStage> _MemoryStages;
+    static PetscClassId _ClassId;
+    static PetscLogEvent _Events[_nEvents];
+    static const char *_EventNames[_nEvents];
+};
+
+/**
+ * the scope guard of one profiled event, the event ends when the guard leaves its scope
+ */
+class ProfileScope{
+public:
+    explicit ProfileScope(const ProfileEvent &event):_event(event){Profiler::Begin(_event);}
+    ~ProfileScope(){Profiler::End(_event);}
+    ProfileScope(const ProfileScope&)=delete;
+    ProfileScope& operator=(const ProfileScope&)=delete;
+private:
+    ProfileEvent _event;
+};
@@ -163,20 +163,47 @@ public:
     inline RankFourTensor DoubleDot(const RankFourTensor &a) const{
         // C_ijkl=A_ijmn*B_mnkl
         RankFourTensor temp(0.0);
-        for(int i=1;i<=_N;++i){
-            for(int j=1;j<=_N;++j){
-                for(int k=1;k<=_N;++k){
-                    for(int l=1;l<=_N;++l){
-                        for(int m=1;m<=_N;++m){
-                            for(int n=1;n<=_N;++n){
-                                temp(i,j,k,l)+=(*this)(i,j,m,n)*a(m,n,k,l);
-                            }
-                        }
-                    }
-                }
+        DoubleDotInto(a,temp);
+        return temp;
+    }
+    //*** for the fused in-place operations, no temporary tensor is created
+    /**
+     * update current tensor as A=A+alpha*x
+     */
+    inline RankFourTensor& Axpy(const double &alpha,const RankFourTensor &x){
+        for(int i=0;i<_N4;++i) _vals[i]+=alpha*x._vals[i];
+        return *this;
+    }
+    /**
+     * set current tensor to alpha*x+beta*y, x or y can be current tensor itself
+     */
+    inline RankFourTensor& SetFromAxpby(const double &alpha,const RankFourTensor &x,
+                                        const double &beta,const RankFourTensor &y){
+        for(int i=0;i<_N4;++i) _vals[i]=alpha*x._vals[i]+beta*y._vals[i];
+        return *this;
+    }
+    /**
+     * update current tensor as C_ijkl=C_ijkl+alpha*a_ij*b_kl
+     */
+    RankFourTensor& AddOTimes(const double &alpha,const RankTwoTensor &a,const RankTwoTensor &b);
+    /**
+     * calculate C_ij=A_ijkl*a_kl and store it in result, result can be a itself
+     */
+    void DoubleDotInto(const RankTwoTensor &a,RankTwoTensor &result) const;
+    /**
+     * calculate C_ijkl=A_ijmn*B_mnkl and store it in result, result can be current tensor or a itself
+     */
+    inline void DoubleDotInto(const RankFourTensor &a,RankFourTensor &result) const{
+        // the rank-4 tensor is a 9x9 matrix in the (ij),(kl) index, so this is a plain matrix product
+        double temp[81];
+        for(int I=0;I<_N2;++I){
+            for(int J=0;J<_N2;++J) temp[I*_N2+J]=0.0;
+            for(int K=0;K<_N2;++K){
+                const double aik=_vals[I*_N2+K];
+                for(int J=0;J<_N2;++J) temp[I*_N2+J]+=aik*a._vals[K*_N2+J];
             }
         }
-        return temp;
+        for(int i=0;i<_N4;++i) result._vals[i]=temp[i];
     }
     //*** for rotated rank-4 tensor
     RankFourTensor Rotate(const RankTwoTensor &rotate) const;
@@ -302,7 +329,7 @@ public:
     }
 private:
     double _vals[81];
-    const int _N=3;
-    const int _N2=9;
-    const int _N4=81;
+    static constexpr int _N=3;
+    static constexpr int _N2=9;
+    static constexpr int _N4=81;
 };
@@ -342,6 +342,42 @@ public:
         (*this)=temp;
         return *this;
     }
+    //*** for the fused in-place operations, no temporary tensor is created
+    /**
+     * update current tensor as \f$\mathbf{A}=\mathbf{A}+\alpha\mathbf{x}\f$
+     * @param alpha the scalar factor
+     * @param x the rank-2 tensor to be added
+     */
+    inline RankTwoTensor& Axpy(const double &alpha,const RankTwoTensor &x){
+        for(int i=0;i<_N2;++i) _vals[i]+=alpha*x._vals[i];
+        return *this;
+    }
+    /**
+     * set current tensor to \f$\alpha\mathbf{x}+\beta\mathbf{y}\f$, x or y can be current tensor itself
+     * @param alpha the scalar factor of x
+     * @param x the 1st rank-2 tensor
+     * @param beta the scalar factor of y
+     * @param y the 2nd rank-2 tensor
+     */
+    inline RankTwoTensor& SetFromAxpby(const double &alpha,const RankTwoTensor &x,
+                                       const double &beta,const RankTwoTensor &y){
+        for(int i=0;i<_N2;++i) _vals[i]=alpha*x._vals[i]+beta*y._vals[i];
+        return *this;
+    }
+    /**
+     * set current tensor to the symmetric part of a, i.e. \f$0.5(\mathbf{a}+\mathbf{a}^{T})\f$, a can be current tensor itself
+     * @param a the rank-2 tensor, i.e. the displacement gradient
+     */
+    inline RankTwoTensor& SetFromSymmetricPart(const RankTwoTensor &a){
+        const double v12=0.5*(a._vals[1]+a._vals[3]);
+        const double v13=0.5*(a._vals[2]+a._vals[6]);
+        const double v23=0.5*(a._vals[5]+a._vals[7]);
+        _vals[0]=a._vals[0];_vals[4]=a._vals[4];_vals[8]=a._vals[8];
+        _vals[1]=v12;_vals[3]=v12;
+        _vals[2]=v13;_vals[6]=v13;
+        _vals[5]=v23;_vals[7]=v23;
+        return *this;
+    }
     //*** for cross-dot
     /**
      * cross dot \f$\otimes\f$ for two double array, set current one to \f$c_{ij}=a_{i}b_{j}\f$.
@@ -564,6 +600,20 @@ public:
      * @param eigvec the rank-2 tensor, where each column store the related eigen vector
      */
     void CalcEigenValueAndEigenVectors(double (&eigval)[3],RankTwoTensor &eigvec) const;
+    /**
+     * calculate the eigen value and eigen vector of the symmetric part of current rank-2 tensor by the jacobi
+     * iteration, the eigen values are sorted in ascending order
+     * @param eigval the double array, which stores the eigen value
+     * @param eigvec the rank-2 tensor, where each column store the related eigen vector
+     */
+    void CalcSymEigenValueAndEigenVectors(double (&eigval)[3],RankTwoTensor &eigvec) const;
+    /**
+     * fill the positive projection tensor from the given eigen values and the orthonormal eigen vectors
+     * @param eigval the double array, which stores the eigen value
+     * @param eigvec the rank-2 tensor, whoses column stores the related eigen vector
+     * @param ProjPos the positive projection tensor, all its components are overwritten
+     */
+    static void FillPositiveProjTensor(const double (&eigval)[3],const RankTwoTensor &eigvec,RankFourTensor &ProjPos);
     /**
      * calculate the positive projection tensor(a rank-4 tensor), this algorithm is taken from Miehe's paper, for the details, please see the cpp file
      * @param eigval the double array, which stores the eigen value
@@ -713,7 +763,7 @@ public:
     }
 
 private:
-    const int _N=3;
-    const int _N2=9;
+    static constexpr int _N=3;
+    static constexpr int _N2=9;
     double _vals[9];
 };
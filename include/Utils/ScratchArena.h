@@ -0,0 +1,88 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.18
+//+++ Purpose: Define the arena for the scratch arrays of the local
+//+++          element, all the arrays are carved out of one memory
+//+++          block, which is allocated once before the element loop
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "Utils/MessagePrinter.h"
+#include "Utils/Span.h"
+
+using namespace std;
+
+/**
+ * the bump allocator for the fixed-size scratch arrays, the usage is:
+ *   1) sum up the bytes of all the arrays via BytesOf, then call Reserve
+ *   2) call Allocate for each array, the returned spans are valid until the next Reserve
+ * nothing is freed one by one, so only the trivially destructible types(i.e. double, Vector3d) are allowed
+ */
+class ScratchArena{
+public:
+    ScratchArena():_capacity(0),_offset(0){}
+
+    /**
+     * the bytes needed by an array of n elements, including the padding for the alignment
+     */
+    template<class T>
+    static size_t BytesOf(const int &n){
+        return static_cast<size_t>(n)*sizeof(T)+alignof(T);
+    }
+
+    /**
+     * allocate the memory block, all the spans allocated before are invalid
+     * @param bytes the total bytes, see BytesOf
+     */
+    void Reserve(const size_t &bytes){
+        _buffer.reset(new unsigned char[bytes]);
+        _capacity=bytes;
+        _offset=0;
+    }
+
+    /**
+     * carve an array of n elements from the memory block, all the elements are set to val
+     * @param n the length of the array
+     * @param val the initial value of each element
+     */
+    template<class T>
+    Span<T> Allocate(const int &n,const T &val){
+        static_assert(is_trivially_destructible<T>::value,"only the trivially destructible types are allowed in ScratchArena");
+        size_t start=(_offset+alignof(T)-1)/alignof(T)*alignof(T);
+        if(start+n*sizeof(T)>_capacity){
+            MessagePrinter::PrintErrorTxt("the scratch arena is too small, please reserve enough memory before the allocation");
+            MessagePrinter::AsFem_Exit();
+        }
+        T *data=reinterpret_cast<T*>(_buffer.get()+start);
+        for(int i=0;i<n;i++) new(data+i) T(val);
+        _offset=start+n*sizeof(T);
+        return Span<T>(data,n);
+    }
+
+    /**
+     * the total bytes of the memory block
+     */
+    inline size_t GetCapacity()const{return _capacity;}
+    /**
+     * the bytes which are already allocated
+     */
+    inline size_t GetUsedBytes()const{return _offset;}
+
+private:
+    unique_ptr<unsigned char[]> _buffer;
+    size_t _capacity,_offset;
+};
@@ -0,0 +1,68 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.26
+//+++ Purpose: Define the non-owning view of a continuous array,
+//+++          which is used to access one row of the flat(CSR)
+//+++          storage, i.e., the connectivity of one element,
+//+++          without any copy
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <type_traits>
+
+using namespace std;
+
+/**
+ * the light weight view of a continuous array, the memory is owned by others(i.e. std::vector),
+ * so the span is only valid as long as the original array is not resized
+ */
+template<class T>
+class Span{
+public:
+    Span():_data(nullptr),_size(0){}
+    Span(T *data,const int &size):_data(data),_size(size){}
+    /**
+     * the read-only view of a writable one, i.e. Span<double> to Span<const double>
+     */
+    template<class U,class=typename enable_if<is_convertible<U*,T*>::value>::type>
+    Span(const Span<U> &other):_data(other.data()),_size(other.size()){}
+
+    /**
+     * get the length of the span
+     */
+    inline int size()const{return _size;}
+    /**
+     * check whether the span is empty
+     */
+    inline bool empty()const{return _size==0;}
+    /**
+     * get the pointer of the first element
+     */
+    inline T* data()const{return _data;}
+    inline T* begin()const{return _data;}
+    inline T* end()const{return _data+_size;}
+
+    /**
+     * [] operator for the element access, the index starts from 0, the same as std::vector
+     * @param i the index of the element
+     */
+    inline T& operator[](const int &i)const{return _data[i];}
+    /**
+     * () operator for the element access, the index starts from 1, the same as the other AsFem containers
+     * @param i the index of the element
+     */
+    inline T& operator()(const int &i)const{return _data[i-1];}
+
+private:
+    T *_data;
+    int _size;
+};
@@ -0,0 +1,218 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.06
+//+++ Purpose: Implement the minor-symmetric rank-4 tensor, i.e.
+//+++          C_ijkl=C_jikl=C_ijlk, which is stored as a 6x6
+//+++          matrix in Mandel notation, the Voigt order
+//+++          (11,22,33,23,13,12) is used, the shear components
+//+++          are scaled by sqrt(2), so the double dot becomes
+//+++          the matrix product
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#pragma once
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+
+#include "petsc.h"
+
+//****************************
+#include "Utils/MessagePrinter.h"
+#include "Utils/Vector3d.h"
+#include "Utils/RankTwoTensor.h"
+#include "Utils/RankFourTensor.h"
+
+using namespace std;
+
+class SymmetricRankFourTensor{
+public:
+    SymmetricRankFourTensor();
+    SymmetricRankFourTensor(const double &val);
+    SymmetricRankFourTensor(const SymmetricRankFourTensor &a);
+    /**
+     * the explicit conversion from the general rank-4 tensor, the minor symmetric part is taken
+     * @param a the general rank-4 tensor
+     */
+    explicit SymmetricRankFourTensor(const RankFourTensor &a);
+    /**
+     * the explicit conversion to the general rank-4 tensor, i.e. the one stored in Rank4Materials
+     */
+    RankFourTensor ToRankFourTensor()const;
+
+    //********************************************
+    //*** For the index map
+    //********************************************
+    /**
+     * get the Mandel index(1~6) of the rank-2 index pair
+     * @param i i index, start from 1
+     * @param j j index, start from 1
+     */
+    inline static int MandelIndex(const int &i,const int &j){
+        const static int map[3][3]={{1,6,5},{6,2,4},{5,4,3}};
+        return map[i-1][j-1];
+    }
+    /**
+     * the scale factor of the I-th Mandel component, 1 for the normal ones and sqrt(2) for the shear ones
+     */
+    inline static double MandelWeight(const int &I){
+        return (I<=3)?1.0:M_SQRT2;
+    }
+
+    //********************************************
+    //*** For operator overload
+    //********************************************
+    /**
+     * get the C_ijkl component, all the index start from 1
+     */
+    inline double operator()(const int &i,const int &j,const int &k,const int &l) const{
+        if(i<1||i>3 || j<1||j>3 || k<1||k>3 || l<1||l>3){
+            MessagePrinter::PrintErrorTxt("your i or j or k or l is out of range when you call a symmetric rank-4 tensor");
+            MessagePrinter::AsFem_Exit();
+        }
+        const int I=MandelIndex(i,j),J=MandelIndex(k,l);
+        return _vals[(I-1)*6+J-1]/(MandelWeight(I)*MandelWeight(J));
+    }
+    /**
+     * the access to the Mandel matrix, both I and J start from 1 and end with 6
+     */
+    inline double MandelIJ(const int &I,const int &J) const{
+        return _vals[(I-1)*6+J-1];
+    }
+    inline double& MandelIJ(const int &I,const int &J){
+        return _vals[(I-1)*6+J-1];
+    }
+    inline double  operator[](const int &i) const{
+        return _vals[i-1];
+    }
+    inline double& operator[](const int &i){
+        return _vals[i-1];
+    }
+    /**
+     * function to get K_ik=C_ijkl*N,j*N,l, where j is the index of test fun and l is the one of trial fun
+     */
+    double GetIKjlComponent(const int &i,const int &k,
+                            const Vector3d &grad_test,
+                            const Vector3d &grad_trial)const;
+
+    inline SymmetricRankFourTensor& operator=(const double &a){
+        for(int i=0;i<_N;++i) _vals[i]=a;
+        return *this;
+    }
+    inline SymmetricRankFourTensor& operator=(const SymmetricRankFourTensor &a){
+        for(int i=0;i<_N;++i) _vals[i]=a._vals[i];
+        return *this;
+    }
+    inline SymmetricRankFourTensor operator+(const SymmetricRankFourTensor &a) const{
+        SymmetricRankFourTensor temp(0.0);
+        for(int i=0;i<_N;++i) temp._vals[i]=_vals[i]+a._vals[i];
+        return temp;
+    }
+    inline SymmetricRankFourTensor& operator+=(const SymmetricRankFourTensor &a){
+        for(int i=0;i<_N;++i) _vals[i]+=a._vals[i];
+        return *this;
+    }
+    inline SymmetricRankFourTensor operator-(const SymmetricRankFourTensor &a) const{
+        SymmetricRankFourTensor temp(0.0);
+        for(int i=0;i<_N;++i) temp._vals[i]=_vals[i]-a._vals[i];
+        return temp;
+    }
+    inline SymmetricRankFourTensor& operator-=(const SymmetricRankFourTensor &a){
+        for(int i=0;i<_N;++i) _vals[i]-=a._vals[i];
+        return *this;
+    }
+    inline SymmetricRankFourTensor operator*(const double &a) const{
+        SymmetricRankFourTensor temp(0.0);
+        for(int i=0;i<_N;++i) temp._vals[i]=_vals[i]*a;
+        return temp;
+    }
+    inline SymmetricRankFourTensor& operator*=(const double &a){
+        for(int i=0;i<_N;++i) _vals[i]*=a;
+        return *this;
+    }
+    friend SymmetricRankFourTensor operator*(const double &lhs,const SymmetricRankFourTensor &a);
+    /**
+     * update current tensor as A=A+alpha*x
+     */
+    inline SymmetricRankFourTensor& Axpy(const double &alpha,const SymmetricRankFourTensor &x){
+        for(int i=0;i<_N;++i) _vals[i]+=alpha*x._vals[i];
+        return *this;
+    }
+    /**
+     * set current tensor to alpha*x+beta*y, x or y can be current tensor itself
+     */
+    inline SymmetricRankFourTensor& SetFromAxpby(const double &alpha,const SymmetricRankFourTensor &x,
+                                                 const double &beta,const SymmetricRankFourTensor &y){
+        for(int i=0;i<_N;++i) _vals[i]=alpha*x._vals[i]+beta*y._vals[i];
+        return *this;
+    }
+
+    //********************************************
+    //*** For the tensor operations
+    //********************************************
+    /**
+     * the double dot with a rank-2 tensor, i.e. C_ijkl*a_kl, only the symmetric part of a is involved
+     */
+    RankTwoTensor DoubleDot(const RankTwoTensor &a) const;
+    /**
+     * the double dot with another symmetric rank-4 tensor, i.e. C_ijmn*a_mnkl
+     */
+    SymmetricRankFourTensor DoubleDot(const SymmetricRankFourTensor &a) const;
+    /**
+     * rotate current tensor, i.e. C_ijkl=C_mnpq*R_im*R_jn*R_kp*R_lq
+     * @param rotate the rotation tensor
+     */
+    SymmetricRankFourTensor Rotate(const RankTwoTensor &rotate) const;
+    /**
+     * return true if C_ijkl=C_klij(within the given tolerance)
+     */
+    bool IsMajorSymmetric(const double &tol=1.0e-12)const;
+
+    //********************************************
+    //*** For the fill-in functions
+    //********************************************
+    inline void SetToZeros(){
+        for(int i=0;i<_N;++i) _vals[i]=0.0;
+    }
+    /**
+     * set to the symmetric identity, i.e. 0.5*(de_ik*de_jl+de_il*de_jk), which is the 6x6 identity matrix
+     */
+    inline void SetToIdentitySymmetric4(){
+        SetToZeros();
+        for(int I=1;I<=6;++I) MandelIJ(I,I)=1.0;
+    }
+    /**
+     * set current tensor to a x b, where a and b are symmetric rank-2 tensors
+     */
+    void SetFromOTimes(const RankTwoTensor &a,const RankTwoTensor &b);
+    void SetFromLameandG(const double &Lame,const double &G);
+    void SetFromEandNu(const double &E,const double &Nu);
+    void SetFromKandG(const double &K,const double &G);
+
+    //*****************************************
+    //*** Print the tensor
+    //*****************************************
+    inline void PrintMandel() const{
+        for(int I=1;I<=6;++I){
+            PetscPrintf(PETSC_COMM_WORLD,"*** %12.5e  %12.5e  %12.5e  %12.5e  %12.5e  %12.5e***\n",
+                        MandelIJ(I,1),MandelIJ(I,2),MandelIJ(I,3),MandelIJ(I,4),MandelIJ(I,5),MandelIJ(I,6));
+        }
+    }
+
+private:
+    /**
+     * the Mandel vector of the symmetric part of a rank-2 tensor
+     */
+    static void ToMandelVector(const RankTwoTensor &a,double (&v)[6]);
+
+private:
+    double _vals[36];
+    static constexpr int _N=36;
+};
@@ -56,7 +56,17 @@ public:
     inline double operator()(const int &i)const{
         return _vals[i-1];
     }
-    
+    /**
+     * [] operator for the components based access, same as the rank-2/4 tensor
+     * @param i the i-th index, i>=1 and i<=3
+     */
+    inline double& operator[](const int &i){
+        return _vals[i-1];
+    }
+    inline double operator[](const int &i)const{
+        return _vals[i-1];
+    }
+
     /**
      * this function will set the vector3d to be zero
      */
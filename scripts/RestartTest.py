@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@Author: Yang Bai
+@Date: 2022.06.19
+@Function: the write->restart->compare test of the checkpoint/restart, the
+           input file test_input/restart/diff2d-restart.i is used:
+             1) the reference run computes all the steps in one go
+             2) the second run stops at the middle, then it is restarted
+                from one of its checkpoints with the same final time
+             3) the csv outputs of the two runs are compared, and the
+                remaining checkpoint files must be the same, i.e. the old
+                checkpoints of the first part are removed after the restart
+           The usage is:
+             python3 RestartTest.py [--asfem ../bin/asfem] [-n 2]
+                                    [--restart-step 6] [--stop-step 10]
+                                    [--workdir restart-runs] [--tolerance 1e-8]
+           The script exits with 1 once the test is failed.
+"""
+import argparse
+import os
+from pathlib import Path
+import shutil
+import subprocess
+import sys
+
+parrentdir=Path(os.path.abspath(__file__)).parent.parent
+InputFile=str(parrentdir)+'/test_input/restart/diff2d-restart.i'
+Prefix='diff2d-restart'
+
+
+def SetTimeSteppingValue(lines,key,value):
+    """
+    replace the value of the given key in the [timestepping] block
+    """
+    inblock=False
+    for i,line in enumerate(lines):
+        if line.strip().lower()=='[timestepping]':
+            inblock=True
+        elif inblock and line.strip().lower()=='[end]':
+            break
+        elif inblock and line.strip().lower().startswith(key+'='):
+            lines[i]='  %s=%s\n'%(key,value)
+            return
+
+def GetTimeSteppingValue(lines,key):
+    inblock=False
+    for line in lines:
+        if line.strip().lower()=='[timestepping]':
+            inblock=True
+        elif inblock and line.strip().lower()=='[end]':
+            break
+        elif inblock and line.strip().lower().startswith(key+'='):
+            return line.split('=',1)[1].strip()
+    return None
+
+def CreateInputFile(rundir,steps):
+    with open(InputFile,'r') as inp:
+        lines=inp.readlines()
+    dt=float(GetTimeSteppingValue(lines,'dt'))
+    SetTimeSteppingValue(lines,'time','%.10e'%(dt*(steps+0.5)))
+    with open(os.path.join(rundir,Prefix+'.i'),'w') as out:
+        out.writelines(lines)
+
+def GetStepsNum():
+    with open(InputFile,'r') as inp:
+        lines=inp.readlines()
+    return int(float(GetTimeSteppingValue(lines,'time'))/float(GetTimeSteppingValue(lines,'dt')))
+
+def RunAsFem(args,rundir,extra,logname):
+    cmd=args.mpirun.split()+['-np','%d'%(args.n),os.path.abspath(args.asfem),'-i',Prefix+'.i']+extra
+    with open(os.path.join(rundir,logname),'w') as log:
+        result=subprocess.run(cmd,cwd=rundir,stdout=log,stderr=subprocess.STDOUT)
+    with open(os.path.join(rundir,logname),'r',errors='replace') as log:
+        output=log.read()
+    if result.returncode!=0 or ('AsFem exit due to some errors' in output):
+        print('***     %s is failed, see %s'%(' '.join(cmd),os.path.join(rundir,logname)))
+        return False
+    return True
+
+def ReadCSV(filename):
+    with open(filename,'r') as inp:
+        lines=[line.strip() for line in inp.readlines() if len(line.strip())>0]
+    return lines[0],[[float(x) for x in line.split(',')] for line in lines[1:]]
+
+def CheckPointFiles(rundir):
+    return sorted([file for file in os.listdir(rundir) if file.startswith(Prefix+'-chk-') and file.endswith('.bin')])
+
+
+if __name__=='__main__':
+    parser=argparse.ArgumentParser(description='the write->restart->compare test of AsFem')
+    parser.add_argument('--asfem',default=str(parrentdir)+'/bin/asfem')
+    parser.add_argument('--mpirun',default='mpirun')
+    parser.add_argument('-n',type=int,default=2,help='the number of ranks')
+    parser.add_argument('--restart-step',type=int,default=6)
+    parser.add_argument('--stop-step',type=int,default=10)
+    parser.add_argument('--workdir',default='restart-runs')
+    parser.add_argument('--tolerance',type=float,default=1.0e-8)
+    args=parser.parse_args()
+
+    steps=GetStepsNum()
+    refdir=os.path.join(args.workdir,'reference')
+    restartdir=os.path.join(args.workdir,'restart')
+    for rundir in [refdir,restartdir]:
+        if os.path.exists(rundir):
+            shutil.rmtree(rundir)
+        os.makedirs(rundir)
+
+    print('**********************************************************************************')
+    print('*** Restart test, ranks=%d, steps=%d, stop at step=%d, restart from step=%d'%(args.n,steps,args.stop_step,args.restart_step))
+
+    # 1) the reference run
+    CreateInputFile(refdir,steps)
+    if not RunAsFem(args,refdir,[],'asfem.log'):
+        sys.exit(1)
+
+    # 2) stop at the middle, then restart with the full time
+    CreateInputFile(restartdir,args.stop_step)
+    if not RunAsFem(args,restartdir,[],'asfem.log'):
+        sys.exit(1)
+    CreateInputFile(restartdir,steps)
+    if not RunAsFem(args,restartdir,['--restart','%s-chk-%08d.bin'%(Prefix,args.restart_step)],'asfem-restart.log'):
+        sys.exit(1)
+
+    # 3) compare the results
+    failed=False
+    refheader,refvalues=ReadCSV(os.path.join(refdir,Prefix+'.csv'))
+    header,values=ReadCSV(os.path.join(restartdir,Prefix+'.csv'))
+    if header!=refheader or len(values)!=len(refvalues):
+        print('***     the csv file of the restart(%d rows) doesn\'t match the reference one(%d rows)'%(len(values),len(refvalues)))
+        failed=True
+    else:
+        maxerr=0.0
+        for row,refrow in zip(values,refvalues):
+            for x,refx in zip(row,refrow):
+                maxerr=max(maxerr,abs(x-refx)/max(1.0,abs(refx)))
+        print('***     max relative difference of the postprocess values=%13.5e'%(maxerr))
+        if maxerr>args.tolerance:
+            failed=True
+    if CheckPointFiles(restartdir)!=CheckPointFiles(refdir):
+        print('***     the remaining checkpoint files are different:')
+        print('***       reference: %s'%(CheckPointFiles(refdir)))
+        print('***       restart  : %s'%(CheckPointFiles(restartdir)))
+        failed=True
+
+    if failed:
+        sys.stdout.write("\033[1;31m") # set to red color
+        print('***     restart test is failed!')
+        sys.stdout.write("\033[0;0m")  # reset color
+        sys.exit(1)
+    sys.stdout.write("\033[1;34m") # set to blue color
+    print('***     restart test is success!')
+    sys.stdout.write("\033[0;0m")  # reset
+    print('**********************************************************************************')
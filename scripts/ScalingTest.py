@@ -0,0 +1,349 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+@Author: Yang Bai
+@Date: 2022.06.14
+@Function: the scaling and regression benchmarks of AsFem, a curated set of
+           the example input files is executed at different MPI ranks and
+           OpenMP threads with the '--profile' option, then the wall time of
+           each phase, the SNES/KSP iterations, the peak memory and the size
+           of the output files are collected.
+           The usage is:
+             python3 ScalingTest.py [--asfem ../bin/asfem] [--ranks 1,2,4]
+                                    [--threads 1] [--mode strong|weak|both]
+                                    [--cases neohookean-3d,dendrite2d]
+                                    [--steps 5] [--workdir scaling-runs]
+                                    [--history ScalingHistory.csv]
+                                    [--baseline baseline.json] [--tolerance 0.1]
+                                    [--save-baseline baseline.json] [--plot]
+           The history is appended to a csv file, each run is also written to
+           a json file in the work dir, if '--baseline' is given, the script
+           exits with 1 once any case is slower than the baseline by more
+           than the tolerance.
+"""
+import argparse
+import csv
+import json
+import os
+from pathlib import Path
+import shutil
+import subprocess
+import sys
+import time
+
+# the script may be called from anywhere, the examples are located relative to the script itself
+parrentdir=Path(os.path.abspath(__file__)).parent.parent
+ExampleDir=str(parrentdir)+'/examples/'
+
+# the curated cases, 'refine' scales nx/ny/nz of the built-in mesh, the gmsh one can't be refined
+Cases={
+    'cube250':             {'input':'pffracture/cube250.i','files':['pffracture/cube250.msh'],'refine':1},
+    'neohookean-3d':       {'input':'mechanics/neohookean-3d.i','files':[],'refine':1},
+    'dendrite2d':          {'input':'phasefield/dendrite2d.i','files':[],'refine':1},
+    'neohookean-3d-large': {'input':'mechanics/neohookean-3d.i','files':[],'refine':2},
+    'dendrite2d-large':    {'input':'phasefield/dendrite2d.i','files':[],'refine':2},
+}
+
+# the events written by the profiler, see src/Utils/Profiler.cpp
+Phases=['FormResidual','FormJacobian','UpdateMaterial','ApplyBC','Projection',
+        'Output','Postprocess','CheckPoint','SNESSolve','KSPSolve','PCSetUp','PCApply']
+
+Fields=['date','commit','case','mode','nprocs','nthreads','status','wall_time','total_time']+\
+       ['time_'+phase for phase in Phases]+\
+       ['solves','failed_solves','snes_iterations','ksp_iterations','peak_memory_mb','output_mb']
+
+
+#############################################################
+### for the modification of the input file
+#############################################################
+def FindBlock(lines,blockname):
+    """
+    return the range of the top level block, i.e. [mesh] ... [end], -1 is returned if it is not found
+    """
+    start=-1
+    for i,line in enumerate(lines):
+        if line.strip().lower()=='['+blockname+']':
+            start=i
+            break
+    if start<0:
+        return -1,-1
+    level=0
+    for i in range(start+1,len(lines)):
+        line=lines[i].strip().lower()
+        if line=='[end]':
+            if level==0:
+                return start,i
+            level-=1
+        elif line.startswith('[') and line.endswith(']'):
+            level+=1
+    return start,-1
+
+def GetBlockValue(lines,blockname,key):
+    start,end=FindBlock(lines,blockname)
+    if start<0 or end<0:
+        return None
+    for i in range(start+1,end):
+        line=lines[i].strip()
+        if line.startswith('//'):
+            continue
+        if line.lower().startswith(key+'='):
+            return line.split('=',1)[1].strip()
+    return None
+
+def SetBlockValue(lines,blockname,key,value):
+    start,end=FindBlock(lines,blockname)
+    if start<0 or end<0:
+        return
+    for i in range(start+1,end):
+        line=lines[i].strip()
+        if line.startswith('//'):
+            continue
+        if line.lower().startswith(key+'='):
+            lines[i]='  %s=%s\n'%(key,value)
+            return
+    lines.insert(end,'  %s=%s\n'%(key,value))
+
+def CreateInputFile(case,filename,nprocs,mode,steps):
+    """
+    write the modified input file, only 'steps' fixed steps are computed, for the weak scaling, the mesh
+    is refined with the ranks, so the dofs per rank is fixed
+    """
+    with open(ExampleDir+Cases[case]['input'],'r') as inp:
+        lines=inp.readlines()
+    if GetBlockValue(lines,'mesh','type')=='asfem':
+        dim=int(GetBlockValue(lines,'mesh','dim'))
+        factor=Cases[case]['refine']
+        if mode=='weak':
+            factor*=nprocs**(1.0/dim)
+        for key in ['nx','ny','nz']:
+            value=GetBlockValue(lines,'mesh',key)
+            if value is not None:
+                SetBlockValue(lines,'mesh',key,'%d'%(max(1,round(int(value)*factor))))
+    dt=GetBlockValue(lines,'timestepping','dt')
+    if dt is not None and steps>0:
+        # the fixed step size makes the cost independent of the convergence history
+        SetBlockValue(lines,'timestepping','adaptive','false')
+        SetBlockValue(lines,'timestepping','time','%.10e'%(float(dt)*(steps+0.5)))
+    with open(filename,'w') as out:
+        out.writelines(lines)
+
+
+#############################################################
+### for the single run
+#############################################################
+def RunCase(args,case,mode,nprocs,nthreads,commit):
+    record={field:'' for field in Fields}
+    record.update({'date':time.strftime('%Y-%m-%d %H:%M:%S'),'commit':commit,
+                   'case':case,'mode':mode,'nprocs':nprocs,'nthreads':nthreads})
+    rundir=os.path.join(args.workdir,'%s-%s-np%d-nt%d'%(case,mode,nprocs,nthreads))
+    if os.path.exists(rundir):
+        shutil.rmtree(rundir)
+    os.makedirs(rundir)
+    for file in Cases[case]['files']:
+        shutil.copy(ExampleDir+file,rundir)
+    inputfile=case+'.i'
+    CreateInputFile(case,os.path.join(rundir,inputfile),nprocs,mode,args.steps)
+    inputs=set(os.listdir(rundir))
+
+    env=dict(os.environ)
+    env['OMP_NUM_THREADS']='%d'%(nthreads)
+    cmd=args.mpirun.split()+['-np','%d'%(nprocs),os.path.abspath(args.asfem),'-i',inputfile,'--profile']
+    print('***     running %s(%s), ranks=%d, threads=%d'%(case,mode,nprocs,nthreads))
+    timestart=time.time()
+    with open(os.path.join(rundir,'asfem.log'),'w') as log:
+        result=subprocess.run(cmd,cwd=rundir,env=env,stdout=log,stderr=subprocess.STDOUT)
+    record['wall_time']='%.6e'%(time.time()-timestart)
+
+    with open(os.path.join(rundir,'asfem.log'),'r',errors='replace') as log:
+        output=log.read()
+    jsonfile=os.path.join(rundir,case+'.profile.json')
+    if result.returncode!=0 or ('AsFem exit due to some errors' in output) or not os.path.exists(jsonfile):
+        record['status']='failed'
+        sys.stdout.write("\033[1;31m") # set to red color
+        print('***     %s is failed, see %s'%(case,os.path.join(rundir,'asfem.log')))
+        sys.stdout.write("\033[0;0m")  # reset color
+        return record
+
+    with open(jsonfile,'r') as inp:
+        profile=json.load(inp)
+    record['status']='success'
+    record['total_time']='%.6e'%(profile['total_time'])
+    events={event['name']:event for event in profile['events']}
+    for phase in Phases:
+        record['time_'+phase]='%.6e'%(events[phase]['time'] if phase in events else 0.0)
+    for key in ['solves','failed_solves','snes_iterations','ksp_iterations']:
+        record[key]=profile.get(key,0)
+    record['peak_memory_mb']='%.6e'%(profile.get('max_peak_memory',0.0)/1.0e6)
+
+    outputsize=0
+    for file in os.listdir(rundir):
+        if file in inputs or file=='asfem.log' or file.endswith('.profile.json'):
+            continue
+        if os.path.isfile(os.path.join(rundir,file)):
+            outputsize+=os.path.getsize(os.path.join(rundir,file))
+    record['output_mb']='%.6e'%(outputsize/1.0e6)
+    print('***     total time=%13.5e, SNES iters=%d, KSP iters=%d, peak memory=%10.3f MB'%(
+          float(record['total_time']),record['snes_iterations'],record['ksp_iterations'],
+          float(record['peak_memory_mb'])))
+    return record
+
+
+#############################################################
+### for the history, baseline and plots
+#############################################################
+def CaseKey(record):
+    return '%s/%s/np%s/nt%s'%(record['case'],record['mode'],record['nprocs'],record['nthreads'])
+
+def WriteHistory(filename,records):
+    newfile=not os.path.exists(filename)
+    with open(filename,'a',newline='') as out:
+        writer=csv.DictWriter(out,fieldnames=Fields)
+        if newfile:
+            writer.writeheader()
+        for record in records:
+            writer.writerow(record)
+
+def CompareWithBaseline(filename,records,tolerance):
+    """
+    return the number of the regressed cases
+    """
+    with open(filename,'r') as inp:
+        baseline={CaseKey(record):record for record in json.load(inp)['records']}
+    print('**********************************************************************************')
+    print('*** Compare with the baseline %s (tolerance=%.1f%%)'%(filename,100.0*tolerance))
+    print('*** %-40s%13s%13s%9s'%('case','old[s]','new[s]','ratio'))
+    nRegressions=0
+    for record in records:
+        key=CaseKey(record)
+        if record['status']!='success' or key not in baseline or baseline[key]['status']!='success':
+            continue
+        old=float(baseline[key]['total_time']);new=float(record['total_time'])
+        ratio=new/old if old>0.0 else 1.0
+        msg='*** %-40s%13.5e%13.5e%9.3f'%(key,old,new,ratio)
+        if ratio>1.0+tolerance:
+            nRegressions+=1
+            sys.stdout.write("\033[1;31m")
+            print(msg+'  regression!')
+            sys.stdout.write("\033[0;0m")
+        else:
+            print(msg)
+        # the iterations should be reproducible for the fixed step size
+        if int(record['snes_iterations'])!=int(baseline[key]['snes_iterations']):
+            print('***     SNES iterations changed: %s -> %s'%(baseline[key]['snes_iterations'],
+                                                              record['snes_iterations']))
+    return nRegressions
+
+def PlotScaling(workdir,records):
+    try:
+        import matplotlib
+        matplotlib.use('Agg')
+        import matplotlib.pyplot as plt
+    except ImportError:
+        print('*** matplotlib is not available, the scaling plots are skipped')
+        return
+    for mode in ['strong','weak']:
+        fig,ax=plt.subplots()
+        nplots=0
+        for case in Cases:
+            for nthreads in sorted(set(r['nthreads'] for r in records)):
+                data=sorted([(r['nprocs'],float(r['total_time'])) for r in records
+                             if r['case']==case and r['mode']==mode and r['nthreads']==nthreads
+                             and r['status']=='success'])
+                if len(data)<2:
+                    continue
+                nprocs=[d[0] for d in data]
+                if mode=='strong':
+                    values=[data[0][1]*data[0][0]/(d[1]*d[0]) for d in data]
+                else:
+                    values=[data[0][1]/d[1] for d in data]
+                ax.plot(nprocs,values,'o-',label='%s(nt=%d)'%(case,nthreads))
+                nplots+=1
+        if nplots>0:
+            ax.axhline(1.0,color='k',linestyle='--',label='ideal')
+            ax.set_xscale('log',base=2)
+            ax.set_xlabel('MPI ranks')
+            ax.set_ylabel('parallel efficiency')
+            ax.set_title('%s scaling'%(mode))
+            ax.legend()
+            fig.savefig(os.path.join(workdir,'scaling-%s.png'%(mode)),dpi=150)
+            print('*** %s scaling plot is written to %s'%(mode,os.path.join(workdir,'scaling-%s.png'%(mode))))
+        plt.close(fig)
+
+
+#############################################################
+### the main entrance
+#############################################################
+parser=argparse.ArgumentParser(description='scaling and regression benchmarks of AsFem')
+parser.add_argument('--asfem',default=str(parrentdir)+'/bin/asfem',help='the AsFem executable file')
+parser.add_argument('--mpirun',default='mpirun',help='the MPI launcher, i.e. "mpirun --oversubscribe"')
+parser.add_argument('--cases',default='cube250,neohookean-3d,dendrite2d',
+                    help='comma separated cases, available: %s'%(','.join(Cases)))
+parser.add_argument('--ranks',default='1,2,4',help='comma separated MPI ranks')
+parser.add_argument('--threads',default='1',help='comma separated OpenMP threads')
+parser.add_argument('--mode',default='strong',choices=['strong','weak','both'])
+parser.add_argument('--steps',type=int,default=5,help='the fixed number of time steps, 0 for the full run')
+parser.add_argument('--workdir',default='scaling-runs')
+parser.add_argument('--history',default='ScalingHistory.csv',help='the csv file of all the previous runs')
+parser.add_argument('--baseline',default='',help='the json file of the baseline run')
+parser.add_argument('--tolerance',type=float,default=0.1,help='the allowed slowdown against the baseline')
+parser.add_argument('--save-baseline',default='',help='save the current run as the baseline')
+parser.add_argument('--plot',action='store_true',help='write the strong/weak scaling plots')
+args=parser.parse_args()
+
+caselist=[case.strip() for case in args.cases.split(',') if case.strip()]
+for case in caselist:
+    if case not in Cases:
+        print('*** Error: unknown case %s, available ones are: %s'%(case,','.join(Cases)))
+        sys.exit(1)
+ranklist=[int(n) for n in args.ranks.split(',')]
+threadlist=[int(n) for n in args.threads.split(',')]
+modelist=['strong','weak'] if args.mode=='both' else [args.mode]
+if not os.path.exists(args.asfem):
+    print('*** Error: AsFem executable file %s is not found'%(args.asfem))
+    sys.exit(1)
+os.makedirs(args.workdir,exist_ok=True)
+
+try:
+    commit=subprocess.run(['git','rev-parse','--short','HEAD'],cwd=str(parrentdir),
+                          capture_output=True).stdout.decode('utf-8').strip()
+except OSError:
+    commit=''
+
+print('**********************************************************************************')
+print('*** We start to run the scaling benchmarks of AsFem ...')
+print('*** AsFem executable file is :%s'%(args.asfem))
+print('*** Cases: %s, ranks: %s, threads: %s, mode: %s'%(args.cases,args.ranks,args.threads,args.mode))
+
+timestart=time.time()
+records=[]
+for case in caselist:
+    print('***----------------------------------------------------------------------------***')
+    for mode in modelist:
+        if mode=='weak' and Cases[case]['files']:
+            print('***     %s uses an external mesh, the weak scaling is skipped'%(case))
+            continue
+        for nthreads in threadlist:
+            for nprocs in ranklist:
+                records.append(RunCase(args,case,mode,nprocs,nthreads,commit))
+
+WriteHistory(args.history,records)
+runfile=os.path.join(args.workdir,'scaling-%s.json'%(time.strftime('%Y%m%d-%H%M%S')))
+with open(runfile,'w') as out:
+    json.dump({'commit':commit,'records':records},out,indent=2)
+if args.save_baseline:
+    shutil.copy(runfile,args.save_baseline)
+if args.plot:
+    PlotScaling(args.workdir,records)
+
+nRegressions=0
+if args.baseline:
+    nRegressions=CompareWithBaseline(args.baseline,records,args.tolerance)
+
+nFailed=sum(1 for record in records if record['status']!='success')
+print('**********************************************************************************')
+print('*** Benchmarks finished, runs=%d, failed=%d, regressions=%d [elapse time=%13.5e]!'%(
+      len(records),nFailed,nRegressions,time.time()-timestart))
+print('*** The history is appended to %s, this run is written to %s'%(args.history,runfile))
+print('**********************************************************************************')
+if nFailed>0 or nRegressions>0:
+    sys.exit(1)
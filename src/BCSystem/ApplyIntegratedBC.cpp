@@ -0,0 +1,116 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.28
+//+++ Purpose: apply the integrated boundary conditions, i.e. the
+//+++          neumann, flux and user-defined bcs. The gauss point
+//+++          geometry comes from the cached boundary sets, and the
+//+++          local face vector/matrix is assembled by one
+//+++          VecSetValues/MatSetValues call for each element
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "BCSystem/BCSystem.h"
+
+void BCSystem::ApplyIntegratedBC(const FECalcType &calctype,const BCBlock &bcblock,const double &bcvalue,const double (&ctan)[3],Mat &AMATRIX,Vec &RHS){
+    int e,i,j,k,ki,kj,gpInd,nNodes,nDofs,nFaceDofs,iInd;
+    double value,JxW;
+
+    nDofs=static_cast<int>(bcblock._DofIDs.size());
+    _elmtinfo.nDofs=nDofs;
+    _localR.Resize(_nMaxBCDofs,0.0);
+    _localK.Resize(_nMaxBCDofs,_nMaxBCDofs,0.0);
+
+    for(const auto &bcset:bcblock._BoundarySetList){
+        if(bcset._IsNodeSet) continue;// the node set doesn't have any boundary element
+        _elmtinfo.nDim=bcset._nDim;
+        for(e=1;e<=bcset.GetElmtsNum();++e){
+            nNodes=bcset.GetIthElmtNodesNum(e);
+            nFaceDofs=nNodes*nDofs;
+            Span<const int> elDofs=bcset.GetIthElmtDofIDs(e);
+            _elmtinfo.nNodes=nNodes;
+            if(calctype==FECalcType::ComputeResidual){
+                _faceR.assign(nFaceDofs,0.0);
+            }
+            else if(calctype==FECalcType::ComputeJacobian){
+                _faceK.assign(nFaceDofs*nFaceDofs,0.0);
+            }
+
+            for(gpInd=1;gpInd<=bcset.GetGPointsNum();++gpInd){
+                JxW=bcset.GetIthElmtJthGPJxW(e,gpInd);
+                _normals=bcset.GetIthElmtJthGPNormal(e,gpInd);
+                _elmtinfo.gpCoords=bcset.GetIthElmtJthGPCoords(e,gpInd);
+
+                //*****************************************************
+                //*** calculate the quantities on current gauss point
+                for(k=1;k<=nDofs;k++){
+                    _soln.gpU[k]=0.0;
+                    _soln.gpGradU[k]=0.0;
+                    _soln.gpV[k]=0.0;
+                    _soln.gpGradV[k]=0.0;
+                }
+                for(i=1;i<=nNodes;++i){
+                    const double &shpval=bcset.GetIthElmtJthGPKthShapeValue(e,gpInd,i);
+                    const Vector3d &shpgrad=bcset.GetIthElmtJthGPKthShapeGrad(e,gpInd,i);
+                    for(k=1;k<=nDofs;k++){
+                        iInd=elDofs[(i-1)*nDofs+k-1];
+                        value=_Useqvals[iInd];
+                        _soln.gpU[k]+=shpval*value;
+                        // the gradient is meaningless for the point case
+                        if(bcset._nDim>0) _soln.gpGradU[k]+=value*shpgrad;
+
+                        value=_Vseqvals[iInd];
+                        _soln.gpV[k]+=shpval*value;
+                        if(bcset._nDim>0) _soln.gpGradV[k]+=value*shpgrad;
+                    }
+                }
+
+                if(calctype==FECalcType::ComputeResidual){
+                    for(i=1;i<=nNodes;++i){
+                        _shp.test=bcset.GetIthElmtJthGPKthShapeValue(e,gpInd,i);
+                        _shp.grad_test=bcset.GetIthElmtJthGPKthShapeGrad(e,gpInd,i);
+
+                        _shp.trial=_shp.test;
+                        _shp.grad_trial=_shp.grad_test;
+
+                        RunBCLibs(calctype,bcblock._BCType,bcvalue,bcblock._Parameters,_normals,ctan,_elmtinfo,_soln,_shp,_localR,_localK);
+                        for(k=0;k<nDofs;k++){
+                            _faceR[(i-1)*nDofs+k]+=_localR(k+1)*JxW;
+                        }
+                    }
+                }
+                else if(calctype==FECalcType::ComputeJacobian){
+                    for(i=1;i<=nNodes;++i){
+                        _shp.test=bcset.GetIthElmtJthGPKthShapeValue(e,gpInd,i);
+                        _shp.grad_test=bcset.GetIthElmtJthGPKthShapeGrad(e,gpInd,i);
+                        for(j=1;j<=nNodes;++j){
+                            _shp.trial=bcset.GetIthElmtJthGPKthShapeValue(e,gpInd,j);
+                            _shp.grad_trial=bcset.GetIthElmtJthGPKthShapeGrad(e,gpInd,j);
+                            RunBCLibs(calctype,bcblock._BCType,bcvalue,bcblock._Parameters,_normals,ctan,_elmtinfo,_soln,_shp,_localR,_localK);
+                            // the face matrix is stored in row-major, the same as PETSc
+                            for(ki=0;ki<nDofs;ki++){
+                                for(kj=0;kj<nDofs;kj++){
+                                    _faceK[((i-1)*nDofs+ki)*nFaceDofs+(j-1)*nDofs+kj]+=_localK(ki+1,kj+1)*JxW;
+                                }
+                            }
+                        }//===> end-of-local-J-node-loop
+                    }//===> end-of-local-I-node-loop
+                }//===> end-of-jacobian-calculation
+            }//===> end-of-gauss-point-loop
+
+            // assemble the local face vector/matrix to the global one
+            if(calctype==FECalcType::ComputeResidual){
+                VecSetValues(RHS,nFaceDofs,elDofs.data(),_faceR.data(),ADD_VALUES);
+            }
+            else if(calctype==FECalcType::ComputeJacobian){
+                MatSetValues(AMATRIX,nFaceDofs,elDofs.data(),nFaceDofs,elDofs.data(),_faceK.data(),ADD_VALUES);
+            }
+        }//===> end-of-boundary-element-loop
+    }//===> end-of-boundary-set-loop
+}
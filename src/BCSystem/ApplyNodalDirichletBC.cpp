@@ -15,36 +15,23 @@
 
 
 #include "BCSystem/BCSystem.h"
-#include "DofHandler/DofHandler.h"
 
-void BCSystem::ApplyNodalDirichletBC(const FECalcType &calctype,const BCType &bctype,const vector<string> bcnamelist,const vector<int> &dofsindex,const double &bcvalue,const vector<double> &params,const Mesh &mesh,const DofHandler &dofHandler,Vec &U,Mat &K,Vec &RHS){
-    PetscInt nodeid,e;
-    PetscInt iInd;
-    int rankne,eStart,eEnd;
-    vector<int> dofsid;
+void BCSystem::ApplyNodalDirichletBC(const FECalcType &calctype,const BCType &bctype,const vector<BCBoundarySet> &bcsetlist,const double &bcvalue,const vector<double> &params,Vec &U,Mat &K,Vec &RHS){
+    PetscInt i;
 
-    dofsid.resize(dofsindex.size(),0);
-    _elmtinfo.nDofs=static_cast<int>(dofsindex.size());
     _elmtinfo.nDim=0;
     _elmtinfo.nNodes=1;
-    
-    MPI_Comm_size(PETSC_COMM_WORLD,&_size);
-    MPI_Comm_rank(PETSC_COMM_WORLD,&_rank);
 
-    for(auto bcname:bcnamelist){
-        rankne=mesh.GetBulkMeshNodeIDsNumViaPhysicalName(bcname)/_size;
-        eStart=_rank*rankne;
-        eEnd=(_rank+1)*rankne;
-        if(_rank==_size-1) eEnd=mesh.GetBulkMeshNodeIDsNumViaPhysicalName(bcname);
-        for(e=eStart;e<eEnd;++e){
-            nodeid=mesh.GetBulkMeshIthNodeIDViaPhyName(bcname,e+1);
-            for(int i=0;i<_elmtinfo.nDofs;i++){
-                iInd=dofHandler.GetBulkMeshIthNodeJthDofIndex(nodeid,dofsindex[i])-1;
-                dofsid[i]=iInd;
-            }
+    for(const auto &bcset:bcsetlist){
+        _elmtinfo.nDofs=bcset._nDofs;
+        for(i=1;i<=bcset.GetNodesNum();++i){
+            _elmtinfo.gpCoords(1)=bcset.GetIthNodeJthCoord(i,1);
+            _elmtinfo.gpCoords(2)=bcset.GetIthNodeJthCoord(i,2);
+            _elmtinfo.gpCoords(3)=bcset.GetIthNodeJthCoord(i,3);
+            _dofids.assign(bcset.GetIthNodeDofIDs(i).begin(),bcset.GetIthNodeDofIDs(i).end());
             switch (bctype) {
                 case BCType::NODALDIRICHLETBC:
-                    DirichletBC::ComputeBCValue(calctype,bcvalue,params,_elmtinfo,dofsid,_elmtinfo.gpCoords,K,RHS,U);
+                    DirichletBC::ComputeBCValue(calctype,bcvalue,params,_elmtinfo,_dofids,_elmtinfo.gpCoords,K,RHS,U);
                     break;
                 default:
                     MessagePrinter::PrintErrorTxt("unsupported boundary condition type in ApplyNodalDirichletBC, please check your code");
@@ -14,25 +14,13 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "BCSystem/BCSystem.h"
-#include "DofHandler/DofHandler.h"
 
-void BCSystem::ApplyNodalNeumannBC(const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const vector<int> &dofsindex,const double &bcvalue,const vector<string> &bcnamelist,Vec &RHS){
-    PetscInt j,e;
-    PetscInt iInd;
-    int rankne,eStart,eEnd;
-    if(fe.GetDim()){}
+void BCSystem::ApplyNodalNeumannBC(const vector<BCBoundarySet> &bcsetlist,const double &bcvalue,Vec &RHS){
+    PetscInt i;
 
-    for(const auto &bcname:bcnamelist){
-        MPI_Comm_size(PETSC_COMM_WORLD,&_size);
-        MPI_Comm_rank(PETSC_COMM_WORLD,&_rank);
-        rankne=mesh.GetBulkMeshNodeIDsNumViaPhysicalName(bcname)/_size;
-        eStart=_rank*rankne;
-        eEnd=(_rank+1)*rankne;
-        if(_rank==_size-1) eEnd=mesh.GetBulkMeshNodeIDsNumViaPhysicalName(bcname);
-        for(e=eStart;e<eEnd;++e){
-            j=mesh.GetBulkMeshIthNodeIDViaPhyName(bcname,e+1);
-            for(const auto &id:dofsindex){
-                iInd=dofHandler.GetBulkMeshIthNodeJthDofIndex(j,id)-1;
+    for(const auto &bcset:bcsetlist){
+        for(i=1;i<=bcset.GetNodesNum();++i){
+            for(const auto &iInd:bcset.GetIthNodeDofIDs(i)){
                 VecSetValue(RHS,iInd,bcvalue,ADD_VALUES);
             }
         }
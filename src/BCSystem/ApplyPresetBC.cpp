@@ -20,20 +20,17 @@
 #include "BCSystem/BCSystem.h"
 #include "DofHandler/DofHandler.h"
 
-void BCSystem::ApplyPresetBC(const Mesh &mesh,const DofHandler &dofHandler,const FECalcType &calctype,const double &t,const double (&ctan)[3],Vec &U,Mat &AMATRIX,Vec &RHS){
+void BCSystem::ApplyPresetBC(const Mesh &,const DofHandler &,const FECalcType &calctype,const double &t,const double (&)[3],Vec &U,Mat &AMATRIX,Vec &RHS){
 
     double bcvalue;
-    vector<string> bcnamelist;
-    vector<int> DofsIndex;
-    if(ctan[0]){}
+    // the boundary elements and dofs are cached in the boundary sets, the mesh and dofs map are not required here,
+    // and the dirichlet bcs don't depend on ctan
 
     _elmtinfo.t=t;
     _elmtinfo.dt=0.0;
-    for(auto it:_BCBlockList){
+    for(const auto &it:_BCBlockList){
         bcvalue=it._BCValue;
         if(it._IsTimeDependent) bcvalue=it._BCValue*t;
-        DofsIndex=it._DofIDs;
-        bcnamelist=it._BoundaryNameList;
         if(it._BCType==BCType::DIRICHLETBC||
            it._BCType==BCType::CYCLICDIRICHLETBC||
            it._BCType==BCType::USER1DIRICHLETBC||
@@ -41,10 +38,10 @@ void BCSystem::ApplyPresetBC(const Mesh &mesh,const DofHandler &dofHandler,const
            it._BCType==BCType::USER3DIRICHLETBC||
            it._BCType==BCType::USER4DIRICHLETBC||
            it._BCType==BCType::USER5DIRICHLETBC){
-            ApplyDirichletBC(calctype,it._BCType,bcnamelist,DofsIndex,bcvalue,it._Parameters,mesh,dofHandler,U,AMATRIX,RHS);
+            ApplyDirichletBC(calctype,it._BCType,it._BoundarySetList,bcvalue,it._Parameters,U,AMATRIX,RHS);
         }
         else if(it._BCType==BCType::NODALDIRICHLETBC){
-            ApplyNodalDirichletBC(calctype,it._BCType,bcnamelist,DofsIndex,bcvalue,it._Parameters,mesh,dofHandler,U,AMATRIX,RHS);
+            ApplyNodalDirichletBC(calctype,it._BCType,it._BoundarySetList,bcvalue,it._Parameters,U,AMATRIX,RHS);
         }
         else{
             continue;
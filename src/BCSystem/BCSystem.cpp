@@ -24,13 +24,7 @@ BCSystem::BCSystem(){
 
     _PenaltyFactor=1.0e15;
     _nBCDim=0;_nBulkDim=0;_nNodesPerBCElmt=0;
-    _xi=0.0;_eta=0.0;_JxW=0.0;
-    
-    _xs[0][0]=0.0;_xs[0][1]=0.0;_xs[0][2]=0.0;
-    _xs[1][0]=0.0;_xs[1][1]=0.0;_xs[1][2]=0.0;
-    _xs[2][0]=0.0;_xs[2][1]=0.0;_xs[2][2]=0.0;
-
-    _dist=0.0;
+    _nMaxBCDofs=1;
 
     _normals=0.0;
 
@@ -41,26 +35,18 @@ BCSystem::BCSystem(){
     _elmtinfo.nDofs=0;
     _elmtinfo.nNodes=0;
 
-    // here we assume the maximum dofs of each BC element is 10!
-    _soln.gpU.resize(10);
-    _soln.gpGradU.resize(10);
-    _soln.gpV.resize(10);
-    _soln.gpGradV.resize(10);
-    // for the old solution in the previous step
-    // do we realy need this?
-    _soln.gpUold.resize(10);
-    _soln.gpGradUold.resize(10);
-    _soln.gpVold.resize(10);
-    _soln.gpGradVold.resize(10);
-
     // for shape functions
     _shp.test=0.0;
     _shp.grad_test=0.0;
     _shp.trial=0.0;
     _shp.grad_trial=0.0;
 
-    _localR.Resize(10);
-    _localK.Resize(10,10);
+    _faceR.clear();
+    _faceK.clear();
+
+    _IsScatterCreated=false;
+    _Useqvals=nullptr;
+    _Vseqvals=nullptr;
 
 }
 
@@ -96,15 +82,6 @@ void BCSystem::InitBCSystem(const Mesh &mesh){
     _nBCDim=0;
     _nBulkDim=mesh.GetBulkMeshDim();
     _nNodesPerBCElmt=mesh.GetBulkMeshNodesNumPerBulkElmt();
-    _elNodes.InitNodes(mesh.GetBulkMeshNodesNumPerBulkElmt());
-
-    _xi=0.0;_eta=0.0;_JxW=0.0;
-    
-    _xs[0][0]=0.0;_xs[0][1]=0.0;_xs[0][2]=0.0;
-    _xs[1][0]=0.0;_xs[1][1]=0.0;_xs[1][2]=0.0;
-    _xs[2][0]=0.0;_xs[2][1]=0.0;_xs[2][2]=0.0;
-
-    _dist=0.0;
 
     _normals=0.0;
     
@@ -115,18 +92,6 @@ void BCSystem::InitBCSystem(const Mesh &mesh){
     _elmtinfo.nDofs=0;
     _elmtinfo.nNodes=0;
 
-    // here we assume the maximum dofs of each BC element is 10!
-    _soln.gpU.resize(10);
-    _soln.gpGradU.resize(10);
-    _soln.gpV.resize(10);
-    _soln.gpGradV.resize(10);
-    // for the old solution in the previous step
-    // do we realy need this?
-    _soln.gpUold.resize(10);
-    _soln.gpGradUold.resize(10);
-    _soln.gpVold.resize(10);
-    _soln.gpGradVold.resize(10);
-
     // for shape functions
     _shp.test=0.0;
     _shp.grad_test=0.0;
@@ -134,3 +99,26 @@ void BCSystem::InitBCSystem(const Mesh &mesh){
     _shp.grad_trial=0.0;
 
 }
+
+//************************************
+void BCSystem::ReleaseMem(){
+    if(_IsScatterCreated){
+        VecScatterDestroy(&_scatteru);
+        VecDestroy(&_Useq);
+        VecDestroy(&_Vseq);
+        _IsScatterCreated=false;
+    }
+}
+//************************************
+void BCSystem::InitLocalSolution(const int &n){
+    _solnArena.Reserve(4*ScratchArena::BytesOf<double>(n)+4*ScratchArena::BytesOf<Vector3d>(n));
+    _soln.gpU=_solnArena.Allocate<double>(n,0.0);
+    _soln.gpV=_solnArena.Allocate<double>(n,0.0);
+    _soln.gpGradU=_solnArena.Allocate<Vector3d>(n,Vector3d(0.0));
+    _soln.gpGradV=_solnArena.Allocate<Vector3d>(n,Vector3d(0.0));
+    // for the old solution in the previous step
+    _soln.gpUold=_solnArena.Allocate<double>(n,0.0);
+    _soln.gpVold=_solnArena.Allocate<double>(n,0.0);
+    _soln.gpGradUold=_solnArena.Allocate<Vector3d>(n,Vector3d(0.0));
+    _soln.gpGradVold=_solnArena.Allocate<Vector3d>(n,Vector3d(0.0));
+}
@@ -0,0 +1,231 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.27
+//+++ Purpose: create the rank-local boundary set of each boundary
+//+++          name in each [bcs] sub block. The elements(or nodes
+//+++          for the node set) of one physical group are split
+//+++          into contiguous ranges among the ranks, the same as
+//+++          the old per-call loop, so the assembled system is
+//+++          not changed. The gauss point geometry of the boundary
+//+++          elements is cached here as well
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <algorithm>
+#include <utility>
+
+#include "BCSystem/BCSystem.h"
+#include "DofHandler/DofHandler.h"
+
+void BCSystem::CreateBCBoundarySets(const Mesh &mesh,const DofHandler &dofHandler,FE &fe){
+    int rankne,eStart,eEnd;
+    int e,ee,i,j,k,nDofs;
+    bool IsNodeSet;
+
+    MPI_Comm_size(PETSC_COMM_WORLD,&_size);
+    MPI_Comm_rank(PETSC_COMM_WORLD,&_rank);
+
+    _nMaxBCDofs=1;
+    for(auto &bcblock:_BCBlockList){
+        bcblock._BoundarySetList.clear();
+        if(bcblock._BCType==BCType::NULLBC) continue;
+
+        IsNodeSet=(bcblock._BCType==BCType::NODALDIRICHLETBC||
+                   bcblock._BCType==BCType::NODALNEUMANNBC||
+                   bcblock._BCType==BCType::NODALFLUXBC||
+                   bcblock._BCType==BCType::NODALFORCEBC);
+        nDofs=static_cast<int>(bcblock._DofIDs.size());
+        if(nDofs>_nMaxBCDofs) _nMaxBCDofs=nDofs;
+
+        for(const auto &bcname:bcblock._BoundaryNameList){
+            BCBoundarySet bcset;
+            bcset._BoundaryName=bcname;
+            bcset._IsNodeSet=IsNodeSet;
+            bcset._nDofs=nDofs;
+            if(IsNodeSet){
+                const vector<int> &nodeids=mesh.GetBulkMeshNodeIDsViaPhysicalName(bcname);
+                rankne=static_cast<int>(nodeids.size())/_size;
+                eStart=_rank*rankne;
+                eEnd=(_rank+1)*rankne;
+                if(_rank==_size-1) eEnd=static_cast<int>(nodeids.size());
+                bcset._nDim=0;
+                bcset._nNodesPerElmt=1;
+                // the node set is used as it is, the duplicated nodes(if any) are kept, since the nodal
+                // neumann bc adds the value to each entry of the node set
+                bcset._NodeIDs.assign(nodeids.begin()+eStart,nodeids.begin()+eEnd);
+            }
+            else{
+                const vector<int> &elmtids=mesh.GetBulkMeshElmtIDsViaPhysicalName(bcname);
+                rankne=static_cast<int>(elmtids.size())/_size;
+                eStart=_rank*rankne;
+                eEnd=(_rank+1)*rankne;
+                if(_rank==_size-1) eEnd=static_cast<int>(elmtids.size());
+                bcset._nDim=mesh.GetBulkMeshDimViaPhyName(bcname);
+                bcset._nNodesPerElmt=mesh.GetBulkMeshNodesNumPerElmtViaPhysicalName(bcname);
+
+                bcset._ElmtIDs.assign(elmtids.begin()+eStart,elmtids.begin()+eEnd);
+                bcset._ElmtConnOffset.assign(bcset._ElmtIDs.size()+1,0);
+                for(e=1;e<=bcset.GetElmtsNum();e++){
+                    bcset._ElmtConnOffset[e]=bcset._ElmtConnOffset[e-1]+mesh.GetBulkMeshIthElmtNodesNum(bcset._ElmtIDs[e-1]);
+                }
+                bcset._ElmtConn.resize(bcset._ElmtConnOffset.back());
+                for(e=1;e<=bcset.GetElmtsNum();e++){
+                    ee=bcset._ElmtIDs[e-1];
+                    for(i=1;i<=mesh.GetBulkMeshIthElmtNodesNum(ee);i++){
+                        bcset._ElmtConn[bcset._ElmtConnOffset[e-1]+i-1]=mesh.GetBulkMeshIthElmtJthNodeID(ee,i);
+                    }
+                }
+                bcset._ElmtNodeCoords.resize(3*bcset._ElmtConn.size());
+                bcset._ElmtDofIDs.resize(nDofs*bcset._ElmtConn.size());
+                for(i=0;i<static_cast<int>(bcset._ElmtConn.size());i++){
+                    j=bcset._ElmtConn[i];
+                    for(k=1;k<=3;k++){
+                        bcset._ElmtNodeCoords[3*i+k-1]=mesh.GetBulkMeshIthNodeJthCoord(j,k);
+                    }
+                    for(k=0;k<nDofs;k++){
+                        bcset._ElmtDofIDs[i*nDofs+k]=dofHandler.GetBulkMeshIthNodeJthDofIndex(j,bcblock._DofIDs[k])-1;
+                    }
+                }
+                // the shared nodes of the neighbouring elements are only visited once by the dirichlet bc
+                bcset._NodeIDs=bcset._ElmtConn;
+                sort(bcset._NodeIDs.begin(),bcset._NodeIDs.end());
+                bcset._NodeIDs.erase(unique(bcset._NodeIDs.begin(),bcset._NodeIDs.end()),bcset._NodeIDs.end());
+
+                CreateBCBoundarySetGeometry(fe,bcset);
+            }
+
+            bcset._NodeCoords.resize(3*bcset._NodeIDs.size());
+            bcset._NodeDofIDs.resize(nDofs*bcset._NodeIDs.size());
+            for(i=0;i<static_cast<int>(bcset._NodeIDs.size());i++){
+                j=bcset._NodeIDs[i];
+                for(k=1;k<=3;k++){
+                    bcset._NodeCoords[3*i+k-1]=mesh.GetBulkMeshIthNodeJthCoord(j,k);
+                }
+                for(k=0;k<nDofs;k++){
+                    bcset._NodeDofIDs[i*nDofs+k]=dofHandler.GetBulkMeshIthNodeJthDofIndex(j,bcblock._DofIDs[k])-1;
+                }
+            }
+            bcblock._BoundarySetList.push_back(move(bcset));
+        }
+    }
+    // the local arrays of the integrated bcs are sized by the largest 'dofs=' of all the [bcs] sub blocks,
+    // the local solution is indexed by the dof id(1-based) of the bc, which is bounded by the dofs per node
+    _localR.Resize(_nMaxBCDofs,0.0);
+    _localK.Resize(_nMaxBCDofs,_nMaxBCDofs,0.0);
+    InitLocalSolution(dofHandler.GetMaxDofsNumPerNode()+1);
+}
+
+//*****************************************************************
+void BCSystem::CreateBCBoundarySetGeometry(FE &fe,BCBoundarySet &bcset){
+    int e,i,gpInd,nNodes,nMaxNodes,iInd;
+    double xi,eta,dist;
+    double xs[3][2];
+    Vector3d normal;
+    Nodes elNodes;
+
+    nMaxNodes=1;
+    for(e=1;e<=bcset.GetElmtsNum();e++){
+        if(bcset.GetIthElmtNodesNum(e)>nMaxNodes) nMaxNodes=bcset.GetIthElmtNodesNum(e);
+    }
+    elNodes.InitNodes(nMaxNodes);
+
+    if(bcset._nDim==0){
+        // for point case,(bulk dim=1, bc dim=0)
+        bcset._nGPoints=1;
+    }
+    else if(bcset._nDim==1){
+        bcset._nGPoints=fe._LineQPoint.GetQpPointsNum();
+    }
+    else if(bcset._nDim==2){
+        bcset._nGPoints=fe._SurfaceQPoint.GetQpPointsNum();
+    }
+    else{
+        bcset._nGPoints=0;
+    }
+    bcset._GPJxW.assign(bcset.GetElmtsNum()*bcset._nGPoints,0.0);
+    bcset._GPNormals.assign(bcset.GetElmtsNum()*bcset._nGPoints,Vector3d(0.0));
+    bcset._GPCoords.assign(bcset.GetElmtsNum()*bcset._nGPoints,Vector3d(0.0));
+    bcset._GPShapeValues.assign(bcset._ElmtConn.size()*bcset._nGPoints,0.0);
+    bcset._GPShapeGrads.assign(bcset._ElmtConn.size()*bcset._nGPoints,Vector3d(0.0));
+
+    for(e=1;e<=bcset.GetElmtsNum();e++){
+        nNodes=bcset.GetIthElmtNodesNum(e);
+        bcset.GetIthElmtNodes(e,elNodes);
+        for(gpInd=1;gpInd<=bcset._nGPoints;gpInd++){
+            iInd=bcset._ElmtConnOffset[e-1]*bcset._nGPoints+(gpInd-1)*nNodes;
+            normal=0.0;
+            if(bcset._nDim==0){
+                bcset._GPJxW[(e-1)*bcset._nGPoints+gpInd-1]=1.0;
+                for(i=1;i<=nNodes;i++){
+                    bcset._GPShapeValues[iInd+i-1]=1.0;
+                    bcset._GPShapeGrads[iInd+i-1]=0.0;
+                    bcset._GPShapeGrads[iInd+i-1](1)=1.0;
+                }
+            }
+            else if(bcset._nDim==1){
+                // for line case (bulk dim>=2, bc dim=1), the normal is calculated on local coordinate
+                xi=fe._LineQPoint(gpInd,1);
+                fe._LineShp.Calc(xi,elNodes,false);
+                xs[0][0]=0.0;xs[1][0]=0.0;
+                for(i=1;i<=nNodes;i++){
+                    xs[0][0]+=fe._LineShp.shape_grad(i)(1)*elNodes(i,1);// dx/dxi
+                    xs[1][0]+=fe._LineShp.shape_grad(i)(1)*elNodes(i,2);// dy/dxi
+                }
+                dist=sqrt(xs[0][0]*xs[0][0]+xs[1][0]*xs[1][0]);
+                normal(1)= xs[1][0]/dist;
+                normal(2)=-xs[0][0]/dist;
+                normal(3)= 0.0;
+
+                fe._LineShp.Calc(xi,elNodes,true);
+                bcset._GPJxW[(e-1)*bcset._nGPoints+gpInd-1]=fe._LineShp.GetDetJac()*fe._LineQPoint(gpInd,0);
+                for(i=1;i<=nNodes;i++){
+                    bcset._GPShapeValues[iInd+i-1]=fe._LineShp.shape_value(i);
+                    bcset._GPShapeGrads[iInd+i-1]=fe._LineShp.shape_grad(i);
+                }
+            }
+            else if(bcset._nDim==2){
+                // for surface case (bulk dim=3, bc dim=2)
+                xi=fe._SurfaceQPoint(gpInd,1);
+                eta=fe._SurfaceQPoint(gpInd,2);
+                fe._SurfaceShp.Calc(xi,eta,elNodes,false);
+                for(int k=0;k<3;k++){
+                    xs[k][0]=0.0;xs[k][1]=0.0;
+                    for(i=1;i<=nNodes;i++){
+                        xs[k][0]+=fe._SurfaceShp.shape_grad(i)(1)*elNodes(i,k+1);// d(x,y,z)/dxi
+                        xs[k][1]+=fe._SurfaceShp.shape_grad(i)(2)*elNodes(i,k+1);// d(x,y,z)/deta
+                    }
+                }
+                normal(1)=xs[1][0]*xs[2][1]-xs[2][0]*xs[1][1];
+                normal(2)=xs[2][0]*xs[0][1]-xs[0][0]*xs[2][1];
+                normal(3)=xs[0][0]*xs[1][1]-xs[1][0]*xs[0][1];
+                dist=sqrt(normal(1)*normal(1)+normal(2)*normal(2)+normal(3)*normal(3));
+                normal(1)=normal(1)/dist;
+                normal(2)=normal(2)/dist;
+                normal(3)=normal(3)/dist;
+
+                fe._SurfaceShp.Calc(xi,eta,elNodes,true);
+                bcset._GPJxW[(e-1)*bcset._nGPoints+gpInd-1]=fe._SurfaceShp.GetDetJac()*fe._SurfaceQPoint(gpInd,0);
+                for(i=1;i<=nNodes;i++){
+                    bcset._GPShapeValues[iInd+i-1]=fe._SurfaceShp.shape_value(i);
+                    bcset._GPShapeGrads[iInd+i-1]=fe._SurfaceShp.shape_grad(i);
+                }
+            }
+            bcset._GPNormals[(e-1)*bcset._nGPoints+gpInd-1]=normal;
+            // the coordinates of current gauss point
+            Vector3d &gpCoords=bcset._GPCoords[(e-1)*bcset._nGPoints+gpInd-1];
+            gpCoords=0.0;
+            for(i=1;i<=nNodes;i++){
+                gpCoords(1)+=bcset._GPShapeValues[iInd+i-1]*elNodes(i,1);
+                gpCoords(2)+=bcset._GPShapeValues[iInd+i-1]*elNodes(i,2);
+                gpCoords(3)+=bcset._GPShapeValues[iInd+i-1]*elNodes(i,3);
+            }
+        }
+    }
+}
@@ -14,6 +14,7 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "DofHandler/BulkDofHandler.h"
+#include "Utils/MemoryUsage.h"
 
 
 BulkDofHandler::BulkDofHandler(){
@@ -36,9 +37,12 @@ BulkDofHandler::BulkDofHandler(){
     _DofName2IDList.clear();
 
     _NodeDofsMap.clear();
+    _BulkElmtDofsOffset.clear();
     _BulkElmtDofsMap.clear();
 
-    _BulkElmtElmtMateTypePairList.clear();
+    _BulkElmtSubElmtOffset.clear();
+    _BulkElmtSubElmtBlockIDList.clear();
+    _ElmtBlockElmtMateTypePairList.clear();
 }
 
 void BulkDofHandler::AddDofNameFromStrVec(vector<string> &namelist){
@@ -78,6 +82,18 @@ void BulkDofHandler::PrintBulkDofInfo()const{
         snprintf(longbuff,67,"  %2d                       %20s",it.first,it.second.c_str());
         MessagePrinter::PrintNormalTxt(string(longbuff));
     }
+    if(_DofRenumberType!=DofRenumberType::NONE){
+        if(_DofRenumberType==DofRenumberType::RCM){
+            MessagePrinter::PrintNormalTxt("  DoFs renumbering method: reverse Cuthill-McKee");
+        }
+        else{
+            MessagePrinter::PrintNormalTxt("  DoFs renumbering method: Morton space filling curve");
+        }
+        snprintf(buff,70,"  node graph bandwidth: %10d -> %10d",_BandwidthOld,_BandwidthNew);
+        MessagePrinter::PrintNormalTxt(string(buff));
+        snprintf(buff,70,"  node graph profile  : %10lld -> %10lld",_ProfileOld,_ProfileNew);
+        MessagePrinter::PrintNormalTxt(string(buff));
+    }
     MessagePrinter::PrintDashLine();
 }
 
@@ -91,7 +107,7 @@ void BulkDofHandler::PrintBulkDofDetailInfo()const{
         str.clear();
         sprintf(buff,"e=%8d:",e+1);
         str+=string(buff);
-        for(auto it:_BulkElmtDofsMap[e]){
+        for(auto it:GetBulkMeshIthBulkElmtDofIDs(e+1)){
             sprintf(buff,"%8d ",it);
             str+=string(buff);
         }
@@ -99,3 +115,20 @@ void BulkDofHandler::PrintBulkDofDetailInfo()const{
     }
     MessagePrinter::PrintDashLine();
 }
+
+double BulkDofHandler::GetMemoryUsage()const{
+    double bytes=0.0;
+    bytes+=MemoryUsage::Of(_DofIDList)+MemoryUsage::Of(_DofNameList);
+    bytes+=MemoryUsage::Of(_DofID2NameList)+MemoryUsage::Of(_DofName2IDList);
+    bytes+=MemoryUsage::Of(_NodeDofsMap)+MemoryUsage::Of(_NodalDofFlag);
+    bytes+=MemoryUsage::Of(_BulkElmtDofsOffset)+MemoryUsage::Of(_BulkElmtDofsMap);
+    bytes+=MemoryUsage::Of(_BulkElmtDofFlag);
+    bytes+=MemoryUsage::Of(_BulkElmtSubElmtOffset)+MemoryUsage::Of(_BulkElmtSubElmtBlockIDList);
+    bytes+=MemoryUsage::Of(_ElmtBlockElmtMateTypePairList)+MemoryUsage::Of(_ElmtBlockMateIndexList);
+    bytes+=MemoryUsage::Of(_ElmtBlockLocalDofIndex)+MemoryUsage::Of(_ElmtBlockQpOrderList);
+    bytes+=MemoryUsage::Of(_ElmtBlockReducedIntList)+MemoryUsage::Of(_ElmtBlockHourglassList);
+    bytes+=MemoryUsage::Of(_ElmtBlockLumpedMassList);
+    bytes+=MemoryUsage::Of(_NodesOrder)+MemoryUsage::Of(_BulkElmtLoopOrder);
+    bytes+=MemoryUsage::Of(_RowNNZ);
+    return bytes;
+}
@@ -26,22 +26,9 @@ void BulkDofHandler::CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,E
     _nNodesPerBulkElmt=mesh.GetBulkMeshNodesNumPerBulkElmt();
     _nMaxDofsPerElmt=_nNodesPerBulkElmt*_nDofsPerNode;
 
-    _NodalDofFlag.resize(_nNodes,vector<double>(_nDofsPerNode,-1.0));// for dirichlet bc is  : 0
-                                                                     // for neumann bc is    : 1
-                                                                     // for robin/other bc is: 2
-    _BulkElmtDofFlag.resize(_nBulkElmts,vector<double>(_nMaxDofsPerElmt,-1.0));
-
-    _NodeDofsMap.resize(_nNodes,vector<int>(_nDofsPerNode,-1));
-    _BulkElmtDofsMap.resize(_nBulkElmts,vector<int>(_nMaxDofsPerElmt,-1));
-
-    vector<pair<ElmtType,MateType>> temp;
-    temp.clear();
-    _BulkElmtElmtMateTypePairList.resize(_nBulkElmts,temp);
-    for(auto &it:_BulkElmtElmtMateTypePairList){
-        it.clear();
-    }
-    _BulkElmtLocalDofIndex.resize(_nBulkElmts,vector<vector<int>>(0));
-    _BulkElmtElmtMateIndexList.resize(_nBulkElmts,vector<int>(0));
+    // the nodal flag: -1 for the unused dof, 0 for the dirichlet bc, 1 for the others
+    _NodalDofFlag.assign(_nNodes*_nDofsPerNode,-1);
+    _NodeDofsMap.assign(_nNodes*_nDofsPerNode,-1);
 
 
     _nDofs=_nNodes*_nDofsPerNode;// this is our total dofs
@@ -50,7 +37,6 @@ void BulkDofHandler::CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,E
 
     
     int iblock,e,ee,i,ii,j,k,iInd,jInd,ndofs;
-    string domainname;
     vector<int> dofindex;
 
     string str;
@@ -116,40 +102,92 @@ void BulkDofHandler::CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,E
         MessagePrinter::AsFem_Exit();
     }
 
-    ElmtType elmttype;
-    MateType matetype;
-    int mateindex;
+    // the element type, material type, material index and the local dofs are the same for all the
+    // elements of one [elmt] block, so they are stored once for each block, each bulk element only
+    // keeps the list of its [elmt] block ids(CSR format)
+    _ElmtBlockElmtMateTypePairList.resize(elmtSystem.GetBulkElmtBlockNums());
+    _ElmtBlockMateIndexList.resize(elmtSystem.GetBulkElmtBlockNums());
+    _ElmtBlockLocalDofIndex.resize(elmtSystem.GetBulkElmtBlockNums());
+    _ElmtBlockQpOrderList.resize(elmtSystem.GetBulkElmtBlockNums());
+    _ElmtBlockReducedIntList.resize(elmtSystem.GetBulkElmtBlockNums());
+    _ElmtBlockHourglassList.resize(elmtSystem.GetBulkElmtBlockNums());
+    _ElmtBlockLumpedMassList.resize(elmtSystem.GetBulkElmtBlockNums());
+    _BulkElmtSubElmtOffset.assign(_nBulkElmts+1,0);
+    vector<vector<int>> blockelmtids(elmtSystem.GetBulkElmtBlockNums());
+    for(iblock=1;iblock<=elmtSystem.GetBulkElmtBlockNums();iblock++){
+        _ElmtBlockElmtMateTypePairList[iblock-1]=make_pair(elmtSystem.GetIthBulkElmtBlock(iblock)._ElmtType,
+                                                           elmtSystem.GetIthBulkElmtBlock(iblock)._MateType);
+        _ElmtBlockMateIndexList[iblock-1]=elmtSystem.GetIthBulkElmtBlock(iblock)._MateIndex;
+        _ElmtBlockLocalDofIndex[iblock-1]=elmtSystem.GetIthBulkElmtBlock(iblock)._DofsIDList;
+        _ElmtBlockQpOrderList[iblock-1]=elmtSystem.GetIthBulkElmtBlock(iblock)._QpOrder;
+        _ElmtBlockReducedIntList[iblock-1]=elmtSystem.GetIthBulkElmtBlock(iblock)._IsReducedIntegration;
+        _ElmtBlockHourglassList[iblock-1]=elmtSystem.GetIthBulkElmtBlock(iblock)._HourglassStiffness;
+        _ElmtBlockLumpedMassList[iblock-1]=elmtSystem.GetIthBulkElmtBlock(iblock)._IsLumpedMass;
+        if(_ElmtBlockLumpedMassList[iblock-1]&&
+           (mesh.GetBulkMeshBulkElmtType()==MeshType::TRI6||mesh.GetBulkMeshBulkElmtType()==MeshType::QUAD8||
+            mesh.GetBulkMeshBulkElmtType()==MeshType::TET10||mesh.GetBulkMeshBulkElmtType()==MeshType::HEX20)){
+            // the row-sum of these elements is zero or negative on the corner nodes
+            str="the row-sum lumped mass of ["+elmtSystem.GetIthBulkElmtBlock(iblock)._ElmtBlockName
+               +"] is not positive on the corner nodes of current mesh, the linear or quad9/hex27 mesh is recommended";
+            MessagePrinter::PrintWarningTxt(str);
+        }
+        blockelmtids[iblock-1]=mesh.GetBulkMeshElmtIDsViaPhysicalName(elmtSystem.GetIthBulkElmtBlock(iblock)._DomainName);
+        for(auto e:blockelmtids[iblock-1]){
+            ee=e-(mesh.GetBulkMeshElmtsNum()-mesh.GetBulkMeshBulkElmtsNum());
+            _BulkElmtSubElmtOffset[ee]+=1;
+        }
+    }
+    for(e=1;e<=_nBulkElmts;e++) _BulkElmtSubElmtOffset[e]+=_BulkElmtSubElmtOffset[e-1];
+    _BulkElmtSubElmtBlockIDList.assign(_BulkElmtSubElmtOffset[_nBulkElmts],0);
+    vector<int> subelmtcount(_nBulkElmts,0);
     for(iblock=1;iblock<=elmtSystem.GetBulkElmtBlockNums();iblock++){
-        domainname=elmtSystem.GetIthBulkElmtBlock(iblock)._DomainName;
         dofindex=elmtSystem.GetIthBulkElmtBlock(iblock)._DofsIDList; // the dof index could be discontinue case, i.e. 1,2,4 !!!
         ndofs=elmtSystem.GetIthBulkElmtBlock(iblock)._nDofs; // the total dofs of current elmt block
-        elmttype=elmtSystem.GetIthBulkElmtBlock(iblock)._ElmtType;
-        matetype=elmtSystem.GetIthBulkElmtBlock(iblock)._MateType;
-        mateindex=elmtSystem.GetIthBulkElmtBlock(iblock)._MateIndex;
-        for(auto e:mesh.GetBulkMeshElmtIDsViaPhysicalName(domainname)){
+        for(auto e:blockelmtids[iblock-1]){
             // now we are in the elmt id vector
             ee=e-(mesh.GetBulkMeshElmtsNum()-mesh.GetBulkMeshBulkElmtsNum());
-            _BulkElmtElmtMateTypePairList[ee-1].push_back(make_pair(elmttype,matetype));
-            _BulkElmtLocalDofIndex[ee-1].push_back(dofindex);
-            _BulkElmtElmtMateIndexList[ee-1].push_back(mateindex);
+            _BulkElmtSubElmtBlockIDList[_BulkElmtSubElmtOffset[ee-1]+subelmtcount[ee-1]]=iblock;
+            subelmtcount[ee-1]+=1;
             for(i=1;i<=mesh.GetBulkMeshIthBulkElmtNodesNum(ee);i++){
                 iInd=mesh.GetBulkMeshIthBulkElmtJthNodeID(ee,i);
                 for(j=1;j<=ndofs;j++){
                     jInd=dofindex[j-1];
-                    _NodeDofsMap[iInd-1][jInd-1]=1;
-                    _NodalDofFlag[iInd-1][jInd-1]=1.0;
+                    _NodeDofsMap[(iInd-1)*_nDofsPerNode+jInd-1]=1;
+                    _NodalDofFlag[(iInd-1)*_nDofsPerNode+jInd-1]=1;
                 }
             }
         }
     }
+    blockelmtids.clear();
+
+    // the gauss point loop is shared by all the sub-elements of one bulk element, so the [elmt] blocks
+    // on the same element must use the same quadrature
+    int jblock;
+    for(e=1;e<=_nBulkElmts;e++){
+        iblock=GetBulkMeshIthBulkElmtQpBlockID(e);
+        for(j=2;j<=GetBulkMeshIthBulkElmtSubElmtsNum(e);j++){
+            jblock=GetBulkMeshIthBulkElmtJthSubElmtBlockID(e,j);
+            if(_ElmtBlockQpOrderList[iblock-1]!=_ElmtBlockQpOrderList[jblock-1]||
+               _ElmtBlockReducedIntList[iblock-1]!=_ElmtBlockReducedIntList[jblock-1]){
+                str="["+elmtSystem.GetIthBulkElmtBlock(iblock)._ElmtBlockName+"] and ["
+                   +elmtSystem.GetIthBulkElmtBlock(jblock)._ElmtBlockName
+                   +"] are applied to the same elements with different 'qporder=' or 'integration=' options, please check your [elmts] block";
+                MessagePrinter::PrintErrorTxt(str);
+                MessagePrinter::AsFem_Exit();
+            }
+        }
+    }
+
+    // the nodes are numbered in the renumbered order(the identity one if no renumbering is used)
+    CreateNodesRenumberMap(mesh);
 
     // now we can account for the active dofs
     _nActiveDofs=0;
-    for(i=1;i<=_nNodes;i++){
+    for(const auto &i:_NodesOrder){
         for(j=1;j<=_nDofsPerNode;j++){
-            if(_NodalDofFlag[i-1][j-1]>0.0){
+            if(_NodalDofFlag[(i-1)*_nDofsPerNode+j-1]>0){
                 _nActiveDofs+=1;
-                _NodeDofsMap[i-1][j-1]=_nActiveDofs;
+                _NodeDofsMap[(i-1)*_nDofsPerNode+j-1]=_nActiveDofs;
             }
         }
     }
@@ -171,7 +209,7 @@ void BulkDofHandler::CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,E
                     for(i=1;i<=mesh.GetBulkMeshIthElmtNodesNum(e);i++){
                         iInd=mesh.GetBulkMeshIthElmtJthNodeID(e,i);
                         for(const auto &dofid:bcBlock._DofIDs){
-                            _NodalDofFlag[iInd-1][dofid-1]=0.0;
+                            _NodalDofFlag[(iInd-1)*_nDofsPerNode+dofid-1]=0;
                         }
                     }
                 }
@@ -181,7 +219,7 @@ void BulkDofHandler::CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,E
             for(auto bc:bcBlock._BoundaryNameList){
                 for(auto i:mesh.GetBulkMeshNodeIDsViaPhysicalName(bc)){
                     for(const auto &dofid:bcBlock._DofIDs){
-                        _NodalDofFlag[i-1][dofid-1]=0.0;
+                        _NodalDofFlag[(i-1)*_nDofsPerNode+dofid-1]=0;
                     }
                 }
             }
@@ -191,43 +229,32 @@ void BulkDofHandler::CreateBulkMeshDofsMap(const Mesh &mesh,BCSystem &bcSystem,E
         }
     }
 
-    // now we remove all the empty space of some vectors
+    // now we create the flat element dofs map, only the used dofs of each element are stored
     _RowNNZ.resize(_nActiveDofs,0);
     _RowMaxNNZ=0;
+    _BulkElmtDofsOffset.assign(_nBulkElmts+1,0);
+    _BulkElmtDofsMap.clear();
+    _BulkElmtDofFlag.clear();
+    _BulkElmtDofsMap.reserve(static_cast<size_t>(_nBulkElmts)*_nMaxDofsPerElmt);
+    _BulkElmtDofFlag.reserve(static_cast<size_t>(_nBulkElmts)*_nMaxDofsPerElmt);
     for(e=1;e<=_nBulkElmts;e++){
         for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
             iInd=mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j);
             for(k=1;k<=_nDofsPerNode;k++){
-                ii=(j-1)*_nDofsPerNode+k-1;
-
-                if(_NodalDofFlag[iInd-1][k-1]>=0.0){
-                    _BulkElmtDofsMap[e-1][ii]=_NodeDofsMap[iInd-1][k-1];
-                    _RowNNZ[_NodeDofsMap[iInd-1][k-1]-1]+=_nMaxDofsPerElmt;
-
-                    if(_RowNNZ[_NodeDofsMap[iInd-1][k-1]-1]>_RowMaxNNZ){
-                        _RowMaxNNZ=_RowNNZ[_NodeDofsMap[iInd-1][k-1]-1];
-                    }
-                    if(_NodalDofFlag[iInd-1][k-1]>0.0){
-                        _BulkElmtDofFlag[e-1][ii]=1.0;
-                    }
-                    else if(_NodalDofFlag[iInd-1][k-1]==0.0){
-                        _BulkElmtDofFlag[e-1][ii]=0.0;
+                ii=(iInd-1)*_nDofsPerNode+k-1;
+                if(_NodalDofFlag[ii]>=0){
+                    _BulkElmtDofsMap.push_back(_NodeDofsMap[ii]);
+                    _BulkElmtDofFlag.push_back(_NodalDofFlag[ii]>0?1:0);
+                    _RowNNZ[_NodeDofsMap[ii]-1]+=_nMaxDofsPerElmt;
+                    if(_RowNNZ[_NodeDofsMap[ii]-1]>_RowMaxNNZ){
+                        _RowMaxNNZ=_RowNNZ[_NodeDofsMap[ii]-1];
                     }
                 }
             }
         }
-        // remove the zero element space
-        _BulkElmtDofFlag[e-1].erase(
-            remove(_BulkElmtDofFlag[e-1].begin(),_BulkElmtDofFlag[e-1].end(),-1.0),
-            _BulkElmtDofFlag[e-1].end()
-        );
-        _BulkElmtDofFlag[e-1].shrink_to_fit();
-
-        _BulkElmtDofsMap[e-1].erase(
-            remove(_BulkElmtDofsMap[e-1].begin(),_BulkElmtDofsMap[e-1].end(),-1),
-            _BulkElmtDofsMap[e-1].end()
-        );
-        _BulkElmtDofsMap[e-1].shrink_to_fit();
+        _BulkElmtDofsOffset[e]=static_cast<int>(_BulkElmtDofsMap.size());
     }
+    _BulkElmtDofsMap.shrink_to_fit();
+    _BulkElmtDofFlag.shrink_to_fit();
 
 }
@@ -0,0 +1,246 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.24
+//+++ Purpose: Renumber the nodes of the bulk mesh before the dofs
+//+++          map is created, the reverse Cuthill-McKee(RCM) and the
+//+++          Morton space filling curve(SFC) are supported. Only the
+//+++          dofs index and the element loop order are changed, the
+//+++          node and element id of the mesh remain the same
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+
+#include "DofHandler/BulkDofHandler.h"
+
+//*********************************************************
+//*** spread the lower 21 bits of x, two zero bits are inserted
+//*** between every two bits, this is used by the 3d morton key
+//*********************************************************
+static uint64_t SpreadBitsBy2(uint64_t x){
+    x&=0x1fffff;
+    x=(x|(x<<32))&0x1f00000000ffffULL;
+    x=(x|(x<<16))&0x1f0000ff0000ffULL;
+    x=(x|(x<< 8))&0x100f00f00f00f00fULL;
+    x=(x|(x<< 4))&0x10c30c30c30c30c3ULL;
+    x=(x|(x<< 2))&0x1249249249249249ULL;
+    return x;
+}
+
+//*********************************************************
+void BulkDofHandler::CreateNodesRenumberMap(const Mesh &mesh){
+    int i,j,e,iInd;
+
+    _NodesOrder.resize(_nNodes);
+    _BulkElmtLoopOrder.resize(_nBulkElmts);
+    iota(_NodesOrder.begin(),_NodesOrder.end(),1);
+    iota(_BulkElmtLoopOrder.begin(),_BulkElmtLoopOrder.end(),1);
+
+    _BandwidthOld=0;_BandwidthNew=0;
+    _ProfileOld=0;_ProfileNew=0;
+    if(_DofRenumberType==DofRenumberType::NONE) return;
+
+    // the node->bulk element connectivity in CSR format, the node graph is never stored,
+    // the neighbours of one node are collected from its elements on the fly
+    vector<int> node2elmtoffset(_nNodes+1,0),node2elmt;
+    for(e=1;e<=_nBulkElmts;e++){
+        for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
+            node2elmtoffset[mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j)]+=1;
+        }
+    }
+    for(i=1;i<=_nNodes;i++) node2elmtoffset[i]+=node2elmtoffset[i-1];
+    node2elmt.resize(node2elmtoffset[_nNodes]);
+    vector<int> fill(node2elmtoffset.begin(),node2elmtoffset.end()-1);
+    for(e=1;e<=_nBulkElmts;e++){
+        for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
+            iInd=mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j);
+            node2elmt[fill[iInd-1]]=e;
+            fill[iInd-1]+=1;
+        }
+    }
+
+    vector<int> nodeindex(_nNodes);
+    iota(nodeindex.begin(),nodeindex.end(),1);
+    GetNodesGraphBandwidth(mesh,nodeindex,_BandwidthOld,_ProfileOld);
+
+    if(_DofRenumberType==DofRenumberType::RCM){
+        CreateRCMNodesOrder(mesh,node2elmtoffset,node2elmt);
+    }
+    else if(_DofRenumberType==DofRenumberType::SFC){
+        CreateSFCNodesOrder(mesh,node2elmtoffset);
+    }
+
+    // nodeindex[old-1] is the new index(start from 1) of the old node
+    for(i=1;i<=_nNodes;i++) nodeindex[_NodesOrder[i-1]-1]=i;
+    GetNodesGraphBandwidth(mesh,nodeindex,_BandwidthNew,_ProfileNew);
+
+    // the elements are visited in the order of their smallest new node index, so the
+    // assembly touches the rows of the system matrix (almost) continuously
+    vector<int> elmtkey(_nBulkElmts,0);
+    for(e=1;e<=_nBulkElmts;e++){
+        elmtkey[e-1]=_nNodes+1;
+        for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
+            iInd=nodeindex[mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j)-1];
+            if(iInd<elmtkey[e-1]) elmtkey[e-1]=iInd;
+        }
+    }
+    stable_sort(_BulkElmtLoopOrder.begin(),_BulkElmtLoopOrder.end(),
+                [&elmtkey](const int &a,const int &b){return elmtkey[a-1]<elmtkey[b-1];});
+}
+
+//*********************************************************
+void BulkDofHandler::CreateRCMNodesOrder(const Mesh &mesh,const vector<int> &node2elmtoffset,const vector<int> &node2elmt){
+    // the degree of one node is estimated by the number of its connected elements
+    auto Degree=[&node2elmtoffset](const int &i){return node2elmtoffset[i]-node2elmtoffset[i-1];};
+
+    vector<int> visited(_nNodes,0);// the stamp of the last visit
+    int stamp=0;
+    vector<int> queue,neighbours;
+    queue.reserve(_nNodes);
+
+    // the breadth first search from the root node, if order is true, the neighbours
+    // are visited in the ascending order of their degree(the Cuthill-McKee order)
+    auto BFS=[&](const int &root,const bool &order,vector<int> &levelnodes)->int{
+        int head,levelend,nlevels,i,j,k,e,iInd;
+        stamp+=1;
+        queue.clear();
+        queue.push_back(root);visited[root-1]=stamp;
+        head=0;nlevels=0;
+        while(head<static_cast<int>(queue.size())){
+            levelend=static_cast<int>(queue.size());
+            levelnodes.assign(queue.begin()+head,queue.end());
+            nlevels+=1;
+            for(;head<levelend;head++){
+                i=queue[head];
+                neighbours.clear();
+                for(k=node2elmtoffset[i-1];k<node2elmtoffset[i];k++){
+                    e=node2elmt[k];
+                    for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
+                        iInd=mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j);
+                        if(visited[iInd-1]!=stamp){
+                            visited[iInd-1]=stamp;
+                            neighbours.push_back(iInd);
+                        }
+                    }
+                }
+                if(order){
+                    stable_sort(neighbours.begin(),neighbours.end(),
+                                [&Degree](const int &a,const int &b){return Degree(a)<Degree(b);});
+                }
+                queue.insert(queue.end(),neighbours.begin(),neighbours.end());
+            }
+        }
+        return nlevels;
+    };
+
+    vector<bool> numbered(_nNodes,false);
+    vector<int> levelnodes;
+    int root,candidate,nlevels,newlevels,iter;
+    _NodesOrder.clear();
+    for(int start=1;start<=_nNodes;start++){
+        if(numbered[start-1]) continue;
+        if(Degree(start)==0){
+            // the isolated node(not used by any bulk element)
+            numbered[start-1]=true;
+            _NodesOrder.push_back(start);
+            continue;
+        }
+        // the pseudo-peripheral node of the current component(George-Liu), a few
+        // sweeps are enough, since only a good start node is required
+        root=start;
+        nlevels=BFS(root,false,levelnodes);
+        for(iter=0;iter<5;iter++){
+            candidate=levelnodes[0];
+            for(const auto &it:levelnodes){
+                if(Degree(it)<Degree(candidate)) candidate=it;
+            }
+            newlevels=BFS(candidate,false,levelnodes);
+            if(newlevels<=nlevels) break;
+            root=candidate;nlevels=newlevels;
+        }
+        BFS(root,true,levelnodes);
+        for(const auto &it:queue){
+            numbered[it-1]=true;
+        }
+        // the reverse of the Cuthill-McKee order of the current component
+        _NodesOrder.insert(_NodesOrder.end(),queue.rbegin(),queue.rend());
+    }
+}
+
+//*********************************************************
+void BulkDofHandler::CreateSFCNodesOrder(const Mesh &mesh,const vector<int> &node2elmtoffset){
+    int i,j;
+    double xmin[3],xmax[3],x;
+    for(j=0;j<3;j++){
+        xmin[j]=1.0e16;xmax[j]=-1.0e16;
+    }
+    for(i=1;i<=_nNodes;i++){
+        for(j=1;j<=3;j++){
+            x=mesh.GetBulkMeshIthNodeJthCoord(i,j);
+            if(x<xmin[j-1]) xmin[j-1]=x;
+            if(x>xmax[j-1]) xmax[j-1]=x;
+        }
+    }
+
+    // the morton key of each node, the coordinates are scaled to [0,2^21-1] in the bounding box
+    const double maxkey=2097151.0;
+    vector<uint64_t> keys(_nNodes,0);
+    uint64_t key,ix;
+    for(i=1;i<=_nNodes;i++){
+        key=0;
+        for(j=1;j<=3;j++){
+            if(xmax[j-1]-xmin[j-1]>1.0e-15){
+                x=(mesh.GetBulkMeshIthNodeJthCoord(i,j)-xmin[j-1])/(xmax[j-1]-xmin[j-1]);
+            }
+            else{
+                x=0.0;
+            }
+            ix=static_cast<uint64_t>(x*maxkey);
+            key|=SpreadBitsBy2(ix)<<(j-1);
+        }
+        keys[i-1]=key;
+    }
+    // the isolated nodes are put at the end
+    stable_sort(_NodesOrder.begin(),_NodesOrder.end(),
+                [&](const int &a,const int &b){
+                    bool aIsolated=(node2elmtoffset[a]==node2elmtoffset[a-1]);
+                    bool bIsolated=(node2elmtoffset[b]==node2elmtoffset[b-1]);
+                    if(aIsolated!=bIsolated) return bIsolated;
+                    return keys[a-1]<keys[b-1];
+                });
+}
+
+//*********************************************************
+void BulkDofHandler::GetNodesGraphBandwidth(const Mesh &mesh,const vector<int> &nodeindex,int &bandwidth,long long &profile)const{
+    // two nodes are connected if they share one bulk element, thus the bandwidth of the
+    // node graph is the max index range within one element, and the profile is the sum
+    // of the distance between each node and its farthest lower neighbour
+    int e,j,iInd,imin,imax;
+    vector<int> lowest(_nNodes,0);
+    for(j=0;j<_nNodes;j++) lowest[j]=j+1;
+    bandwidth=0;
+    for(e=1;e<=_nBulkElmts;e++){
+        imin=_nNodes+1;imax=0;
+        for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
+            iInd=nodeindex[mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j)-1];
+            if(iInd<imin) imin=iInd;
+            if(iInd>imax) imax=iInd;
+        }
+        if(imax-imin>bandwidth) bandwidth=imax-imin;
+        for(j=1;j<=mesh.GetBulkMeshIthBulkElmtNodesNum(e);j++){
+            iInd=nodeindex[mesh.GetBulkMeshIthBulkElmtJthNodeID(e,j)-1];
+            if(imin<lowest[iInd-1]) lowest[iInd-1]=imin;
+        }
+    }
+    profile=0;
+    for(j=1;j<=_nNodes;j++) profile+=static_cast<long long>(j-lowest[j-1]);
+}
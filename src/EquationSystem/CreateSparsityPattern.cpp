@@ -33,7 +33,7 @@ void EquationSystem::CreateSparsityPattern(DofHandler &dofHandler){
     localK.resize(nDofs*nDofs,0.0);
     
     for(int e=eStart;e<eEnd;++e){
-        dofHandler.GetBulkMeshIthBulkElmtDofIndex0(e+1,elDofs,localK);
+        dofHandler.GetBulkMeshIthBulkElmtDofIndex0(e+1,elDofs);
         nDofs=dofHandler.GetBulkMeshIthBulkElmtDofsNum(e+1);
         MatSetValues(_AMATRIX,nDofs,elDofs.data(),nDofs,elDofs.data(),localK.data(),ADD_VALUES);
     }
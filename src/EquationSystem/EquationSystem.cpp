@@ -14,9 +14,12 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "EquationSystem/EquationSystem.h"
+#include "Utils/MemoryUsage.h"
 
 EquationSystem::EquationSystem(){
     _nDofs=0;
+    _AMATRIX=NULL;
+    _RHS=NULL;
 }
 //**************************************************
 void EquationSystem::InitEquationSystem(const int &ndofs,const int &maxrownnz){
@@ -40,6 +43,10 @@ void EquationSystem::InitEquationSystem(const int &ndofs,const int &maxrownnz){
     MatSetOption(_AMATRIX,MAT_NEW_NONZERO_ALLOCATION_ERR,PETSC_FALSE);
 }
 //*********************************************************************************
+double EquationSystem::GetMemoryUsage()const{
+    return MemoryUsage::Of(_AMATRIX)+MemoryUsage::Of(_RHS);
+}
+//*********************************************************************************
 
 void EquationSystem::ReleaseMem(){
     MatDestroy(&_AMATRIX);
@@ -67,12 +67,46 @@ void FE::CreateQPoints(Mesh &mesh){
             _LineQPoint.SetDim(1);
             _LineQPoint.CreateQpoints(mesh.GetBulkMeshLineElmtType());
         }
+        _nMaxBulkQpPoints=_BulkQPoint.GetQpPointsNum();
+        _BulkKernel.Init(GetDim(),mesh.GetBulkMeshBulkElmtType(),_BulkQPoint);
     }
     else{
         MessagePrinter::PrintErrorTxt("can\'t create qpoints for FE space, the dim has not been given yet");
         MessagePrinter::AsFem_Exit();
     }
 }
+//******************************************************
+void FE::CreateBlockBulkQPoints(Mesh &mesh,const vector<int> &qporders,const vector<bool> &reducedflags){
+    _BlockBulkQPoints.resize(qporders.size());
+    _BlockBulkKernels.resize(qporders.size());
+    _nMaxBulkQpPoints=_BulkQPoint.GetQpPointsNum();
+    for(int i=0;i<static_cast<int>(qporders.size());i++){
+        if(reducedflags[i]){
+            // the one-point rule is only stable for the bi/tri-linear element with the hourglass control
+            if(mesh.GetBulkMeshBulkElmtType()!=MeshType::QUAD4&&mesh.GetBulkMeshBulkElmtType()!=MeshType::HEX8){
+                MessagePrinter::PrintErrorTxt("the reduced integration is only supported for quad4 and hex8 mesh, please check your [elmts] block");
+                MessagePrinter::AsFem_Exit();
+            }
+            _BlockBulkQPoints[i].SetQPointType(QPointType::GAUSSLEGENDRE);
+            _BlockBulkQPoints[i].SetQPointOrder(1);
+            _BlockBulkQPoints[i].SetDim(GetDim());
+            _BlockBulkQPoints[i].CreateQpoints(mesh.GetBulkMeshBulkElmtType());
+        }
+        else if(qporders[i]>0&&qporders[i]!=_BulkQPoint.GetQpOrder()){
+            _BlockBulkQPoints[i].SetQPointType(_BulkQPoint.GetQpPointType());
+            _BlockBulkQPoints[i].SetQPointOrder(qporders[i]);
+            _BlockBulkQPoints[i].SetDim(GetDim());
+            _BlockBulkQPoints[i].CreateQpoints(mesh.GetBulkMeshBulkElmtType());
+        }
+        else{
+            _BlockBulkQPoints[i]=_BulkQPoint;
+        }
+        if(_BlockBulkQPoints[i].GetQpPointsNum()>_nMaxBulkQpPoints){
+            _nMaxBulkQpPoints=_BlockBulkQPoints[i].GetQpPointsNum();
+        }
+        _BlockBulkKernels[i].Init(GetDim(),mesh.GetBulkMeshBulkElmtType(),_BlockBulkQPoints[i]);
+    }
+}
 //**************************************************************************
 //*** for shape function related functions
 //**************************************************************************
@@ -141,5 +175,15 @@ void FE::PrintFEInfo()const{
            +", num of qpoints="+to_string(_SurfaceQPoint.GetQpPointsNum());
         MessagePrinter::PrintNormalTxt(msg);
     }
+    for(int i=0;i<static_cast<int>(_BlockBulkQPoints.size());i++){
+        if(_BlockBulkQPoints[i].GetQpPointsNum()!=_BulkQPoint.GetQpPointsNum()){
+            msg="  for elmt block-"+to_string(i+1)+": order="+to_string(_BlockBulkQPoints[i].GetQpOrder())
+               +", num of qpoints="+to_string(_BlockBulkQPoints[i].GetQpPointsNum());
+            MessagePrinter::PrintNormalTxt(msg);
+        }
+    }
+    if(_BulkKernel.IsActive()){
+        MessagePrinter::PrintNormalTxt("  sum-factorization is used for the tensor-product bulk elements");
+    }
     MessagePrinter::PrintDashLine();
 }
\ No newline at end of file
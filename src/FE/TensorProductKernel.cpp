@@ -0,0 +1,381 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.02
+//+++ Purpose: the sum-factorization kernel for the tensor-product
+//+++          lagrange elements, i.e. quad4,quad9,hex8 and hex27
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "FE/TensorProductKernel.h"
+
+#include <algorithm>
+
+TensorProductKernel::TensorProductKernel(){
+    _IsActive=false;
+    _nDim=0;
+    _n1DNodes=0;_n1DQpPoints=0;
+    _nNodes=0;_nQpPoints=0;
+}
+//*****************************************************************
+bool TensorProductKernel::Init(const int &dim,const MeshType &meshtype,const QPoint &qpoint){
+    // the natural coordinates of each node, the node order is the same as the one in the shape functions
+    // the quad4/hex8 ones are the first 4/8 nodes of quad9/hex27
+    const static int quad9[9][2]={{-1,-1},{ 1,-1},{ 1, 1},{-1, 1},
+                                  { 0,-1},{ 1, 0},{ 0, 1},{-1, 0},{ 0, 0}};
+    const static int hex27[27][3]={{-1,-1,-1},{ 1,-1,-1},{ 1, 1,-1},{-1, 1,-1},
+                                   {-1,-1, 1},{ 1,-1, 1},{ 1, 1, 1},{-1, 1, 1},
+                                   { 0,-1,-1},{ 1, 0,-1},{ 0, 1,-1},{-1, 0,-1},
+                                   { 0,-1, 1},{ 1, 0, 1},{ 0, 1, 1},{-1, 0, 1},
+                                   {-1,-1, 0},{ 1,-1, 0},{ 1, 1, 0},{-1, 1, 0},
+                                   {-1, 0, 0},{ 1, 0, 0},{ 0,-1, 0},{ 0, 1, 0},
+                                   { 0, 0,-1},{ 0, 0, 1},{ 0, 0, 0}};
+    const double tol=1.0e-12;
+    int p,a,b,q,i,j,k,l;
+    double x,val,dval,term;
+    vector<double> xnodes,xqp;
+    vector<bool> used;
+
+    _IsActive=false;
+    _nDim=dim;
+    if(dim==2&&meshtype==MeshType::QUAD4){
+        p=1;
+    }
+    else if(dim==2&&meshtype==MeshType::QUAD9){
+        p=2;
+    }
+    else if(dim==3&&meshtype==MeshType::HEX8){
+        p=1;
+    }
+    else if(dim==3&&meshtype==MeshType::HEX27){
+        p=2;
+    }
+    else{
+        // the serendipity and simplex elements are not tensor-product ones
+        return false;
+    }
+    _n1DNodes=p+1;
+    _nNodes=(dim==2)?_n1DNodes*_n1DNodes:_n1DNodes*_n1DNodes*_n1DNodes;
+
+    // the node map from current node order to the lexicographic one
+    _NodeLex.resize(_nNodes);
+    for(a=0;a<_nNodes;a++){
+        if(dim==2){
+            i=(quad9[a][0]+1)*p/2;j=(quad9[a][1]+1)*p/2;
+            _NodeLex[a]=i+_n1DNodes*j;
+        }
+        else{
+            i=(hex27[a][0]+1)*p/2;j=(hex27[a][1]+1)*p/2;k=(hex27[a][2]+1)*p/2;
+            _NodeLex[a]=i+_n1DNodes*(j+_n1DNodes*k);
+        }
+    }
+
+    // the 1D gauss points are recovered from the tensor-product ones, so both the Gauss-Legendre and
+    // Gauss-Lobatto points can be used, no matter which loop order is used to create them
+    _nQpPoints=qpoint.GetQpPointsNum();
+    xqp.clear();
+    for(q=1;q<=_nQpPoints;q++){
+        x=qpoint.GetIthQpPointJthCoord(q,1);
+        for(l=0;l<static_cast<int>(xqp.size());l++){
+            if(std::abs(xqp[l]-x)<tol) break;
+        }
+        if(l==static_cast<int>(xqp.size())) xqp.push_back(x);
+    }
+    std::sort(xqp.begin(),xqp.end());
+    _n1DQpPoints=static_cast<int>(xqp.size());
+    if((dim==2&&_n1DQpPoints*_n1DQpPoints!=_nQpPoints)||
+       (dim==3&&_n1DQpPoints*_n1DQpPoints*_n1DQpPoints!=_nQpPoints)){
+        return false;
+    }
+    _QpLex.resize(_nQpPoints);
+    used.assign(_nQpPoints,false);
+    for(q=1;q<=_nQpPoints;q++){
+        l=0;
+        for(j=dim;j>=1;j--){
+            x=qpoint.GetIthQpPointJthCoord(q,j);
+            for(i=0;i<_n1DQpPoints;i++){
+                if(std::abs(xqp[i]-x)<tol) break;
+            }
+            if(i==_n1DQpPoints) return false;
+            l=l*_n1DQpPoints+i;
+        }
+        if(used[l]) return false;
+        used[l]=true;
+        _QpLex[q-1]=l;
+    }
+
+    // the 1D lagrange basis on the equally spaced nodes
+    xnodes.resize(_n1DNodes);
+    for(a=0;a<_n1DNodes;a++) xnodes[a]=-1.0+2.0*a/p;
+    _B.resize(_n1DQpPoints*_n1DNodes);
+    _D.resize(_n1DQpPoints*_n1DNodes);
+    for(q=0;q<_n1DQpPoints;q++){
+        x=xqp[q];
+        for(a=0;a<_n1DNodes;a++){
+            val=1.0;dval=0.0;
+            for(b=0;b<_n1DNodes;b++){
+                if(b==a) continue;
+                term=1.0/(xnodes[a]-xnodes[b]);
+                dval=dval*(x-xnodes[b])*term+val*term;
+                val*=(x-xnodes[b])*term;
+            }
+            _B[q*_n1DNodes+a]=val;
+            _D[q*_n1DNodes+a]=dval;
+        }
+    }
+
+    _DetJac.resize(_nQpPoints,0.0);
+    _XJac.resize(_nQpPoints*9,0.0);
+    _QpCoords.resize(_nQpPoints*3,0.0);
+    _ULex.resize(_nNodes,0.0);
+    _VLex.resize(_nQpPoints,0.0);
+    _GLex.resize(_nQpPoints*3,0.0);
+    k=std::max(_n1DNodes,_n1DQpPoints);
+    _Tmp1.resize(3*k*k*k,0.0);
+    _Tmp2.resize(3*k*k*k,0.0);
+
+    _IsActive=true;
+    return true;
+}
+//*****************************************************************
+bool TensorProductKernel::CalcGeometry(const Nodes &elNodes){
+    int a,q,l,c,r;
+    double *J,det,inv[9];
+
+    for(c=1;c<=3;c++){
+        for(a=0;a<_nNodes;a++) _ULex[_NodeLex[a]]=elNodes(a+1,c);
+        InterpolateReference(_ULex.data(),_VLex.data(),_GLex.data());
+        for(q=0;q<_nQpPoints;q++){
+            l=_QpLex[q];
+            _QpCoords[q*3+c-1]=_VLex[l];
+            if(c>_nDim) continue;
+            // Jac(r,c)=dx_c/dxi_r, it is stored in _XJac and will be inverted in-place
+            for(r=1;r<=_nDim;r++) _XJac[q*9+(r-1)*3+c-1]=_GLex[l*3+r-1];
+        }
+    }
+    for(q=0;q<_nQpPoints;q++){
+        J=&_XJac[q*9];
+        if(_nDim==2){
+            det=J[0]*J[4]-J[1]*J[3];
+            if(det<=0.0) return false;
+            inv[0]= J[4]/det;inv[1]=-J[1]/det;
+            inv[3]=-J[3]/det;inv[4]= J[0]/det;
+            J[0]=inv[0];J[1]=inv[1];J[3]=inv[3];J[4]=inv[4];
+        }
+        else{
+            det=J[0]*(J[4]*J[8]-J[5]*J[7])
+               -J[1]*(J[3]*J[8]-J[5]*J[6])
+               +J[2]*(J[3]*J[7]-J[4]*J[6]);
+            if(det<=0.0) return false;
+            inv[0]= (J[4]*J[8]-J[5]*J[7])/det;
+            inv[1]=-(J[1]*J[8]-J[2]*J[7])/det;
+            inv[2]= (J[1]*J[5]-J[2]*J[4])/det;
+            inv[3]=-(J[3]*J[8]-J[5]*J[6])/det;
+            inv[4]= (J[0]*J[8]-J[2]*J[6])/det;
+            inv[5]=-(J[0]*J[5]-J[2]*J[3])/det;
+            inv[6]= (J[3]*J[7]-J[4]*J[6])/det;
+            inv[7]=-(J[0]*J[7]-J[1]*J[6])/det;
+            inv[8]= (J[0]*J[4]-J[1]*J[3])/det;
+            for(r=0;r<9;r++) J[r]=inv[r];
+        }
+        _DetJac[q]=det;
+    }
+    return true;
+}
+//*****************************************************************
+void TensorProductKernel::Interpolate(const double *nodal,const int &stride,double *val,Vector3d *grad){
+    int a,q,l,c,r;
+    for(a=0;a<_nNodes;a++) _ULex[_NodeLex[a]]=nodal[a*stride];
+    InterpolateReference(_ULex.data(),_VLex.data(),_GLex.data());
+    for(q=0;q<_nQpPoints;q++){
+        l=_QpLex[q];
+        val[q]=_VLex[l];
+        grad[q](1)=0.0;grad[q](2)=0.0;grad[q](3)=0.0;
+        for(c=1;c<=_nDim;c++){
+            for(r=1;r<=_nDim;r++) grad[q](c)+=_XJac[q*9+(c-1)*3+r-1]*_GLex[l*3+r-1];
+        }
+    }
+}
+//*****************************************************************
+void TensorProductKernel::Integrate(const double *val,const Vector3d *grad,const int &stride,double *nodal){
+    int a,q,l,c,r;
+    for(q=0;q<_nQpPoints;q++){
+        l=_QpLex[q];
+        _VLex[l]=val[q];
+        // grad(N).f=grad_xi(N).(XJac^T.f)
+        for(r=1;r<=3;r++){
+            _GLex[l*3+r-1]=0.0;
+            if(r>_nDim) continue;
+            for(c=1;c<=_nDim;c++) _GLex[l*3+r-1]+=_XJac[q*9+(c-1)*3+r-1]*grad[q](c);
+        }
+    }
+    IntegrateReference(_VLex.data(),_GLex.data(),_ULex.data());
+    for(a=0;a<_nNodes;a++) nodal[a*stride]+=_ULex[_NodeLex[a]];
+}
+//*****************************************************************
+void TensorProductKernel::InterpolateReference(const double *ulex,double *vlex,double *glex){
+    const int n=_n1DNodes,m=_n1DQpPoints;
+    int ai,aj,ak,qi,qj,qk,l;
+    double s0,s1,s2,s3;
+    double *T1v,*T1d,*T2v,*T2x,*T2y;
+
+    if(_nDim==2){
+        // contract the xi direction: T1[qi+m*aj]
+        T1v=_Tmp1.data();T1d=_Tmp1.data()+m*n;
+        for(aj=0;aj<n;aj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;
+                for(ai=0;ai<n;ai++){
+                    s0+=_B[qi*n+ai]*ulex[ai+n*aj];
+                    s1+=_D[qi*n+ai]*ulex[ai+n*aj];
+                }
+                T1v[qi+m*aj]=s0;T1d[qi+m*aj]=s1;
+            }
+        }
+        // contract the eta direction
+        for(qj=0;qj<m;qj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;s2=0.0;
+                for(aj=0;aj<n;aj++){
+                    s0+=_B[qj*n+aj]*T1v[qi+m*aj];
+                    s1+=_B[qj*n+aj]*T1d[qi+m*aj];
+                    s2+=_D[qj*n+aj]*T1v[qi+m*aj];
+                }
+                l=qi+m*qj;
+                vlex[l]=s0;
+                glex[l*3+0]=s1;glex[l*3+1]=s2;glex[l*3+2]=0.0;
+            }
+        }
+        return;
+    }
+
+    // contract the xi direction: T1[qi+m*(aj+n*ak)]
+    T1v=_Tmp1.data();T1d=_Tmp1.data()+m*n*n;
+    for(ak=0;ak<n;ak++){
+        for(aj=0;aj<n;aj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;
+                for(ai=0;ai<n;ai++){
+                    s0+=_B[qi*n+ai]*ulex[ai+n*(aj+n*ak)];
+                    s1+=_D[qi*n+ai]*ulex[ai+n*(aj+n*ak)];
+                }
+                T1v[qi+m*(aj+n*ak)]=s0;T1d[qi+m*(aj+n*ak)]=s1;
+            }
+        }
+    }
+    // contract the eta direction: T2[qi+m*(qj+m*ak)]
+    T2v=_Tmp2.data();T2x=_Tmp2.data()+m*m*n;T2y=_Tmp2.data()+2*m*m*n;
+    for(ak=0;ak<n;ak++){
+        for(qj=0;qj<m;qj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;s2=0.0;
+                for(aj=0;aj<n;aj++){
+                    s0+=_B[qj*n+aj]*T1v[qi+m*(aj+n*ak)];
+                    s1+=_B[qj*n+aj]*T1d[qi+m*(aj+n*ak)];
+                    s2+=_D[qj*n+aj]*T1v[qi+m*(aj+n*ak)];
+                }
+                T2v[qi+m*(qj+m*ak)]=s0;T2x[qi+m*(qj+m*ak)]=s1;T2y[qi+m*(qj+m*ak)]=s2;
+            }
+        }
+    }
+    // contract the zeta direction
+    for(qk=0;qk<m;qk++){
+        for(qj=0;qj<m;qj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;s2=0.0;s3=0.0;
+                for(ak=0;ak<n;ak++){
+                    s0+=_B[qk*n+ak]*T2v[qi+m*(qj+m*ak)];
+                    s1+=_B[qk*n+ak]*T2x[qi+m*(qj+m*ak)];
+                    s2+=_B[qk*n+ak]*T2y[qi+m*(qj+m*ak)];
+                    s3+=_D[qk*n+ak]*T2v[qi+m*(qj+m*ak)];
+                }
+                l=qi+m*(qj+m*qk);
+                vlex[l]=s0;
+                glex[l*3+0]=s1;glex[l*3+1]=s2;glex[l*3+2]=s3;
+            }
+        }
+    }
+}
+//*****************************************************************
+void TensorProductKernel::IntegrateReference(const double *vlex,const double *glex,double *ulex){
+    const int n=_n1DNodes,m=_n1DQpPoints;
+    int ai,aj,ak,qi,qj,qk,l;
+    double s0,s1,s2;
+    double *T1v,*T1d,*T2v,*T2x,*T2y;
+
+    if(_nDim==2){
+        // the transpose of the eta contraction
+        T1v=_Tmp1.data();T1d=_Tmp1.data()+m*n;
+        for(aj=0;aj<n;aj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;
+                for(qj=0;qj<m;qj++){
+                    l=qi+m*qj;
+                    s0+=_B[qj*n+aj]*vlex[l]+_D[qj*n+aj]*glex[l*3+1];
+                    s1+=_B[qj*n+aj]*glex[l*3+0];
+                }
+                T1v[qi+m*aj]=s0;T1d[qi+m*aj]=s1;
+            }
+        }
+        // the transpose of the xi contraction
+        for(aj=0;aj<n;aj++){
+            for(ai=0;ai<n;ai++){
+                s0=0.0;
+                for(qi=0;qi<m;qi++){
+                    s0+=_B[qi*n+ai]*T1v[qi+m*aj]+_D[qi*n+ai]*T1d[qi+m*aj];
+                }
+                ulex[ai+n*aj]=s0;
+            }
+        }
+        return;
+    }
+
+    // the transpose of the zeta contraction: T2[qi+m*(qj+m*ak)]
+    T2v=_Tmp2.data();T2x=_Tmp2.data()+m*m*n;T2y=_Tmp2.data()+2*m*m*n;
+    for(ak=0;ak<n;ak++){
+        for(qj=0;qj<m;qj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;s2=0.0;
+                for(qk=0;qk<m;qk++){
+                    l=qi+m*(qj+m*qk);
+                    s0+=_B[qk*n+ak]*vlex[l]+_D[qk*n+ak]*glex[l*3+2];
+                    s1+=_B[qk*n+ak]*glex[l*3+0];
+                    s2+=_B[qk*n+ak]*glex[l*3+1];
+                }
+                T2v[qi+m*(qj+m*ak)]=s0;T2x[qi+m*(qj+m*ak)]=s1;T2y[qi+m*(qj+m*ak)]=s2;
+            }
+        }
+    }
+    // the transpose of the eta contraction: T1[qi+m*(aj+n*ak)]
+    T1v=_Tmp1.data();T1d=_Tmp1.data()+m*n*n;
+    for(ak=0;ak<n;ak++){
+        for(aj=0;aj<n;aj++){
+            for(qi=0;qi<m;qi++){
+                s0=0.0;s1=0.0;
+                for(qj=0;qj<m;qj++){
+                    s0+=_B[qj*n+aj]*T2v[qi+m*(qj+m*ak)]+_D[qj*n+aj]*T2y[qi+m*(qj+m*ak)];
+                    s1+=_B[qj*n+aj]*T2x[qi+m*(qj+m*ak)];
+                }
+                T1v[qi+m*(aj+n*ak)]=s0;T1d[qi+m*(aj+n*ak)]=s1;
+            }
+        }
+    }
+    // the transpose of the xi contraction
+    for(ak=0;ak<n;ak++){
+        for(aj=0;aj<n;aj++){
+            for(ai=0;ai<n;ai++){
+                s0=0.0;
+                for(qi=0;qi<m;qi++){
+                    s0+=_B[qi*n+ai]*T1v[qi+m*(aj+n*ak)]+_D[qi*n+ai]*T1d[qi+m*(aj+n*ak)];
+                }
+                ulex[ai+n*(aj+n*ak)]=s0;
+            }
+        }
+    }
+}
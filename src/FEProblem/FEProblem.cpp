@@ -15,6 +15,7 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "FEProblem/FEProblem.h"
+#include "Utils/Profiler.h"
 
 FEProblem::FEProblem(){
     _feJobType=FEJobType::STATIC;
@@ -23,6 +24,8 @@ FEProblem::FEProblem(){
 void FEProblem::InitFEProblem(int args,char *argv[]){
     _feJobType=FEJobType::STATIC;
     _inputSystem.InitInputSystem(args,argv);
+    // '--profile' activates the PETSc logging, the events are registered anyway
+    Profiler::Init(_inputSystem.IsProfile());
 }
 
 
@@ -31,5 +34,17 @@ void FEProblem::Finalize(){
         _solutionSystem.ReleaseMem();
         _equationSystem.ReleaseMem();
         _nonlinearSolver.ReleaseMem();
+        _feSystem.ReleaseMem();
+        _bcSystem.ReleaseMem();
+        _postprocessSystem.ReleaseMem();
+    }
+    if(_inputSystem.IsProfile()){
+        // the report shares the same prefix with the input file, i.e. 'test.i' -> 'test.profile.json'
+        string inputfilename=_inputSystem.GetInputFileName();
+        string jsonfilename;
+        if(inputfilename.size()>2){
+            jsonfilename=inputfilename.substr(0,inputfilename.size()-2)+".profile.json";
+        }
+        Profiler::Finalize(jsonfilename);
     }
 }
@@ -0,0 +1,72 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.15
+//+++ Purpose: Implement the memory report of the major components
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "FEProblem/MemoryReport.h"
+
+double MemoryReport::_PeakUsage=0.0;
+
+void MemoryReport::Collect(const Mesh &mesh,const DofHandler &dofHandler,
+                           const SolutionSystem &solutionSystem,const EquationSystem &equationSystem,
+                           const NonlinearSolver &nonlinearSolver,const OutputSystem &outputSystem,
+                           const bool &IsEstimate,
+                           vector<MemoryRecord> &records){
+    records.clear();
+    records.push_back(MemoryRecord{"Mesh",mesh.GetBulkMeshMemoryUsage()});
+    records.push_back(MemoryRecord{"DofHandler",dofHandler.GetMemoryUsage()});
+    records.push_back(MemoryRecord{"Solution vectors",solutionSystem.GetVecMemoryUsage()});
+    records.push_back(MemoryRecord{"Materials",solutionSystem.GetMaterialsMemoryUsage()});
+    records.push_back(MemoryRecord{"Matrix+RHS",equationSystem.GetMemoryUsage()});
+    if(IsEstimate){
+        records.push_back(MemoryRecord{"Factorization(est.)",nonlinearSolver.EstimateFactorMemoryUsage(equationSystem._AMATRIX)});
+    }
+    else{
+        records.push_back(MemoryRecord{"Factorization",nonlinearSolver.GetFactorMemoryUsage()});
+    }
+    records.push_back(MemoryRecord{"Output buffers",outputSystem.GetMemoryUsage(solutionSystem)});
+
+    double total=0.0;
+    for(const auto &it:records) total+=it.Bytes;
+    records.push_back(MemoryRecord{"Total(counted)",total});
+    records.push_back(MemoryRecord{"Process",MemoryUsage::GetCurrentUsage()});
+}
+//*****************************************************************
+void MemoryReport::PrintSetupReport(const Mesh &mesh,const DofHandler &dofHandler,
+                                    const SolutionSystem &solutionSystem,const EquationSystem &equationSystem,
+                                    const NonlinearSolver &nonlinearSolver,const OutputSystem &outputSystem){
+    vector<MemoryRecord> records;
+    vector<double> maxbytes,sumbytes;
+    Collect(mesh,dofHandler,solutionSystem,equationSystem,nonlinearSolver,outputSystem,true,records);
+    MemoryUsage::ReduceRecords(records,maxbytes,sumbytes);
+
+    MessagePrinter::PrintStars();
+    MemoryUsage::PrintReport("Memory usage summary after the setup:",records,maxbytes,sumbytes);
+    MessagePrinter::PrintStars();
+
+    Profiler::SetMemoryRecords("setup",0,records);
+}
+//*****************************************************************
+void MemoryReport::UpdatePeak(const int &step,const Mesh &mesh,const DofHandler &dofHandler,
+                              const SolutionSystem &solutionSystem,const EquationSystem &equationSystem,
+                              const NonlinearSolver &nonlinearSolver,const OutputSystem &outputSystem){
+    if(!Profiler::IsActive()) return;
+    // all the ranks must make the same decision, so the max value over the ranks is used
+    double local=MemoryUsage::GetCurrentUsage(),global;
+    MPI_Allreduce(&local,&global,1,MPI_DOUBLE,MPI_MAX,PETSC_COMM_WORLD);
+    if(global<=_PeakUsage) return;
+    _PeakUsage=global;
+
+    vector<MemoryRecord> records;
+    Collect(mesh,dofHandler,solutionSystem,equationSystem,nonlinearSolver,outputSystem,false,records);
+    Profiler::SetMemoryRecords("peak",step,records);
+}
@@ -23,6 +23,18 @@ void FEProblem::ReadInputFile(){
     _postprocessSystem,
     _nonlinearSolver,_timestepping,
     _feJobBlock);
+    // the checkpoint files share the same prefix with the input file
+    string inputfilename=_inputSystem.GetInputFileName();
+    if(inputfilename.size()>2){
+        _timestepping.SetCheckPointFilePrefix(inputfilename.substr(0,inputfilename.size()-2));
+    }
+    if(_inputSystem.IsRestart()){
+        if(_feJobBlock._jobType!=FEJobType::TRANSIENT){
+            MessagePrinter::PrintErrorTxt("'--restart' is only supported by the transient analysis, please check your [job] block");
+            MessagePrinter::AsFem_Exit();
+        }
+        _timestepping.SetRestartFileName(_inputSystem.GetRestartFileName());
+    }
     MessagePrinter::PrintNormalTxt("Input file reading is done !");
     MessagePrinter::PrintStars();
 }
@@ -73,6 +85,11 @@ void FEProblem::InitAllComponents(){
         _TimerStart=chrono::high_resolution_clock::now();
     }
     _fe.InitFE(_mesh);
+    // each [elmt] block can use its own gauss points(i.e. the reduced integration)
+    _fe.CreateBlockBulkQPoints(_mesh,_dofHandler.GetElmtBlockQpOrderList(),_dofHandler.GetElmtBlockReducedIntegrationList());
+    // the boundary elements, dofs index and gauss point geometry of each [bcs] sub block
+    // are resolved once the dofs map and the FE space are ready
+    _bcSystem.CreateBCBoundarySets(_mesh,_dofHandler,_fe);
     if(_rank==0){
         _TimerEnd=chrono::high_resolution_clock::now();
         _Duration=Duration(_TimerStart,_TimerEnd);
@@ -94,7 +111,7 @@ void FEProblem::InitAllComponents(){
     _solutionSystem.SetHistNumPerGPoint(10);
     _solutionSystem.InitSolution(_dofHandler.GetActiveDofsNum(),
                             _mesh.GetBulkMeshBulkElmtsNum(),_mesh.GetBulkMeshNodesNum(),
-                            _fe._BulkQPoint.GetQpPointsNum());
+                            _fe.GetMaxBulkQpPointsNum());
     
     if(_rank==0){
         _TimerEnd=chrono::high_resolution_clock::now();
@@ -183,7 +200,7 @@ void FEProblem::InitAllComponents(){
     str=buff;
     MessagePrinter::PrintNormalTxt(str);
 
-    _postprocessSystem.InitPPSOutput();
+    _postprocessSystem.InitPPSOutput(_timestepping.IsRestart());
     _postprocessSystem.CheckWhetherPPSIsValid(_mesh);
 
     MessagePrinter::PrintStars(MessageColor::BLUE);
@@ -236,4 +253,9 @@ void FEProblem::InitAllComponents(){
     MessagePrinter::PrintNormalTxt(str,MessageColor::BLUE);
     MessagePrinter::PrintStars(MessageColor::BLUE);
 
+    // for the dry-run, the report is given once the materials are initialized
+    if(!_inputSystem.IsDryRun()){
+        MemoryReport::PrintSetupReport(_mesh,_dofHandler,_solutionSystem,_equationSystem,_nonlinearSolver,_outputSystem);
+    }
+
 }
@@ -14,12 +14,20 @@
 
 #include "FEProblem/FEProblem.h"
 
-void FEProblem::Run(){
+void FEProblem::Setup(){
     ReadInputFile();
     if(!_inputSystem.IsReadOnlyMode()){
         InitAllComponents();
+    }
+}
 
-        if(_feJobType==FEJobType::STATIC){
+void FEProblem::Run(){
+    Setup();
+    if(!_inputSystem.IsReadOnlyMode()){
+        if(_inputSystem.IsDryRun()){
+            RunDryRun();
+        }
+        else if(_feJobType==FEJobType::STATIC){
             RunStaticAnalysis();
         }
         else if(_feJobType==FEJobType::TRANSIENT){
@@ -34,4 +42,26 @@ void FEProblem::Run(){
         MessagePrinter::PrintNormalTxt("Read-only mode analysis is finished !");
         MessagePrinter::PrintStars();
     }
-}
\ No newline at end of file
+}
+
+void FEProblem::RunDryRun(){
+    MessagePrinter::PrintNormalTxt("Start the dry-run, the materials are initialized without any solve ...");
+    _feCtrlInfo._timesteppingtype=TimeSteppingType::STATIC;
+    _icSystem.ApplyIC(_mesh,_dofHandler,_solutionSystem._U);
+    VecCopy(_solutionSystem._U,_solutionSystem._Unew);
+    VecCopy(_solutionSystem._U,_solutionSystem._Utemp);
+    _feSystem.FormBulkFE(FECalcType::InitMaterial,0.0,0.0,_feCtrlInfo.ctan,_mesh,
+            _dofHandler,_fe,_elmtSystem,_mateSystem,_solutionSystem,
+            _equationSystem._AMATRIX,_equationSystem._RHS);
+    _solutionSystem.UpdateMaterials();
+
+    MemoryReport::PrintSetupReport(_mesh,_dofHandler,_solutionSystem,_equationSystem,_nonlinearSolver,_outputSystem);
+    MessagePrinter::PrintNormalTxt("Dry-run is finished !");
+    MessagePrinter::PrintStars();
+}
+
+void FEProblem::FormBulkSystem(const FECalcType &calctype,const double &t,const double &dt){
+    _feSystem.FormBulkFE(calctype,t,dt,_feCtrlInfo.ctan,_mesh,
+            _dofHandler,_fe,_elmtSystem,_mateSystem,_solutionSystem,
+            _equationSystem._AMATRIX,_equationSystem._RHS);
+}
@@ -31,6 +31,7 @@ void FEProblem::RunStaticAnalysis(){
         _bcSystem,
         _solutionSystem,_equationSystem,
         _fe,_feSystem,_feCtrlInfo)){
+        MemoryReport::UpdatePeak(0,_mesh,_dofHandler,_solutionSystem,_equationSystem,_nonlinearSolver,_outputSystem);
         if(_rank==0){
             _TimerEnd=chrono::high_resolution_clock::now();
             _Duration=Duration(_TimerStart,_TimerEnd);
@@ -0,0 +1,79 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.30
+//+++ Purpose: the hourglass control for the one-point integrated
+//+++          quad4 and hex8 elements, the stiffness-based form of
+//+++          Flanagan and Belytschko is used, the stabilization
+//+++          is only applied to the displacement dofs
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "FESystem/FESystem.h"
+
+void FESystem::AccumulateHourglassStabilization(const FECalcType &calctype,const int &nDim,const int &nNodes,
+                                                const int &nDofsPerNode,const Span<const int> &dofindex,
+                                                const double &hgstiffness,const double &elVolume,const double (&ctan)[3],
+                                                const ShapeFun &shp,const Nodes &elNodes,const Span<const double> &elU,
+                                                const vector<double> &dofsactiveflag,
+                                                vector<double> &sumK,vector<double> &sumR){
+    // the hourglass base vectors evaluated on the nodes, i.e. xi*eta, eta*zeta, zeta*xi and xi*eta*zeta,
+    // the node order is the same as the one in the shape functions
+    const static double h2d[1][4]={{1.0,-1.0, 1.0,-1.0}};
+    const static double h3d[4][8]={{ 1.0,-1.0, 1.0,-1.0, 1.0,-1.0, 1.0,-1.0},
+                                   { 1.0, 1.0,-1.0,-1.0,-1.0,-1.0, 1.0, 1.0},
+                                   { 1.0,-1.0,-1.0, 1.0,-1.0, 1.0, 1.0,-1.0},
+                                   {-1.0, 1.0,-1.0, 1.0, 1.0,-1.0, 1.0,-1.0}};
+    int nModes,a,b,i,k,alpha,iInd,jInd,nDofs;
+    double gamma[8][4],hx,B2,c,kab;
+
+    if((nDim==2&&nNodes!=4)||(nDim==3&&nNodes!=8)||nDim<2) return;
+    nModes=(nDim==2)?1:4;
+    nDofs=nNodes*nDofsPerNode;
+
+    // gamma=h-(h.x_i)*b_i, where b_i is the shape function gradient on the element center,
+    // so the hourglass modes are orthogonal to the linear displacement field
+    B2=0.0;
+    for(a=1;a<=nNodes;a++){
+        for(i=1;i<=nDim;i++) B2+=shp.shape_grad(a)(i)*shp.shape_grad(a)(i);
+    }
+    for(alpha=0;alpha<nModes;alpha++){
+        for(a=1;a<=nNodes;a++) gamma[a-1][alpha]=(nDim==2)?h2d[alpha][a-1]:h3d[alpha][a-1];
+        for(i=1;i<=nDim;i++){
+            hx=0.0;
+            for(b=1;b<=nNodes;b++) hx+=((nDim==2)?h2d[alpha][b-1]:h3d[alpha][b-1])*elNodes(b,i);
+            for(a=1;a<=nNodes;a++) gamma[a-1][alpha]-=hx*shp.shape_grad(a)(i);
+        }
+    }
+    // the stabilization stiffness is scaled by the volume and the gradients, so the hourglass modes
+    // have the same order of stiffness as the physical ones for the modulus given in the [elmt] block
+    c=hgstiffness*elVolume*B2/nNodes;
+
+    // the first nDim dofs of current [elmt] block are the displacements
+    for(k=1;k<=nDim&&k<=dofindex.size();k++){
+        for(a=1;a<=nNodes;a++){
+            iInd=(a-1)*nDofsPerNode+dofindex(k)-1;
+            if(dofsactiveflag[iInd]<=0.0) continue;
+            for(b=1;b<=nNodes;b++){
+                jInd=(b-1)*nDofsPerNode+dofindex(k)-1;
+                kab=0.0;
+                for(alpha=0;alpha<nModes;alpha++) kab+=gamma[a-1][alpha]*gamma[b-1][alpha];
+                kab*=c;
+                if(calctype==FECalcType::ComputeResidual){
+                    sumR[iInd]+=kab*elU[jInd];
+                }
+                else if(calctype==FECalcType::ComputeJacobian){
+                    sumK[iInd*nDofs+jInd]+=kab*ctan[0];
+                    // the penalty of the dirichlet bc is scaled by the max value, so the hourglass term is counted as well
+                    if(sumK[iInd*nDofs+jInd]>_MaxKMatrixValue) _MaxKMatrixValue=sumK[iInd*nDofs+jInd];
+                }
+            }
+        }
+    }
+}
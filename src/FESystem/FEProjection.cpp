@@ -15,379 +15,290 @@
 
 #include "FESystem/FESystem.h"
 
-void FESystem::AssembleLocalProjectionToGlobal(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                               const map<string,double> &ProjVariables,
-                                               const ScalarMateType &ScalarMate,
-                                               const VectorMateType &VectorMate,
-                                               const Rank2MateType &Rank2Mate,
-                                               const Rank4MateType &Rank4Mate,
-                                               SolutionSystem &solutionSystem){
-    //*** assemble local projected variables
-    AssembleLocalProjVariable2Global(nNodes,DetJac,shp,solutionSystem.GetProjNumPerNode(),solutionSystem.GetProjNameVec(),
-                                     ProjVariables,solutionSystem._Proj);
+//******************************************************
+//*** the names are only looked up when the map or its generation is changed, the error message
+//*** is only built once a name is missing
+template<class T>
+static inline bool IsProjSlotsValid(const map<string,T> &mate,const size_t &generation,const ProjSlots<T> &slots){
+    return slots.owner==&mate&&slots.generation==generation;
+}
+template<class T>
+static void ResolveProjSlots(const map<string,T> &mate,const size_t &generation,const vector<string> &names,ProjSlots<T> &slots,
+                             const char *mateinfo,const char *option,const char *source){
+    slots.values.resize(names.size());
+    for(size_t i=0;i<names.size();i++){
+        auto it=mate.find(names[i]);
+        if(it==mate.end()){
+            MessagePrinter::PrintErrorTxt("can not find the projected "+string(mateinfo)+"(name="
+                                          +names[i]
+                                          +"), please check the '"+string(option)+"' option in your [projection] block "
+                                           "or the "+string(source));
+            MessagePrinter::AsFem_Exit();
+        }
+        slots.values[i]=&(it->second);
+    }
+    slots.owner=&mate;
+    slots.generation=generation;
+}
 
-    //*** assemble local projected scalar materials to global
-    AssembleLocalProjScalarMate2Global(nNodes,DetJac,shp,solutionSystem.GetScalarMateProjNumPerNode(),
-                                       solutionSystem.GetScalarMateNameVec(),ScalarMate,solutionSystem._ProjScalarMate);
+void FESystem::UpdateProjection(const double &t,const double &dt,const double (&ctan)[3],
+                Mesh &mesh,const DofHandler &dofHandler,FE &fe,
+                ElmtSystem &elmtSystem,MateSystem &mateSystem,
+                SolutionSystem &solutionSystem,
+                Mat &AMATRIX,Vec &RHS){
+    if(!solutionSystem.IsProjection()) return;
+    if(solutionSystem.IsProjectionUpToDate()) return;
+    FormBulkFE(FECalcType::Projection,t,dt,ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,AMATRIX,RHS);
+}
+//*****************************************************************************
+
+void FESystem::InitProjection(const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem){
+    // the names are resolved to the slots of the nodal block only once here
+    _nProjBlockSize=solutionSystem.GetProjBlockSize();
+    _ProjNameList=solutionSystem.GetProjNameVec();
+    _ScalarMateProjNameList=solutionSystem.GetScalarMateNameVec();
+    _VectorMateProjNameList=solutionSystem.GetVectorMateNameVec();
+    _Rank2MateProjNameList=solutionSystem.GetRank2MateNameVec();
+    _Rank4MateProjNameList=solutionSystem.GetRank4MateNameVec();
 
-    //*** assemble local projected vector materials to global
-    AssembleLocalProjVectorMate2Global(nNodes,DetJac,shp,solutionSystem.GetVectorMateProjNumPerNode(),
-                                       solutionSystem.GetVectorMateNameVec(),VectorMate,solutionSystem._ProjVectorMate);
+    _ProjVariableOffset=solutionSystem.GetProjVariableOffset();
+    _ScalarMateProjOffset=solutionSystem.GetScalarMateProjOffset();
+    _VectorMateProjOffset=solutionSystem.GetVectorMateProjOffset();
+    _Rank2MateProjOffset=solutionSystem.GetRank2MateProjOffset();
+    _Rank4MateProjOffset=solutionSystem.GetRank4MateProjOffset();
+    // the addresses inside the material maps are resolved by the first projected gauss point
+    _ProjVariableSlots=ProjSlots<double>();
+    _ScalarMateProjSlots=ProjSlots<double>();
+    _VectorMateProjSlots=ProjSlots<Vector3d>();
+    _Rank2MateProjSlots=ProjSlots<RankTwoTensor>();
+    _Rank4MateProjSlots=ProjSlots<RankFourTensor>();
 
-    //*** assemble local projected rank-2 materials to global
-    AssembleLocalProjRank2Mate2Global(nNodes,DetJac,shp,solutionSystem.GetRank2MateProjNumPerNode(),
-                                      solutionSystem.GetRank2MateNameVec(),Rank2Mate,solutionSystem._ProjRank2Mate);
+    int nNodesPerElmt=mesh.GetBulkMeshNodesNumPerBulkElmt();
+    _gpProjValues.resize(_nProjBlockSize,0.0);
+    _elProj.resize(nNodesPerElmt*_nProjBlockSize,0.0);
+    _elProjNodes.resize(nNodesPerElmt,0);
+
+    _ProjectionType=solutionSystem.GetProjectionType();
+    _IsProjMassAssembled=false;
+    if(!solutionSystem.IsProjection()) return;
+    if(_ProjectionType==ProjectionType::CONSISTENT&&dofHandler.HasReducedIntegrationElmtBlock()){
+        // the one-point mass matrix is rank deficient, the consistent projection can't be solved
+        MessagePrinter::PrintWarningTxt("the consistent projection is not available for the reduced integration, the lumped one will be used");
+        _ProjectionType=ProjectionType::LUMPED;
+    }
 
-    //*** assemble local projected rank-4 materials to global
-    AssembleLocalProjRank4Mate2Global(nNodes,DetJac,shp,solutionSystem.GetRank4MateProjNumPerNode(),
-                                      solutionSystem.GetRank4MateNameVec(),Rank4Mate,solutionSystem._ProjRank4Mate);
+    //*** the nodal vectors share the same layout with the blocks of _Proj
+    PetscInt nLocal,nLocalNodes;
+    VecGetLocalSize(solutionSystem._Proj,&nLocal);
+    nLocalNodes=nLocal/_nProjBlockSize;
+
+    _elProjMassDiag.resize(nNodesPerElmt,0.0);
+    VecCreate(PETSC_COMM_WORLD,&_ProjMassDiag);
+    VecSetSizes(_ProjMassDiag,nLocalNodes,mesh.GetBulkMeshNodesNum());
+    VecSetUp(_ProjMassDiag);
+    VecSet(_ProjMassDiag,0.0);
+
+    if(_ProjectionType==ProjectionType::CONSISTENT){
+        _elProjMass.resize(nNodesPerElmt*nNodesPerElmt,0.0);
+        // the nodal connectivity is the dof one without the dofs on each node
+        int maxrownnz=dofHandler.GetMaxRowNNZ()/dofHandler.GetDofsNumPerNode()+1;
+        MatCreateAIJ(PETSC_COMM_WORLD,nLocalNodes,nLocalNodes,
+                     mesh.GetBulkMeshNodesNum(),mesh.GetBulkMeshNodesNum(),
+                     maxrownnz,NULL,maxrownnz,NULL,&_ProjMass);
+        MatSetOption(_ProjMass,MAT_NEW_NONZERO_ALLOCATION_ERR,PETSC_FALSE);
+        VecDuplicate(_ProjMassDiag,&_ProjRHS);
+        VecDuplicate(_ProjMassDiag,&_ProjSol);
+    }
 }
 //******************************************************
-//@fun: here we assemble the local projected variables to global
-void FESystem::AssembleLocalProjVariable2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                                const int &nProj,vector<string> ProjNameVec,
-                                                const map<string,double> &elProj,Vec &ProjVec){
+//@fun: pack all the projected quantities of current gauss point into one array,
+//      then accumulate their contribution to the local element's nodal block
+void FESystem::AccumulateLocalProjection(const int &nNodes,const double &JxW,const ShapeFun &shp,
+                                         const map<string,double> &ProjVariables,
+                                         const ScalarMateType &ScalarMate,
+                                         const VectorMateType &VectorMate,
+                                         const Rank2MateType &Rank2Mate,
+                                         const Rank4MateType &Rank4Mate,
+                                         const size_t &MateGeneration){
+    int i,j,k;
     double w;
-    int j,k,jInd,iInd;
-    bool HasName;
-    for(j=1;j<=nNodes;j++){
-        iInd=_elConn[j-1]-1;
-        jInd=iInd*(nProj+1)+0;
-        w=DetJac*shp.shape_value(j);
-        VecSetValue(ProjVec,jInd,w,ADD_VALUES);
-        for(k=1;k<=nProj;k++){
-            HasName=false;
-            for(const auto &it:elProj){
-                if(it.first==ProjNameVec[k-1]){
-                    HasName=true;
-                    jInd=iInd*(nProj+1)+k;
-                    VecSetValue(ProjVec,jInd,w*it.second,ADD_VALUES);
-                    break;
+    PackProjVariable(ProjVariables);
+    PackProjScalarMate(ScalarMate,MateGeneration);
+    PackProjVectorMate(VectorMate,MateGeneration);
+    PackProjRank2Mate(Rank2Mate,MateGeneration);
+    PackProjRank4Mate(Rank4Mate,MateGeneration);
+    for(i=0;i<nNodes;i++){
+        w=JxW*shp.shape_value(i+1);
+        for(k=0;k<_nProjBlockSize;k++){
+            _elProj[i*_nProjBlockSize+k]+=w*_gpProjValues[k];
+        }
+        if(!_IsProjMassAssembled){
+            // the row sum of the consistent mass is the lumped one
+            _elProjMassDiag[i]+=w;
+            if(_ProjectionType==ProjectionType::CONSISTENT){
+                for(j=0;j<nNodes;j++){
+                    _elProjMass[i*nNodes+j]+=w*shp.shape_value(j+1);
                 }
             }
-            if(!HasName){
-                MessagePrinter::PrintErrorTxt("can not find the projected variable(name="
-                                               +ProjNameVec[k-1]
-                                               +"), please check the 'name=' option in your [projection] block "
-                                                "or the gpProj name in your related UEL");
-                MessagePrinter::AsFem_Exit();
-            }
         }
     }
 }
 //******************************************************
-void FESystem::AssembleLocalProjScalarMate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                                  const int &nProj,vector<string> ProjNameVec,
-                                                  const ScalarMateType &ScalarMate,Vec &ProjVec){
-    double w;
-    int j,k,jInd,iInd;
-    bool HasName;
-    for(j=1;j<=nNodes;j++){
-        iInd=_elConn[j-1]-1;
-        jInd=iInd*(nProj+1)+0;
-        w=DetJac*shp.shape_value(j);
-        VecSetValue(ProjVec,jInd,w,ADD_VALUES);
-        for(k=1;k<=nProj;k++){
-            HasName=false;
-            for(const auto &it:ScalarMate){
-                if(it.first==ProjNameVec[k-1]){
-                    HasName=true;
-                    jInd=iInd*(nProj+1)+k;
-                    VecSetValue(ProjVec,jInd,w*it.second,ADD_VALUES);
-                    break;
-                }
-            }
-            if(!HasName){
-                MessagePrinter::PrintErrorTxt("can not find the projected scalar material(name="
-                                              +ProjNameVec[k-1]
-                                              +"), please check the 'scalarmate=' option in your [projection] block "
-                                               "or the '_ScalarMaterials' name in your related UMAT");
-                MessagePrinter::AsFem_Exit();
-            }
+void FESystem::AssembleLocalProjectionToGlobal(const int &nNodes,Vec &ProjVec){
+    for(int i=0;i<nNodes;i++){
+        _elProjNodes[i]=_elConn[i]-1;
+    }
+    // one call for the whole element, each node is one block
+    VecSetValuesBlocked(ProjVec,nNodes,_elProjNodes.data(),_elProj.data(),ADD_VALUES);
+    if(!_IsProjMassAssembled){
+        VecSetValues(_ProjMassDiag,nNodes,_elProjNodes.data(),_elProjMassDiag.data(),ADD_VALUES);
+        fill(_elProjMassDiag.begin(),_elProjMassDiag.end(),0.0);
+        if(_ProjectionType==ProjectionType::CONSISTENT){
+            MatSetValues(_ProjMass,nNodes,_elProjNodes.data(),nNodes,_elProjNodes.data(),_elProjMass.data(),ADD_VALUES);
+            fill(_elProjMass.begin(),_elProjMass.end(),0.0);
         }
     }
 }
 //******************************************************
-void FESystem::AssembleLocalProjVectorMate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                                  const int &nProj,vector<string> ProjNameVec,
-                                                  const VectorMateType &VectorMate,Vec &ProjVec){
-    double w;
-    int j,k,jInd,iInd;
-    bool HasName;
-    for(j=1;j<=nNodes;j++){
-        iInd=_elConn[j-1]-1;
-        jInd=iInd*(nProj*3+1)+0;
-        w=DetJac*shp.shape_value(j);
-        VecSetValue(ProjVec,jInd,w,ADD_VALUES);
-        for(k=1;k<=nProj;k++){
-            HasName=false;
-            for(const auto &it:VectorMate){
-                if(it.first==ProjNameVec[k-1]){
-                    HasName=true;
-                    // for first component
-                    jInd=iInd*(nProj*3+1)+3*(k-1)+1;
-                    VecSetValue(ProjVec,jInd,w*it.second(1),ADD_VALUES);
-                    // for second component
-                    jInd=iInd*(nProj*3+1)+3*(k-1)+2;
-                    VecSetValue(ProjVec,jInd,w*it.second(2),ADD_VALUES);
-                    // for third component
-                    jInd=iInd*(nProj*3+1)+3*(k-1)+3;
-                    VecSetValue(ProjVec,jInd,w*it.second(3),ADD_VALUES);
-                    break;
-                }
-            }
-            if(!HasName){
-                MessagePrinter::PrintErrorTxt("can not find the projected vector material(name="
-                                              +ProjNameVec[k-1]
-                                              +"), please check the 'vectormate=' option in your [projection] block "
-                                               "or the '_VectorMaterials' name in your related UMAT");
-                MessagePrinter::AsFem_Exit();
-            }
-        }
+void FESystem::PackProjVariable(const map<string,double> &elProj){
+    if(!IsProjSlotsValid(elProj,_gpProjGeneration,_ProjVariableSlots)){
+        ResolveProjSlots(elProj,_gpProjGeneration,_ProjNameList,_ProjVariableSlots,"variable","name=","gpProj name in your related UEL");
+    }
+    int k=_ProjVariableOffset;
+    for(const double *value:_ProjVariableSlots.values){
+        _gpProjValues[k]=*value;
+        k+=1;
     }
 }
 //******************************************************
-void FESystem::AssembleLocalProjRank2Mate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                                 const int &nProj,vector<string> ProjNameVec,
-                                                 const Rank2MateType &Rank2Mate,Vec &ProjVec){
-    double w;
-    int i1,j1,ii,j,k,jInd,iInd;
-    bool HasName;
-    for(j=1;j<=nNodes;j++){
-        iInd=_elConn[j-1]-1;
-        jInd=iInd*(nProj*9+1)+0;
-        w=DetJac*shp.shape_value(j);
-        VecSetValue(ProjVec,jInd,w,ADD_VALUES);
-        for(k=1;k<=nProj;k++){
-            HasName=false;
-            for(const auto &it:Rank2Mate){
-                if(it.first==ProjNameVec[k-1]){
-                    HasName=true;
-                    ii=0;
-                    for(i1=1;i1<=3;i1++){
-                        for(j1=1;j1<=3;j1++){
-                            ii+=1;
-                            jInd=iInd*(nProj*9+1)+9*(k-1)+ii;
-                            VecSetValue(ProjVec,jInd,w*it.second(i1,j1),ADD_VALUES);
-                        }
-                    }
-                    break;
-                }
-            }
-            if(!HasName){
-                MessagePrinter::PrintErrorTxt("can not find the projected rank-2 material(name="
-                                              +ProjNameVec[k-1]
-                                              +"), please check the 'rank2mate=' option in your [projection] block "
-                                               "or the '_Rank2Materials' name in your related UMAT");
-                MessagePrinter::AsFem_Exit();
+void FESystem::PackProjScalarMate(const ScalarMateType &ScalarMate,const size_t &MateGeneration){
+    if(!IsProjSlotsValid(ScalarMate,MateGeneration,_ScalarMateProjSlots)){
+        ResolveProjSlots(ScalarMate,MateGeneration,_ScalarMateProjNameList,_ScalarMateProjSlots,"scalar material","scalarmate=","'_ScalarMaterials' name in your related UMAT");
+    }
+    int k=_ScalarMateProjOffset;
+    for(const double *value:_ScalarMateProjSlots.values){
+        _gpProjValues[k]=*value;
+        k+=1;
+    }
+}
+//******************************************************
+void FESystem::PackProjVectorMate(const VectorMateType &VectorMate,const size_t &MateGeneration){
+    if(!IsProjSlotsValid(VectorMate,MateGeneration,_VectorMateProjSlots)){
+        ResolveProjSlots(VectorMate,MateGeneration,_VectorMateProjNameList,_VectorMateProjSlots,"vector material","vectormate=","'_VectorMaterials' name in your related UMAT");
+    }
+    int k=_VectorMateProjOffset;
+    for(const Vector3d *value:_VectorMateProjSlots.values){
+        _gpProjValues[k  ]=(*value)(1);
+        _gpProjValues[k+1]=(*value)(2);
+        _gpProjValues[k+2]=(*value)(3);
+        k+=3;
+    }
+}
+//******************************************************
+void FESystem::PackProjRank2Mate(const Rank2MateType &Rank2Mate,const size_t &MateGeneration){
+    if(!IsProjSlotsValid(Rank2Mate,MateGeneration,_Rank2MateProjSlots)){
+        ResolveProjSlots(Rank2Mate,MateGeneration,_Rank2MateProjNameList,_Rank2MateProjSlots,"rank-2 material","rank2mate=","'_Rank2Materials' name in your related UMAT");
+    }
+    int i1,j1,k=_Rank2MateProjOffset;
+    for(const RankTwoTensor *value:_Rank2MateProjSlots.values){
+        for(i1=1;i1<=3;i1++){
+            for(j1=1;j1<=3;j1++){
+                _gpProjValues[k]=(*value)(i1,j1);
+                k+=1;
             }
         }
     }
 }
 //******************************************************
-void FESystem::AssembleLocalProjRank4Mate2Global(const int &nNodes,const double &DetJac,const ShapeFun &shp,
-                                                 const int &nProj,vector<string> ProjNameVec,
-                                                 const Rank4MateType &Rank4Mate,Vec &ProjVec){
-    double w;
-    int j,k,jInd,iInd;
-    int i1,j1;
-    bool HasName;
-    for(j=1;j<=nNodes;j++){
-        iInd=_elConn[j-1]-1;
-        jInd=iInd*(nProj*36+1)+0;
-        w=DetJac*shp.shape_value(j);
-        VecSetValue(ProjVec,jInd,w,ADD_VALUES);
-        for(k=1;k<=nProj;k++){
-            HasName=false;
-            for(const auto &it:Rank4Mate){
-                if(it.first==ProjNameVec[k-1]){
-                    HasName=true;
-                    // for first component
-                    for(i1=1;i1<=6;i1++){
-                        for(j1=1;j1<=6;j1++){
-                            jInd=iInd*(nProj*36+1)+36*(k-1)+(i1-1)*6+j1;
-                            VecSetValue(ProjVec,jInd,w*it.second.VoigtIJcomponent(i1,j1),ADD_VALUES);
-                        }
-                    }      
-                    break;
-                }
-            }
-            if(!HasName){
-                MessagePrinter::PrintErrorTxt("can not find the projected rank-4 material(name="
-                                              +ProjNameVec[k-1]
-                                              +"), please check the 'rank4mate=' option in your [projection] block "
-                                               "or the '_Rank4Materials' name in your related UMAT");
-                MessagePrinter::AsFem_Exit();
+void FESystem::PackProjRank4Mate(const Rank4MateType &Rank4Mate,const size_t &MateGeneration){
+    if(!IsProjSlotsValid(Rank4Mate,MateGeneration,_Rank4MateProjSlots)){
+        ResolveProjSlots(Rank4Mate,MateGeneration,_Rank4MateProjNameList,_Rank4MateProjSlots,"rank-4 material","rank4mate=","'_Rank4Materials' name in your related UMAT");
+    }
+    int i1,j1,k=_Rank4MateProjOffset;
+    for(const RankFourTensor *value:_Rank4MateProjSlots.values){
+        for(i1=1;i1<=6;i1++){
+            for(j1=1;j1<=6;j1++){
+                _gpProjValues[k]=value->VoigtIJcomponent(i1,j1);
+                k+=1;
             }
         }
     }
 }
 //******************************************************
-void FESystem::Projection(const int &nTotalNodes,SolutionSystem &solutionSystem){
-    int i,j,k,iInd,ee,nProj;
-    double value,weight,newvalue;
+void FESystem::FinalizeProjectionMass(){
+    PetscInt i,iStart,iEnd;
+    PetscScalar *diag;
 
-    MPI_Comm_rank(PETSC_COMM_WORLD,&_rank);
-    MPI_Comm_size(PETSC_COMM_WORLD,&_size);
+    VecAssemblyBegin(_ProjMassDiag);
+    VecAssemblyEnd(_ProjMassDiag);
 
-    int rankne=nTotalNodes/_size;
-    int eStart=_rank*rankne;
-    int eEnd=(_rank+1)*rankne;
-    if(_rank==_size-1) eEnd=nTotalNodes;
-
-    // for projected variables
-    VecAssemblyBegin(solutionSystem._Proj);
-    VecAssemblyEnd(solutionSystem._Proj);
-    VecScatterCreateToAll(solutionSystem._Proj,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecSet(solutionSystem._Proj,0.0);
-    nProj=solutionSystem.GetProjNumPerNode();
-    for(ee=eStart;ee<eEnd;++ee){
-        i=ee+1;
-        iInd=(i-1)*(1+nProj)+0;
-        VecGetValues(_ProjSeq,1,&iInd,&weight);
-        VecSetValue(solutionSystem._Proj,iInd,weight,ADD_VALUES);
-        for(j=1;j<=nProj;j++){
-            iInd=(i-1)*(nProj+1)+j;
-            VecGetValues(_ProjSeq,1,&iInd,&value);
-            if(abs(weight)>1.0e-15){
-                newvalue=value/weight;
-            }
-            else{
-                newvalue=value;
+    // the node which is not connected to any bulk element has no mass,
+    // a unit one is used to keep the system regular(its projected value is zero)
+    VecGetOwnershipRange(_ProjMassDiag,&iStart,&iEnd);
+    VecGetArray(_ProjMassDiag,&diag);
+    for(i=iStart;i<iEnd;i++){
+        if(abs(diag[i-iStart])<1.0e-15){
+            diag[i-iStart]=1.0;
+            if(_ProjectionType==ProjectionType::CONSISTENT){
+                MatSetValue(_ProjMass,i,i,1.0,ADD_VALUES);
             }
-            VecSetValue(solutionSystem._Proj,iInd,newvalue,ADD_VALUES);
         }
     }
-    VecAssemblyBegin(solutionSystem._Proj);
-    VecAssemblyEnd(solutionSystem._Proj);
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
+    VecRestoreArray(_ProjMassDiag,&diag);
 
-    // for projected scalar materials
-    VecAssemblyBegin(solutionSystem._ProjScalarMate);
-    VecAssemblyEnd(solutionSystem._ProjScalarMate);
-    VecScatterCreateToAll(solutionSystem._ProjScalarMate,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._ProjScalarMate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._ProjScalarMate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecSet(solutionSystem._ProjScalarMate,0.0);
-    nProj=solutionSystem.GetScalarMateProjNumPerNode();
-    for(ee=eStart;ee<eEnd;++ee){
-        i=ee+1;
-        iInd=(i-1)*(1+nProj)+0;
-        VecGetValues(_ProjSeq,1,&iInd,&weight);
-        VecSetValue(solutionSystem._ProjScalarMate,iInd,weight,ADD_VALUES);
-        for(j=1;j<=nProj;j++){
-            iInd=(i-1)*(nProj+1)+j;
-            VecGetValues(_ProjSeq,1,&iInd,&value);
-            if(abs(weight)>1.0e-15){
-                newvalue=value/weight;
-            }
-            else{
-                newvalue=value;
-            }
-            VecSetValue(solutionSystem._ProjScalarMate,iInd,newvalue,ADD_VALUES);
-        }
-    }
-    VecAssemblyBegin(solutionSystem._ProjScalarMate);
-    VecAssemblyEnd(solutionSystem._ProjScalarMate);
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
+    if(_ProjectionType==ProjectionType::CONSISTENT){
+        MatAssemblyBegin(_ProjMass,MAT_FINAL_ASSEMBLY);
+        MatAssemblyEnd(_ProjMass,MAT_FINAL_ASSEMBLY);
+        MatSetOption(_ProjMass,MAT_SPD,PETSC_TRUE);
 
-    // for projected vector materials
-    VecAssemblyBegin(solutionSystem._ProjVectorMate);
-    VecAssemblyEnd(solutionSystem._ProjVectorMate);
-    VecScatterCreateToAll(solutionSystem._ProjVectorMate,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._ProjVectorMate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._ProjVectorMate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecSet(solutionSystem._ProjVectorMate,0.0);
-    nProj=solutionSystem.GetVectorMateProjNumPerNode();
-    for(ee=eStart;ee<eEnd;++ee){
-        i=ee+1;
-        iInd=(i-1)*(1+nProj*3)+0;
-        VecGetValues(_ProjSeq,1,&iInd,&weight);
-        VecSetValue(solutionSystem._ProjVectorMate,iInd,weight,ADD_VALUES);
-        for(j=1;j<=nProj;j++){
-            for(k=1;k<=3;k++){
-                iInd=(i-1)*(nProj*3+1)+3*(j-1)+k;
-                VecGetValues(_ProjSeq,1,&iInd,&value);
-                if(abs(weight)>1.0e-15){
-                    newvalue=value/weight;
-                }
-                else{
-                    newvalue=value;
-                }
-                VecSetValue(solutionSystem._ProjVectorMate,iInd,newvalue,ADD_VALUES);
-            }
-        }
+        // the mass matrix is SPD and well conditioned, CG+Jacobi is enough.
+        // the options can still be changed via '-proj_ksp_xxx' and '-proj_pc_xxx'
+        PC pc;
+        KSPCreate(PETSC_COMM_WORLD,&_ProjKSP);
+        KSPSetOperators(_ProjKSP,_ProjMass,_ProjMass);
+        KSPSetType(_ProjKSP,KSPCG);
+        KSPGetPC(_ProjKSP,&pc);
+        PCSetType(pc,PCJACOBI);
+        KSPSetTolerances(_ProjKSP,1.0e-10,1.0e-14,PETSC_DEFAULT,500);
+        KSPSetInitialGuessNonzero(_ProjKSP,PETSC_TRUE);
+        KSPSetOptionsPrefix(_ProjKSP,"proj_");
+        KSPSetFromOptions(_ProjKSP);
     }
-    VecAssemblyBegin(solutionSystem._ProjVectorMate);
-    VecAssemblyEnd(solutionSystem._ProjVectorMate);
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
+    _IsProjMassAssembled=true;
+}
+//******************************************************
+void FESystem::Projection(SolutionSystem &solutionSystem){
+    PetscInt i,k,nLocal;
+    PetscScalar *proj;
+    const PetscScalar *diag;
 
-    // for projected rank-2 materials
-    VecAssemblyBegin(solutionSystem._ProjRank2Mate);
-    VecAssemblyEnd(solutionSystem._ProjRank2Mate);
-    VecScatterCreateToAll(solutionSystem._ProjRank2Mate,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._ProjRank2Mate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._ProjRank2Mate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecSet(solutionSystem._ProjRank2Mate,0.0);
-    nProj=solutionSystem.GetRank2MateProjNumPerNode();
-    for(ee=eStart;ee<eEnd;++ee){
-        i=ee+1;
-        iInd=(i-1)*(1+nProj*9)+0;
-        VecGetValues(_ProjSeq,1,&iInd,&weight);
-        VecSetValue(solutionSystem._ProjRank2Mate,iInd,weight,ADD_VALUES);
-        for(j=1;j<=nProj;j++){
-            for(k=1;k<=9;k++){
-                iInd=(i-1)*(nProj*9+1)+9*(j-1)+k;
-                VecGetValues(_ProjSeq,1,&iInd,&value);
-                if(abs(weight)>1.0e-15){
-                    newvalue=value/weight;
-                }
-                else{
-                    newvalue=value;
-                }
-                VecSetValue(solutionSystem._ProjRank2Mate,iInd,newvalue,ADD_VALUES);
-            }
+    VecAssemblyBegin(solutionSystem._Proj);
+    VecAssemblyEnd(solutionSystem._Proj);
+
+    if(!_IsProjMassAssembled) FinalizeProjectionMass();
+
+    if(_ProjectionType==ProjectionType::CONSISTENT){
+        // every component of the nodal block shares the same mass matrix,
+        // the lumped solution is used as the initial guess of CG
+        for(k=0;k<_nProjBlockSize;k++){
+            VecStrideGather(solutionSystem._Proj,k,_ProjRHS,INSERT_VALUES);
+            VecPointwiseDivide(_ProjSol,_ProjRHS,_ProjMassDiag);
+            KSPSolve(_ProjKSP,_ProjRHS,_ProjSol);
+            VecStrideScatter(_ProjSol,k,solutionSystem._Proj,INSERT_VALUES);
         }
+        return;
     }
-    VecAssemblyBegin(solutionSystem._ProjRank2Mate);
-    VecAssemblyEnd(solutionSystem._ProjRank2Mate);
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
 
-    // for projected rank-4 materials
-    VecAssemblyBegin(solutionSystem._ProjRank4Mate);
-    VecAssemblyEnd(solutionSystem._ProjRank4Mate);
-    VecScatterCreateToAll(solutionSystem._ProjRank4Mate,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._ProjRank4Mate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._ProjRank4Mate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecSet(solutionSystem._ProjRank4Mate,0.0);
-    nProj=solutionSystem.GetRank4MateProjNumPerNode();
-    for(ee=eStart;ee<eEnd;++ee){
-        i=ee+1;
-        iInd=(i-1)*(1+nProj*36)+0;
-        VecGetValues(_ProjSeq,1,&iInd,&weight);
-        VecSetValue(solutionSystem._ProjRank4Mate,iInd,weight,ADD_VALUES);
-        for(j=1;j<=nProj;j++){
-            for(k=1;k<=36;k++){
-                iInd=(i-1)*(nProj*36+1)+36*(j-1)+k;
-                VecGetValues(_ProjSeq,1,&iInd,&value);
-                if(abs(weight)>1.0e-15){
-                    newvalue=value/weight;
-                }
-                else{
-                    newvalue=value;
-                }
-                VecSetValue(solutionSystem._ProjRank4Mate,iInd,newvalue,ADD_VALUES);
-            }
+    // for the lumped mass, the ownership range is aligned with the nodal block,
+    // so each rank can scale its own nodes without any communication
+    VecGetLocalSize(solutionSystem._Proj,&nLocal);
+    VecGetArray(solutionSystem._Proj,&proj);
+    VecGetArrayRead(_ProjMassDiag,&diag);
+    for(i=0;i<nLocal/_nProjBlockSize;i++){
+        for(k=0;k<_nProjBlockSize;k++){
+            proj[i*_nProjBlockSize+k]/=diag[i];
         }
     }
-    VecAssemblyBegin(solutionSystem._ProjRank4Mate);
-    VecAssemblyEnd(solutionSystem._ProjRank4Mate);
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
+    VecRestoreArrayRead(_ProjMassDiag,&diag);
+    VecRestoreArray(solutionSystem._Proj,&proj);
 }
@@ -22,13 +22,26 @@ FESystem::FESystem(){
     
     _elConn.clear();_elDofs.clear();
     _elDofsActiveFlag.clear();
-    _elU.clear();_elV.clear();
-    _gpU.clear();_gpV.clear();
     _gpHist.clear();_gpHistOld.clear();_gpProj.clear();
-    _gpGradU.clear();_gpGradV.clear();
+    _gpProjGeneration+=1;
     _MaterialValues.clear();
     _nHist=0;_nProj=0;
     _MaxKMatrixValue=-1.0e3;_KMatrixFactor=0.1;
 
     _localK.Clean();_localR.Clean();
-}
\ No newline at end of file
+}
+//**********************************************************
+void FESystem::ReleaseMem(){
+    // the PETSc destroy functions do nothing for the null objects
+    MatDestroy(&_ProjMass);
+    KSPDestroy(&_ProjKSP);
+    VecDestroy(&_ProjMassDiag);
+    VecDestroy(&_ProjRHS);
+    VecDestroy(&_ProjSol);
+
+    VecScatterDestroy(&_scatteru);
+    VecDestroy(&_Useq);
+    VecDestroy(&_Uoldseq);
+    VecDestroy(&_Vseq);
+    VecDestroy(&_Voldseq);
+}
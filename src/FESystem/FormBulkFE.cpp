@@ -14,6 +14,7 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "FESystem/FESystem.h"
+#include "Utils/Profiler.h"
 
 void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const double &dt,const double (&ctan)[3],
                 Mesh &mesh,const DofHandler &dofHandler,FE &fe,
@@ -21,6 +22,10 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
                 SolutionSystem &solutionSystem,
                 Mat &AMATRIX,Vec &RHS){
     
+    ProfileScope profile(calctype==FECalcType::ComputeResidual?ProfileEvent::FORMRESIDUAL:
+                        (calctype==FECalcType::ComputeJacobian?ProfileEvent::FORMJACOBIAN:
+                        (calctype==FECalcType::Projection?ProfileEvent::PROJECTION:ProfileEvent::UPDATEMATERIAL)));
+
     if(calctype==FECalcType::ComputeResidual){
         VecSet(RHS,0.0);
     }
@@ -29,14 +34,11 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
     }
     else if(calctype==FECalcType::Projection){
         VecSet(solutionSystem._Proj,0.0);
-        VecSet(solutionSystem._ProjScalarMate,0.0);
-        VecSet(solutionSystem._ProjVectorMate,0.0);
-        VecSet(solutionSystem._ProjRank2Mate,0.0);
-        VecSet(solutionSystem._ProjRank4Mate,0.0);
     }
     else if(calctype==FECalcType::InitMaterial||
             calctype==FECalcType::UpdateMaterial){
-        // do nothing!
+        // the solution and the history variables are changed, the projected ones are no longer valid
+        solutionSystem.MarkProjectionOutdated();
     }
     else{
         MessagePrinter::PrintErrorTxt("unsupported calculation type in FormBulkFE, please check your code");
@@ -48,22 +50,19 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
 
     // we can get the correct value on the ghosted node!
     // please keep in mind, we will always use Utemp and V in SNES !!!
-    VecScatterCreateToAll(solutionSystem._Utemp,&_scatteru,&_Useq);
+    // the scatter is created in InitBulkFESystem, it only moves the dofs of the local elements
     VecScatterBegin(_scatteru,solutionSystem._Utemp,_Useq,INSERT_VALUES,SCATTER_FORWARD);
     VecScatterEnd(_scatteru,solutionSystem._Utemp,_Useq,INSERT_VALUES,SCATTER_FORWARD);
 
-    VecScatterCreateToAll(solutionSystem._V,&_scatterv,&_Vseq);
-    VecScatterBegin(_scatterv,solutionSystem._V,_Vseq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterv,solutionSystem._V,_Vseq,INSERT_VALUES,SCATTER_FORWARD);
+    VecScatterBegin(_scatteru,solutionSystem._V,_Vseq,INSERT_VALUES,SCATTER_FORWARD);
+    VecScatterEnd(_scatteru,solutionSystem._V,_Vseq,INSERT_VALUES,SCATTER_FORWARD);
 
     // for the disp and velocity in the previous step
-    VecScatterCreateToAll(solutionSystem._U,&_scatteruold,&_Uoldseq);
-    VecScatterBegin(_scatteruold,solutionSystem._U,_Uoldseq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatteruold,solutionSystem._U,_Uoldseq,INSERT_VALUES,SCATTER_FORWARD);
+    VecScatterBegin(_scatteru,solutionSystem._U,_Uoldseq,INSERT_VALUES,SCATTER_FORWARD);
+    VecScatterEnd(_scatteru,solutionSystem._U,_Uoldseq,INSERT_VALUES,SCATTER_FORWARD);
 
-    VecScatterCreateToAll(solutionSystem._Vold,&_scattervold,&_Voldseq);
-    VecScatterBegin(_scattervold,solutionSystem._Vold,_Voldseq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scattervold,solutionSystem._Vold,_Voldseq,INSERT_VALUES,SCATTER_FORWARD);
+    VecScatterBegin(_scatteru,solutionSystem._Vold,_Voldseq,INSERT_VALUES,SCATTER_FORWARD);
+    VecScatterEnd(_scatteru,solutionSystem._Vold,_Voldseq,INSERT_VALUES,SCATTER_FORWARD);
 
     int rankne=mesh.GetBulkMeshBulkElmtsNum()/_size;
     int eStart=_rank*rankne;
@@ -71,80 +70,158 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
     if(_rank==_size-1) eEnd=mesh.GetBulkMeshBulkElmtsNum();
 
     PetscInt nDofs,nNodes,nDofsPerNode,nDofsPerSubElmt,e;
+    const PetscInt *localDofs;
     PetscInt i,j,jj;
-    PetscInt nDim,gpInd;
-    PetscReal xi,eta,zeta,w,JxW,DetJac,elVolume;
+    PetscInt nDim,gpInd,nQpPoints,tpInd;
+    bool UseSumFactorization,IsLumpedMass,UseResidualFlux,UseShapeFun;
+    PetscReal xi,eta,zeta,w,JxW,DetJac,elVolume,hgstiffness;
+    PetscReal u,uold,v,vold;
+    Vector3d gradu,graduold,gradv,gradvold;
     nDim=mesh.GetDim();
 
     _BulkVolumes=0.0;
     for(int ee=eStart;ee<eEnd;++ee){
-        e=ee+1;
+        e=dofHandler.GetIthBulkElmtIDInLoopOrder(ee+1);
         mesh.GetBulkMeshIthBulkElmtNodes(e,_elNodes);
         mesh.GetBulkMeshIthBulkElmtConn(e,_elConn);
         dofHandler.GetBulkMeshIthBulkElmtDofIndex0(e,_elDofs,_elDofsActiveFlag);
         nDofs=dofHandler.GetBulkMeshIthBulkElmtDofsNum(e);
         nNodes=mesh.GetBulkMeshIthBulkElmtNodesNum(e);
         nDofsPerNode=nDofs/nNodes;
+        // the gauss points are decided by the [elmt] block(s) of current element
+        QPoint &qpoint=fe.GetIthBlockBulkQPointPtr(dofHandler.GetBulkMeshIthBulkElmtQpBlockID(e));
+        TensorProductKernel &tpkernel=fe.GetIthBlockBulkKernelPtr(dofHandler.GetBulkMeshIthBulkElmtQpBlockID(e));
+        nQpPoints=qpoint.GetQpPointsNum();
 
-        // for the disp and velocity in current time step
-        VecGetValues(_Useq,nDofs,_elDofs.data(),_elU.data());
-        VecGetValues(_Vseq,nDofs,_elDofs.data(),_elV.data());
+        // for the disp and velocity in current time step, the sequential vectors are indexed by the local dofs
+        localDofs=_LocalElmtDofs.data()+_LocalElmtDofsOffset[ee-eStart];
+        VecGetValues(_Useq,nDofs,localDofs,_elU.data());
+        VecGetValues(_Vseq,nDofs,localDofs,_elV.data());
         // for the disp and velocity in the previous time step
-        VecGetValues(_Uoldseq,nDofs,_elDofs.data(),_elUold.data());
-        VecGetValues(_Voldseq,nDofs,_elDofs.data(),_elVold.data());
+        VecGetValues(_Uoldseq,nDofs,localDofs,_elUold.data());
+        VecGetValues(_Voldseq,nDofs,localDofs,_elVold.data());
+
+        // for the tensor-product elements, the solution and its gradient on all the gauss points are
+        // interpolated once by sum-factorization, instead of the node-by-node loop on each gauss point
+        UseSumFactorization=tpkernel.IsActive()&&tpkernel.CalcGeometry(_elNodes);
+        if(UseSumFactorization){
+            for(jj=1;jj<=nDofsPerNode;jj++){
+                tpInd=(jj-1)*nQpPoints;
+                tpkernel.Interpolate(_elU.data()+jj-1,nDofsPerNode,_tpU.data()+tpInd,_tpGradU.data()+tpInd);
+                tpkernel.Interpolate(_elUold.data()+jj-1,nDofsPerNode,_tpUOld.data()+tpInd,_tpGradUOld.data()+tpInd);
+                tpkernel.Interpolate(_elV.data()+jj-1,nDofsPerNode,_tpV.data()+tpInd,_tpGradV.data()+tpInd);
+                tpkernel.Interpolate(_elVold.data()+jj-1,nDofsPerNode,_tpVOld.data()+tpInd,_tpGradVOld.data()+tpInd);
+            }
+        }
+        // for the built-in materials with a batched kernel, all the gauss points of current element are
+        // calculated in one call, then each gauss point only copies its own results to the materials
+        for(int ielmt=1;ielmt<=dofHandler.GetBulkMeshIthBulkElmtSubElmtsNum(e);ielmt++){
+            matetype=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtMateType(e,ielmt);
+            localDofIndex=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtDofIndex(e,ielmt);
+            _IsBatchMate[ielmt-1]=UseSumFactorization&&calctype!=FECalcType::InitMaterial&&
+                                  BulkMateSystem::IsBatchMateType(matetype)&&
+                                  static_cast<int>(localDofIndex.size())>=nDim;
+            if(!_IsBatchMate[ielmt-1]) continue;
+            MateBatch &batch=_MateBatches[ielmt-1];
+            batch.Resize(nQpPoints,BulkMateSystem::GetBatchMateHistNum(matetype));
+            // the displacement gradient is made of the first nDim dofs, the same as ComputeStrain
+            for(i=1;i<=3;i++){
+                for(j=1;j<=3;j++){
+                    for(gpInd=1;gpInd<=nQpPoints;gpInd++){
+                        batch.GradU[((i-1)*3+j-1)*nQpPoints+gpInd-1]=(i<=nDim&&j<=nDim)?
+                            _tpGradU[(localDofIndex[i-1]-1)*nQpPoints+gpInd-1](j):0.0;
+                    }
+                }
+            }
+            for(gpInd=1;gpInd<=nQpPoints;gpInd++){
+                mateSystem.PackBulkMateBatchOld(matetype,gpInd-1,
+                                                solutionSystem._ScalarMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                                solutionSystem._Rank2TensorMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                                batch);
+            }
+            mateSystem.RunBulkMateBatchLibs(matetype,dofHandler.GetBulkMeshIthBulkElmtJthSubElmtMateIndex(e,ielmt),batch);
+        }
         
+        // for the sum-factorization, the node loop of the residual is done by TensorProductKernel::Integrate,
+        // except the lumped mass, whose time derivative term depends on the nodal rate of each test function
+        UseResidualFlux=UseSumFactorization&&calctype==FECalcType::ComputeResidual;
+        for(int ielmt=1;ielmt<=dofHandler.GetBulkMeshIthBulkElmtSubElmtsNum(e)&&UseResidualFlux;ielmt++){
+            if(dofHandler.IsBulkMeshIthBulkElmtJthSubElmtLumpedMass(e,ielmt)) UseResidualFlux=false;
+        }
+        // the shape functions are only required by the node loops of the jacobian and projection,
+        // the materials and the residual(sum-factorization) only use the quantities on the gauss points
+        UseShapeFun=!UseSumFactorization||calctype==FECalcType::ComputeJacobian||calctype==FECalcType::Projection||
+                    (calctype==FECalcType::ComputeResidual&&!UseResidualFlux);
+
         if(calctype==FECalcType::ComputeResidual){
             fill(_R.begin(),_R.end(),0.0);
+            if(UseResidualFlux){
+                fill(_tpResVal.begin(),_tpResVal.end(),0.0);
+                fill(_tpResFlux.begin(),_tpResFlux.end(),Vector3d(0.0));
+            }
         }
         else if(calctype==FECalcType::ComputeJacobian){
             fill(_K.begin(),_K.end(),0.0);
         }
         else if(calctype==FECalcType::Projection){
             for(auto &it:_gpProj) it.second=0.0;
+            fill(_elProj.begin(),_elProj.end(),0.0);
         }
         
         xi=0.0;eta=0.0;zeta=0.0;DetJac=1.0;w=1.0;
         elVolume=0.0;
-        for(gpInd=1;gpInd<=fe._BulkQPoint.GetQpPointsNum();++gpInd){
+        for(gpInd=1;gpInd<=nQpPoints;++gpInd){
             // init all the local K&R array/matrix
             // get local history(old) value on each gauss point
             if(calctype!=FECalcType::InitMaterial){
                 // the scalar/vector/rank-2/rank-4 materials in MateSystem is used by each quadrature point, so it is only used for one single gauss point. The materials of the whole system is stored in solution's materials array!!!
-                mateSystem.GetScalarMateOldPtr()=solutionSystem._ScalarMaterialsOld[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1];
-                mateSystem.GetVectorMateOldPtr()=solutionSystem._VectorMaterialsOld[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1];
-                mateSystem.GetRank2MateOldPtr()=solutionSystem._Rank2TensorMaterialsOld[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1];
-                mateSystem.GetRank4MateOldPtr()=solutionSystem._Rank4TensorMaterialsOld[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1];
+                // the old ones are swapped in(not copied), and they are given back after the sub element loop
+                mateSystem.SwapMaterialsOld(solutionSystem._ScalarMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                            solutionSystem._VectorMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                            solutionSystem._Rank2TensorMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                            solutionSystem._Rank4TensorMaterialsOld[(e-1)*_nGPoints+gpInd-1]);
             }
             // calculate the current shape funs on each gauss point
-            if(nDim==1){
-                w =fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,0);
-                xi=fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,1);
+            if(!UseShapeFun){
+                w=qpoint.GetIthQpPointJthCoord(gpInd,0);
+                DetJac=tpkernel.GetIthQpDetJac(gpInd);
+            }
+            else if(nDim==1){
+                w =qpoint.GetIthQpPointJthCoord(gpInd,0);
+                xi=qpoint.GetIthQpPointJthCoord(gpInd,1);
                 fe._BulkShp.Calc(xi,_elNodes,true);
                 DetJac=fe._BulkShp.GetDetJac();
             }
             else if(nDim==2){
-                w  =fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,0);
-                xi =fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,1);
-                eta=fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,2);
+                w  =qpoint.GetIthQpPointJthCoord(gpInd,0);
+                xi =qpoint.GetIthQpPointJthCoord(gpInd,1);
+                eta=qpoint.GetIthQpPointJthCoord(gpInd,2);
                 fe._BulkShp.Calc(xi,eta,_elNodes,true);
                 DetJac=fe._BulkShp.GetDetJac();
             }
             else if(nDim==3){
-                w   =fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,0);
-                xi  =fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,1);
-                eta =fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,2);
-                zeta=fe._BulkQPoint.GetIthQpPointJthCoord(gpInd,3);
+                w   =qpoint.GetIthQpPointJthCoord(gpInd,0);
+                xi  =qpoint.GetIthQpPointJthCoord(gpInd,1);
+                eta =qpoint.GetIthQpPointJthCoord(gpInd,2);
+                zeta=qpoint.GetIthQpPointJthCoord(gpInd,3);
                 fe._BulkShp.Calc(xi,eta,zeta,_elNodes,true);
                 DetJac=fe._BulkShp.GetDetJac();
             }
             JxW=w*DetJac;
             elVolume+=1.0*JxW;
             // calculate the coordinate of current gauss point
-            _gpCoord(1)=0.0;_gpCoord(2)=0.0;_gpCoord(3)=0.0;
-            for(i=1;i<=nNodes;++i){
-                _gpCoord(1)+=_elNodes(i,1)*fe._BulkShp.shape_value(i);
-                _gpCoord(2)+=_elNodes(i,2)*fe._BulkShp.shape_value(i);
-                _gpCoord(3)+=_elNodes(i,3)*fe._BulkShp.shape_value(i);
+            if(UseSumFactorization){
+                _gpCoord(1)=tpkernel.GetIthQpJthCoord(gpInd,1);
+                _gpCoord(2)=tpkernel.GetIthQpJthCoord(gpInd,2);
+                _gpCoord(3)=tpkernel.GetIthQpJthCoord(gpInd,3);
+            }
+            else{
+                _gpCoord(1)=0.0;_gpCoord(2)=0.0;_gpCoord(3)=0.0;
+                for(i=1;i<=nNodes;++i){
+                    _gpCoord(1)+=_elNodes(i,1)*fe._BulkShp.shape_value(i);
+                    _gpCoord(2)+=_elNodes(i,2)*fe._BulkShp.shape_value(i);
+                    _gpCoord(3)+=_elNodes(i,3)*fe._BulkShp.shape_value(i);
+                }
             }
             
             
@@ -159,19 +236,19 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
             }
             //else if(calctype==FECalcType::InitMaterial||calctype==FECalcType::UpdateMaterial){
             //    // initialize the current material solution space
-            //    for(auto &it:solutionSystem._ScalarMaterials[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1]) it.second=0.0;
-            //    for(auto &it:solutionSystem._VectorMaterials[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1]) it.second=0.0;
-            //    for(auto &it:solutionSystem._Rank2TensorMaterials[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1]) it.second=0.0;
-            //    for(auto &it:solutionSystem._Rank4TensorMaterials[(e-1)*fe._BulkQPoint.GetQpPointsNum()+gpInd-1]) it.second=0.0;
+            //    for(auto &it:solutionSystem._ScalarMaterials[(e-1)*_nGPoints+gpInd-1]) it.second=0.0;
+            //    for(auto &it:solutionSystem._VectorMaterials[(e-1)*_nGPoints+gpInd-1]) it.second=0.0;
+            //    for(auto &it:solutionSystem._Rank2TensorMaterials[(e-1)*_nGPoints+gpInd-1]) it.second=0.0;
+            //    for(auto &it:solutionSystem._Rank4TensorMaterials[(e-1)*_nGPoints+gpInd-1]) it.second=0.0;
             //}
             // now we do the loop for local element, *local element could have multiple contributors according
             // to your model, i.e. one element (or one domain) can be assigned by multiple [elmt] sub block in your input file !!!
-            for(int ielmt=1;ielmt<=static_cast<int>(dofHandler.GetBulkMeshIthBulkElmtElmtMateTypePair(e).size());ielmt++){
-                elmttype=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtElmtType(e,ielmt);
+            for(int ielmt=1;ielmt<=dofHandler.GetBulkMeshIthBulkElmtSubElmtsNum(e);ielmt++){
                 matetype=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtMateType(e,ielmt);
                 localDofIndex=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtDofIndex(e,ielmt);
                 mateindex=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtMateIndex(e,ielmt);
-                nDofsPerSubElmt=static_cast<int>(localDofIndex.size());
+                nDofsPerSubElmt=localDofIndex.size();
+                IsLumpedMass=dofHandler.IsBulkMeshIthBulkElmtJthSubElmtLumpedMass(e,ielmt);
 
                 // now we calculate the local dofs and their derivatives
                 // *this is only the local one, which means, i.e., if current element use dofs=u v
@@ -182,45 +259,41 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
                 // of a single gauss point according to each sub [elmt] block
                 for(j=1;j<=nDofsPerSubElmt;j++){
                     // !!!: the index starts from 1, not 0, please following the same way in your UEL !!!
-                    _gpU[j]=0.0;_gpV[j]=0.0;_gpUOld[j]=0.0;_gpVOld[j]=0.0;
-                    _gpGradU[j](1)=0.0;_gpGradU[j](2)=0.0;_gpGradU[j](3)=0.0;
-                    _gpGradUOld[j](1)=0.0;_gpGradUOld[j](2)=0.0;_gpGradUOld[j](3)=0.0;
-                    _gpGradV[j](1)=0.0;_gpGradV[j](2)=0.0;_gpGradV[j](3)=0.0;
-                    _gpGradVOld[j](1)=0.0;_gpGradVOld[j](2)=0.0;_gpGradVOld[j](3)=0.0;
+                    if(UseSumFactorization){
+                        tpInd=(localDofIndex[j-1]-1)*nQpPoints+gpInd-1;
+                        _gpU[j]=_tpU[tpInd];_gpUOld[j]=_tpUOld[tpInd];
+                        _gpV[j]=_tpV[tpInd];_gpVOld[j]=_tpVOld[tpInd];
+                        _gpGradU[j]=_tpGradU[tpInd];_gpGradUOld[j]=_tpGradUOld[tpInd];
+                        _gpGradV[j]=_tpGradV[tpInd];_gpGradVOld[j]=_tpGradVOld[tpInd];
+                        continue;
+                    }
+                    // the sums are kept in the local variables, then each gauss point's array is written once
                     jj=localDofIndex[j-1];
+                    u=0.0;uold=0.0;v=0.0;vold=0.0;
+                    gradu.setZero();graduold.setZero();
+                    gradv.setZero();gradvold.setZero();
                     for(i=1;i<=nNodes;++i){
-                        _gpU[j]+=_elU[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_value(i);
-                        _gpUOld[j]+=_elUold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_value(i);
-
-                        _gpV[j]+=_elV[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_value(i);
-                        _gpVOld[j]+=_elVold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_value(i);
-
-                        _gpGradU[j](1)+=_elU[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(1);
-                        _gpGradU[j](2)+=_elU[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(2);
-                        _gpGradU[j](3)+=_elU[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(3);
-
-                        _gpGradUOld[j](1)+=_elUold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(1);
-                        _gpGradUOld[j](2)+=_elUold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(2);
-                        _gpGradUOld[j](3)+=_elUold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(3);
-
-                        _gpGradV[j](1)+=_elV[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(1);
-                        _gpGradV[j](2)+=_elV[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(2);
-                        _gpGradV[j](3)+=_elV[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(3);
-
-                        _gpGradVOld[j](1)+=_elVold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(1);
-                        _gpGradVOld[j](2)+=_elVold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(2);
-                        _gpGradVOld[j](3)+=_elVold[(i-1)*nDofsPerNode+jj-1]*fe._BulkShp.shape_grad(i)(3);
+                        const double shpval=fe._BulkShp.shape_value(i);
+                        const Vector3d &shpgrad=fe._BulkShp.shape_grad(i);
+                        const double elu=_elU[(i-1)*nDofsPerNode+jj-1];
+                        const double eluold=_elUold[(i-1)*nDofsPerNode+jj-1];
+                        const double elv=_elV[(i-1)*nDofsPerNode+jj-1];
+                        const double elvold=_elVold[(i-1)*nDofsPerNode+jj-1];
+                        u+=elu*shpval;uold+=eluold*shpval;
+                        v+=elv*shpval;vold+=elvold*shpval;
+                        for(int k=1;k<=3;k++){
+                            gradu(k)+=elu*shpgrad(k);
+                            graduold(k)+=eluold*shpgrad(k);
+                            gradv(k)+=elv*shpgrad(k);
+                            gradvold(k)+=elvold*shpgrad(k);
+                        }
                     }
+                    _gpU[j]=u;_gpUOld[j]=uold;
+                    _gpV[j]=v;_gpVOld[j]=vold;
+                    _gpGradU[j]=gradu;_gpGradUOld[j]=graduold;
+                    _gpGradV[j]=gradv;_gpGradVOld[j]=gradvold;
                 }
-                // for local soln structure
-                _elmtsoln.gpGradU=_gpGradU;
-                _elmtsoln.gpGradUold=_gpGradUOld;
-                _elmtsoln.gpGradV=_gpGradV;
-                _elmtsoln.gpGradVold=_gpGradVOld;
-                _elmtsoln.gpU=_gpU;
-                _elmtsoln.gpUold=_gpUOld;
-                _elmtsoln.gpV=_gpV;
-                _elmtsoln.gpVold=_gpVOld;
+                // _elmtsoln is the view of the gauss point's arrays, so there is nothing to copy here
 
                 if(calctype==FECalcType::ComputeResidual){
                     _subR.setZero();
@@ -241,55 +314,35 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
                 if(calctype==FECalcType::InitMaterial){
                     mateSystem.InitBulkMateLibs(matetype,mateindex,_elmtinfo,_elmtsoln);
                 }
+                else if(_IsBatchMate[ielmt-1]){
+                    mateSystem.UnpackBulkMateBatch(matetype,gpInd-1,_MateBatches[ielmt-1]);
+                }
                 else{
                     mateSystem.RunBulkMateLibs(matetype,mateindex,_elmtinfo,_elmtsoln);
                 }
                 //*****************************************************
                 //*** For user element calculation(UEL)
                 //*****************************************************
-                if(calctype==FECalcType::ComputeResidual){
-                    for(i=1;i<=nNodes;i++){
-                        // for local shape function
-                        _elmtshp.test=fe._BulkShp.shape_value(i);
-                        _elmtshp.trial=fe._BulkShp.shape_value(i);
-                        _elmtshp.grad_test=fe._BulkShp.shape_grad(i);
-                        _elmtshp.grad_trial=fe._BulkShp.shape_grad(i);
-                        
-                        elmtSystem.RunBulkElmtLibs(calctype,elmttype,ctan,_elmtinfo,_elmtsoln,_elmtshp,mateSystem.GetMaterialsPtr(),mateSystem.GetMaterialsOldPtr(),_gpProj,_subK,_subR);
-                        AssembleSubResidualToLocalResidual(nDofsPerNode,nDofsPerSubElmt,i,_subR,_localR);
-                    }
-                }
-                else if(calctype==FECalcType::ComputeJacobian){
-                    for(i=1;i<=nNodes;i++){
-                        for(j=1;j<=nNodes;j++){
-                            // for local shape function
-                            _elmtshp.test=fe._BulkShp.shape_value(i);
-                            _elmtshp.trial=fe._BulkShp.shape_value(j);
-                            _elmtshp.grad_test=fe._BulkShp.shape_grad(i);
-                            _elmtshp.grad_trial=fe._BulkShp.shape_grad(j);
-
-                            elmtSystem.RunBulkElmtLibs(calctype,elmttype,ctan,_elmtinfo,_elmtsoln,_elmtshp,mateSystem.GetMaterialsPtr(),mateSystem.GetMaterialsOldPtr(),_gpProj,_subK,_subR);
-                            
-                            AssembleSubJacobianToLocalJacobian(nDofsPerNode,i,j,_subK,_localK);
+                // the node loops of the [elmt] block are selected in InitBulkFESystem, no element type dispatch here
+                SubElmtLoop subelmtloop=_SubElmtLoops[dofHandler.GetBulkMeshIthBulkElmtJthSubElmtBlockID(e,ielmt)-1];
+                if(subelmtloop!=nullptr){
+                    (this->*subelmtloop)(calctype,ctan,elmtSystem,nNodes,nDofsPerNode,nDofsPerSubElmt,IsLumpedMass,
+                                         UseResidualFlux,fe._BulkShp,mateSystem.GetMaterialsPtr(),mateSystem.GetMaterialsOldPtr());
+                    if(UseResidualFlux){
+                        for(j=1;j<=nDofsPerSubElmt;j++){
+                            tpInd=(localDofIndex[j-1]-1)*nQpPoints+gpInd-1;
+                            _tpResVal[tpInd]+=_gpResVal[j]*JxW;
+                            _tpResFlux[tpInd]+=_gpResFlux[j]*JxW;
                         }
                     }
                 }
-                else if(calctype==FECalcType::Projection){
-                    for(i=1;i<=nNodes;i++){
-                        // for local shape function
-                        _elmtshp.test=fe._BulkShp.shape_value(i);
-                        _elmtshp.trial=fe._BulkShp.shape_value(i);
-                        _elmtshp.grad_test=fe._BulkShp.shape_grad(i);
-                        _elmtshp.grad_trial=fe._BulkShp.shape_grad(i);
-                        
-                        elmtSystem.RunBulkElmtLibs(calctype,elmttype,ctan,_elmtinfo,_elmtsoln,_elmtshp,mateSystem.GetMaterialsPtr(),mateSystem.GetMaterialsOldPtr(),_gpProj,_subK,_subR);
-                    }
-                    // here we should not assemble the local projection, because the JxW should not be accumulated
-                    // inside the element-loop, but the gpProj should be.
-                    // therefore, each sub element should use its own place of gpProj, in short, the gpProj is shared
-                    // between different elements
-                }
             }//=====> end-of-sub-element-loop
+            if(calctype!=FECalcType::InitMaterial){
+                mateSystem.SwapMaterialsOld(solutionSystem._ScalarMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                            solutionSystem._VectorMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                            solutionSystem._Rank2TensorMaterialsOld[(e-1)*_nGPoints+gpInd-1],
+                                            solutionSystem._Rank4TensorMaterialsOld[(e-1)*_nGPoints+gpInd-1]);
+            }
 
             //***********************************************
             //*** accumulate all the local contribution inside gauss loop
@@ -300,17 +353,50 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
                 AccumulateLocalJacobian(nDofs,_elDofsActiveFlag,JxW,_localK,_K);
             }
             else if(calctype==FECalcType::Projection){
-                AssembleLocalProjectionToGlobal(nNodes,JxW,fe._BulkShp,_gpProj,
-                                                mateSystem.GetScalarMatePtr(),
-                                                mateSystem.GetVectorMatePtr(),
-                                                mateSystem.GetRank2MatePtr(),
-                                                mateSystem.GetRank4MatePtr(),
-                                                solutionSystem);
+                AccumulateLocalProjection(nNodes,JxW,fe._BulkShp,_gpProj,
+                                          mateSystem.GetScalarMatePtr(),
+                                          mateSystem.GetVectorMatePtr(),
+                                          mateSystem.GetRank2MatePtr(),
+                                          mateSystem.GetRank4MatePtr(),
+                                          mateSystem.GetMaterialsGeneration());
             }
             else if(calctype==FECalcType::InitMaterial||calctype==FECalcType::UpdateMaterial){
-                AssembleLocalMaterialsToGlobal(e,fe._BulkQPoint.GetQpPointsNum(),gpInd,mateSystem.GetMaterialsPtr(),solutionSystem);
+                AssembleLocalMaterialsToGlobal(e,_nGPoints,gpInd,mateSystem.GetMaterialsPtr(),solutionSystem);
             }
         }//----->end of gauss point loop
+
+        if(UseResidualFlux){
+            // all the gauss points are summed up to the nodes by the transpose of the interpolation
+            for(jj=1;jj<=nDofsPerNode;jj++){
+                tpInd=(jj-1)*nQpPoints;
+                tpkernel.Integrate(_tpResVal.data()+tpInd,_tpResFlux.data()+tpInd,nDofsPerNode,_R.data()+jj-1);
+            }
+            // the flags are either 0 or 1, so the contribution of the node loops above is not changed
+            for(i=0;i<nDofs;i++) _R[i]*=_elDofsActiveFlag[i];
+        }
+
+        // for the one-point integration, the shape functions are still the ones on the element center
+        if(calctype==FECalcType::ComputeResidual||calctype==FECalcType::ComputeJacobian){
+            for(int ielmt=1;ielmt<=dofHandler.GetBulkMeshIthBulkElmtSubElmtsNum(e);ielmt++){
+                hgstiffness=dofHandler.GetBulkMeshIthBulkElmtJthSubElmtHourglassStiffness(e,ielmt);
+                if(hgstiffness>0.0&&!UseShapeFun){
+                    // the shape functions are skipped inside the gauss point loop, the one-point rule is the center
+                    if(nDim==2){
+                        fe._BulkShp.Calc(0.0,0.0,_elNodes,true);
+                    }
+                    else{
+                        fe._BulkShp.Calc(0.0,0.0,0.0,_elNodes,true);
+                    }
+                    UseShapeFun=true;
+                }
+                if(hgstiffness>0.0){
+                    AccumulateHourglassStabilization(calctype,nDim,nNodes,nDofsPerNode,
+                                                     dofHandler.GetBulkMeshIthBulkElmtJthSubElmtDofIndex(e,ielmt),
+                                                     hgstiffness,
+                                                     elVolume,ctan,fe._BulkShp,_elNodes,_elU,_elDofsActiveFlag,_K,_R);
+                }
+            }
+        }
         mesh.SetBulkMeshIthBulkElmtVolume(e,elVolume);
         _BulkVolumes+=elVolume;
 
@@ -321,8 +407,11 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
         else if(calctype==FECalcType::ComputeJacobian){
             AssembleLocalJacobianToGlobalJacobian(nDofs,_elDofs,_K,AMATRIX);
         }
+        else if(calctype==FECalcType::Projection){
+            AssembleLocalProjectionToGlobal(nNodes,solutionSystem._Proj);
+        }
         //else if(calctype==FECalcType::InitMaterial||calctype==FECalcType::UpdateMaterial){
-        //    AssembleLocalHistToGlobal(e,fe._BulkQPoint.GetQpPointsNum(),solutionSystem);
+        //    AssembleLocalHistToGlobal(e,_nGPoints,solutionSystem);
         //}
     }//------>end of element loop
 
@@ -338,22 +427,8 @@ void FESystem::FormBulkFE(const FECalcType &calctype,const double &t,const doubl
         MatAssemblyEnd(AMATRIX,MAT_FINAL_ASSEMBLY);
     }
     else if(calctype==FECalcType::Projection){
-        Projection(mesh.GetBulkMeshNodesNum(),solutionSystem);
+        Projection(solutionSystem);
+        solutionSystem.MarkProjectionUpdated();
     }
 
-
-
-
-    // delete scatter
-    VecScatterDestroy(&_scatteru);
-    VecScatterDestroy(&_scatteruold);
-    VecScatterDestroy(&_scatterv);
-    VecScatterDestroy(&_scattervold);
-
-    VecDestroy(&_Useq);
-    VecDestroy(&_Uoldseq);
-
-    VecDestroy(&_Vseq);
-    VecDestroy(&_Voldseq);
-
 }
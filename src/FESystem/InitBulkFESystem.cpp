@@ -27,35 +27,40 @@ void FESystem::InitBulkFESystem(const Mesh &mesh,
     }
     _elDofs.reserve(dofHandler.GetMaxDofsNumPerBulkElmt());
     _elDofsActiveFlag.reserve(dofHandler.GetMaxDofsNumPerBulkElmt());
-    _elU.reserve(dofHandler.GetMaxDofsNumPerBulkElmt());
-    _elV.reserve(dofHandler.GetMaxDofsNumPerBulkElmt());
-    _elUold.reserve(dofHandler.GetMaxDofsNumPerBulkElmt());
-    _elVold.reserve(dofHandler.GetMaxDofsNumPerBulkElmt());
     for(int i=0;i<dofHandler.GetMaxDofsNumPerBulkElmt();++i){
         _elDofs.push_back(0);
         _elDofsActiveFlag.push_back(1.0);
-        _elU.push_back(0.0);
-        _elV.push_back(0.0);
-        _elUold.push_back(0.0);
-        _elVold.push_back(0.0);
     }
 
-    _gpU.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpV.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpUOld.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpVOld.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpGradU.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpGradV.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpGradUOld.reserve(dofHandler.GetDofsNumPerNode()+1);
-    _gpGradVOld.reserve(dofHandler.GetDofsNumPerNode()+1);
-    for(int i=0;i<dofHandler.GetDofsNumPerNode()+1;++i){
-        _gpU.push_back(0.0);_gpUOld.push_back(0.0);
-        _gpV.push_back(0.0);_gpVOld.push_back(0.0);
-        _gpGradU.push_back(Vector3d(0.0));
-        _gpGradV.push_back(Vector3d(0.0));
-        _gpGradUOld.push_back(Vector3d(0.0));
-        _gpGradVOld.push_back(Vector3d(0.0));
-    }
+    // all the scratch arrays of the local element come from one memory block, the gauss point's
+    // arrays start from 1(the same as the UEL), so one more element is allocated
+    const int nElDofs=dofHandler.GetMaxDofsNumPerBulkElmt();
+    const int nGpDofs=dofHandler.GetDofsNumPerNode()+1;
+    _elArena.Reserve(4*ScratchArena::BytesOf<double>(nElDofs)
+                    +6*ScratchArena::BytesOf<double>(nGpDofs)
+                    +5*ScratchArena::BytesOf<Vector3d>(nGpDofs));
+    _elU=_elArena.Allocate<double>(nElDofs,0.0);
+    _elV=_elArena.Allocate<double>(nElDofs,0.0);
+    _elUold=_elArena.Allocate<double>(nElDofs,0.0);
+    _elVold=_elArena.Allocate<double>(nElDofs,0.0);
+
+    _gpU=_elArena.Allocate<double>(nGpDofs,0.0);
+    _gpV=_elArena.Allocate<double>(nGpDofs,0.0);
+    _gpUOld=_elArena.Allocate<double>(nGpDofs,0.0);
+    _gpVOld=_elArena.Allocate<double>(nGpDofs,0.0);
+    _gpVLumped=_elArena.Allocate<double>(nGpDofs,0.0);
+    _gpGradU=_elArena.Allocate<Vector3d>(nGpDofs,Vector3d(0.0));
+    _gpGradV=_elArena.Allocate<Vector3d>(nGpDofs,Vector3d(0.0));
+    _gpGradUOld=_elArena.Allocate<Vector3d>(nGpDofs,Vector3d(0.0));
+    _gpGradVOld=_elArena.Allocate<Vector3d>(nGpDofs,Vector3d(0.0));
+    _gpResVal=_elArena.Allocate<double>(nGpDofs,0.0);
+    _gpResFlux=_elArena.Allocate<Vector3d>(nGpDofs,Vector3d(0.0));
+
+    // the UEL and UMAT read the gauss point's arrays directly
+    _elmtsoln.gpU=_gpU;_elmtsoln.gpUold=_gpUOld;
+    _elmtsoln.gpV=_gpV;_elmtsoln.gpVold=_gpVOld;
+    _elmtsoln.gpGradU=_gpGradU;_elmtsoln.gpGradUold=_gpGradUOld;
+    _elmtsoln.gpGradV=_gpGradV;_elmtsoln.gpGradVold=_gpGradVOld;
 
     
     _nHist=solution.GetHistNumPerGPoint();
@@ -70,9 +75,33 @@ void FESystem::InitBulkFESystem(const Mesh &mesh,
     }
 
     _gpProj.clear();
+    _gpProjGeneration+=1;
+    InitProjection(mesh,dofHandler,solution);
     
 
-    _nGPoints=fe._BulkQPoint.GetQpPointsNum();
+    // the materials of each bulk element are stored with the maximum gauss points number of all the [elmt] blocks
+    _nGPoints=fe.GetMaxBulkQpPointsNum();
+
+    // the solution on all the gauss points of one element, it is used by the sum-factorization kernel
+    _tpU.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),0.0);
+    _tpV.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),0.0);
+    _tpUOld.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),0.0);
+    _tpVOld.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),0.0);
+    _tpGradU.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),Vector3d(0.0));
+    _tpGradV.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),Vector3d(0.0));
+    _tpGradUOld.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),Vector3d(0.0));
+    _tpGradVOld.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),Vector3d(0.0));
+    _tpResVal.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),0.0);
+    _tpResFlux.assign(_nGPoints*dofHandler.GetDofsNumPerNode(),Vector3d(0.0));
+    // the element type is fixed for each [elmt] block, so the node loops are selected here, not inside the element loop
+    _SubElmtLoops.clear();
+    for(const auto &it:dofHandler.GetElmtBlockElmtMateTypePairList()){
+        _SubElmtLoops.push_back(SelectSubElmtLoop(it.first));
+    }
+    // one element has at most one sub element for each [elmt] block
+    _MateBatches.resize(dofHandler.GetElmtBlockQpOrderList().size());
+    _IsBatchMate.assign(dofHandler.GetElmtBlockQpOrderList().size(),false);
+    for(auto &it:_MateBatches) it.Resize(_nGPoints,BulkMateSystem::GetBatchMateHistNum(MateType::J2PLASTICITYMATE));
     
     
     _localK.Resize(dofHandler.GetMaxDofsNumPerBulkElmt(),dofHandler.GetMaxDofsNumPerBulkElmt());
@@ -87,6 +116,8 @@ void FESystem::InitBulkFESystem(const Mesh &mesh,
     _localK.setZero();_localR.setZero();
     _subK.setZero();_subR.setZero();
 
+    InitLocalElmtScatter(mesh,dofHandler,solution);
+
     // set the factor to Ax=F system(this factor should be mesh dependent)
     // in order to get the most suitable one, we try to use 10 elements from the bulk
     int e,gpInd;
@@ -123,4 +154,46 @@ void FESystem::InitBulkFESystem(const Mesh &mesh,
         }
     }
     
-}
\ No newline at end of file
+}
+//*******************************************************************
+void FESystem::InitLocalElmtScatter(const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solution){
+    MPI_Comm_rank(PETSC_COMM_WORLD,&_rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&_size);
+
+    // the same contiguous split as FormBulkFE
+    int rankne=mesh.GetBulkMeshBulkElmtsNum()/_size;
+    int eStart=_rank*rankne;
+    int eEnd=(_rank+1)*rankne;
+    if(_rank==_size-1) eEnd=mesh.GetBulkMeshBulkElmtsNum();
+
+    int e,i,nDofs;
+    _LocalElmtDofsOffset.assign(eEnd-eStart+1,0);
+    for(int ee=eStart;ee<eEnd;++ee){
+        e=dofHandler.GetIthBulkElmtIDInLoopOrder(ee+1);
+        _LocalElmtDofsOffset[ee-eStart+1]=_LocalElmtDofsOffset[ee-eStart]+dofHandler.GetBulkMeshIthBulkElmtDofsNum(e);
+    }
+    _LocalElmtDofs.resize(_LocalElmtDofsOffset[eEnd-eStart]);
+    for(int ee=eStart;ee<eEnd;++ee){
+        e=dofHandler.GetIthBulkElmtIDInLoopOrder(ee+1);
+        nDofs=dofHandler.GetBulkMeshIthBulkElmtDofsNum(e);
+        dofHandler.GetBulkMeshIthBulkElmtDofIndex0(e,_elDofs);
+        for(i=0;i<nDofs;i++) _LocalElmtDofs[_LocalElmtDofsOffset[ee-eStart]+i]=_elDofs[i];
+    }
+
+    // each rank only receives the dofs of its own elements(including the ghosted ones), not the whole vectors
+    _LocalDofs=_LocalElmtDofs;
+    sort(_LocalDofs.begin(),_LocalDofs.end());
+    _LocalDofs.erase(unique(_LocalDofs.begin(),_LocalDofs.end()),_LocalDofs.end());
+    for(auto &it:_LocalElmtDofs){
+        it=static_cast<PetscInt>(lower_bound(_LocalDofs.begin(),_LocalDofs.end(),it)-_LocalDofs.begin());
+    }
+
+    IS is;
+    ISCreateGeneral(PETSC_COMM_SELF,static_cast<PetscInt>(_LocalDofs.size()),_LocalDofs.data(),PETSC_COPY_VALUES,&is);
+    VecCreateSeq(PETSC_COMM_SELF,static_cast<PetscInt>(_LocalDofs.size()),&_Useq);
+    VecScatterCreate(solution._U,is,_Useq,NULL,&_scatteru);
+    ISDestroy(&is);
+    VecDuplicate(_Useq,&_Uoldseq);
+    VecDuplicate(_Useq,&_Vseq);
+    VecDuplicate(_Useq,&_Voldseq);
+}
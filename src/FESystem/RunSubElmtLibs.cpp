@@ -0,0 +1,205 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.20
+//+++ Purpose: Run the node loops of one sub element on one gauss
+//+++          point, the node loops are instantiated for each UEL,
+//+++          and the one of each [elmt] block is selected only once
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "FESystem/FESystem.h"
+
+//*****************************************************************
+//*** the node loops of one element type, the qualified call of ComputeAll
+//*** is not a virtual one, so it can be inlined(i.e. with -flto)
+//*****************************************************************
+template<class BulkElmt>
+void FESystem::RunSubElmtLoop(const FECalcType &calctype,const double (&ctan)[3],ElmtSystem &elmtSystem,
+                              const int &nNodes,const int &nDofsPerNode,const int &nDofsPerSubElmt,
+                              const bool &IsLumpedMass,const bool &IsResidualFlux,const ShapeFun &shp,
+                              const Materials &Mate,const Materials &MateOld){
+    BulkElmt &elmt=elmtSystem;
+    int i,j;
+    if(calctype==FECalcType::ComputeResidual&&IsResidualFlux){
+        // the residual is linear in the test function, R_a=N_a*val+grad(N_a).flux, so val and flux are
+        // obtained by 1+nDim calls with the unit test function, instead of one call for each node
+        _elmtshp.test=1.0;_elmtshp.trial=1.0;
+        _elmtshp.grad_test=0.0;_elmtshp.grad_trial=0.0;
+        elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctan,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+        for(j=1;j<=nDofsPerSubElmt;j++){
+            _gpResVal[j]=_subR(j);
+            _gpResFlux[j]=0.0;
+        }
+        _elmtshp.test=0.0;_elmtshp.trial=0.0;
+        for(i=1;i<=_elmtinfo.nDim;i++){
+            _elmtshp.grad_test=0.0;
+            _elmtshp.grad_test(i)=1.0;
+            _elmtshp.grad_trial=_elmtshp.grad_test;
+            elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctan,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+            for(j=1;j<=nDofsPerSubElmt;j++){
+                _gpResFlux[j](i)=_subR(j);
+            }
+        }
+    }
+    else if(calctype==FECalcType::ComputeResidual){
+        for(i=1;i<=nNodes;i++){
+            // for local shape function
+            _elmtshp.test=shp.shape_value(i);
+            _elmtshp.trial=shp.shape_value(i);
+            _elmtshp.grad_test=shp.shape_grad(i);
+            _elmtshp.grad_trial=shp.shape_grad(i);
+            // for the lumped mass, the rate on the gauss point is replaced by the nodal one of the
+            // test function, then sum(N_i*v_i*JxW)=(sum_j M_ij)*v_i, which is the row-sum lumping
+            if(IsLumpedMass){
+                for(j=1;j<=nDofsPerSubElmt;j++){
+                    _gpVLumped[j]=_elV[(i-1)*nDofsPerNode+localDofIndex[j-1]-1];
+                }
+                _elmtsoln.gpV=_gpVLumped;
+            }
+
+            elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctan,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+            AssembleSubResidualToLocalResidual(nDofsPerNode,nDofsPerSubElmt,i,_subR,_localR);
+        }
+        if(IsLumpedMass) _elmtsoln.gpV=_gpV;
+    }
+    else if(calctype==FECalcType::ComputeJacobian){
+        // for the lumped mass, the time derivative(ctan[1]) terms of the jacobian are evaluated separately
+        const double ctanNoMass[3]={ctan[0],0.0,ctan[2]};
+        const double ctanMass[3]={0.0,ctan[1],0.0};
+        for(i=1;i<=nNodes;i++){
+            if(IsLumpedMass){
+                for(j=1;j<=nDofsPerSubElmt;j++){
+                    _gpVLumped[j]=_elV[(i-1)*nDofsPerNode+localDofIndex[j-1]-1];
+                }
+                _elmtsoln.gpV=_gpVLumped;
+            }
+            for(j=1;j<=nNodes;j++){
+                // for local shape function
+                _elmtshp.test=shp.shape_value(i);
+                _elmtshp.trial=shp.shape_value(j);
+                _elmtshp.grad_test=shp.shape_grad(i);
+                _elmtshp.grad_trial=shp.shape_grad(j);
+
+                if(IsLumpedMass){
+                    // the residual only depends on the i-th nodal rate, so the trial function of
+                    // the ctan[1] terms is the kronecker delta, which gives the diagonal mass block
+                    elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctanNoMass,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+                    AssembleSubJacobianToLocalJacobian(nDofsPerNode,i,j,_subK,_localK);
+                    if(i!=j||ctan[1]==0.0) continue;
+                    _elmtshp.trial=1.0;
+                    elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctanMass,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+                    AssembleSubJacobianToLocalJacobian(nDofsPerNode,i,j,_subK,_localK);
+                    continue;
+                }
+
+                elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctan,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+                AssembleSubJacobianToLocalJacobian(nDofsPerNode,i,j,_subK,_localK);
+            }
+        }
+        if(IsLumpedMass) _elmtsoln.gpV=_gpV;
+    }
+    else if(calctype==FECalcType::Projection){
+        for(i=1;i<=nNodes;i++){
+            // for local shape function
+            _elmtshp.test=shp.shape_value(i);
+            _elmtshp.trial=shp.shape_value(i);
+            _elmtshp.grad_test=shp.shape_grad(i);
+            _elmtshp.grad_trial=shp.shape_grad(i);
+
+            elmt.BulkElmt::ComputeAll(calctype,_elmtinfo,ctan,_elmtsoln,_elmtshp,Mate,MateOld,_gpProj,_subK,_subR);
+        }
+        // here we should not assemble the local projection, because the JxW should not be accumulated
+        // inside the element-loop, but the gpProj should be.
+        // therefore, each sub element should use its own place of gpProj, in short, the gpProj is shared
+        // between different elements
+    }
+}
+
+//*****************************************************************
+FESystem::SubElmtLoop FESystem::SelectSubElmtLoop(const ElmtType &elmttype){
+    // the elements without the kernel contribute nothing
+    switch (elmttype){
+        case ElmtType::LAPLACEELMT:
+            return nullptr;
+        case ElmtType::TIMEDERIVELMT:
+            return nullptr;
+        case ElmtType::POISSONELMT:
+            return &FESystem::RunSubElmtLoop<PoissonElmt>;
+        case ElmtType::DIFFUSIONELMT:
+            return &FESystem::RunSubElmtLoop<DiffusionElmt>;
+        case ElmtType::STRESSDIFFUSIONELMT:
+            return &FESystem::RunSubElmtLoop<StressDiffusionElmt>;
+        case ElmtType::CAHNHILLIARDELMT:
+            return &FESystem::RunSubElmtLoop<CahnHilliardElmt>;
+        case ElmtType::MECHANICSELMT:
+            return &FESystem::RunSubElmtLoop<MechanicsElmt>;
+        case ElmtType::MIEHEFRACELMT:
+            return &FESystem::RunSubElmtLoop<MieheFractureElmt>;
+        case ElmtType::ALLENCAHNFRACELMT:
+            return &FESystem::RunSubElmtLoop<AllenCahnFractureElmt>;
+        case ElmtType::KOBAYASHIELMT:
+            return &FESystem::RunSubElmtLoop<KobayashiElmt>;
+        case ElmtType::DIFFUSIONFRACTUREELMT:
+            return &FESystem::RunSubElmtLoop<DiffusionFractureElmt>;
+        case ElmtType::MECHCAHNHILLIARDELMT:
+            return &FESystem::RunSubElmtLoop<MechanicsCahnHilliardElmt>;
+        case ElmtType::WAVEELMT:
+            return &FESystem::RunSubElmtLoop<WaveElmt>;
+        case ElmtType::THERMALCONDUCTELMT:
+            return &FESystem::RunSubElmtLoop<ThermalElmt>;
+        //********************************************************
+        //*** for user-defined-element(UEL)
+        //********************************************************
+        case ElmtType::USER1ELMT:
+            return &FESystem::RunSubElmtLoop<User1Elmt>;
+        case ElmtType::USER2ELMT:
+            return &FESystem::RunSubElmtLoop<User2Elmt>;
+        case ElmtType::USER3ELMT:
+            return &FESystem::RunSubElmtLoop<User3Elmt>;
+        case ElmtType::USER4ELMT:
+            return &FESystem::RunSubElmtLoop<User4Elmt>;
+        case ElmtType::USER5ELMT:
+            return &FESystem::RunSubElmtLoop<User5Elmt>;
+        case ElmtType::USER6ELMT:
+            return &FESystem::RunSubElmtLoop<User6Elmt>;
+        case ElmtType::USER7ELMT:
+            return &FESystem::RunSubElmtLoop<User7Elmt>;
+        case ElmtType::USER8ELMT:
+            return &FESystem::RunSubElmtLoop<User8Elmt>;
+        case ElmtType::USER9ELMT:
+            return &FESystem::RunSubElmtLoop<User9Elmt>;
+        case ElmtType::USER10ELMT:
+            return &FESystem::RunSubElmtLoop<User10Elmt>;
+        case ElmtType::USER11ELMT:
+            return &FESystem::RunSubElmtLoop<User11Elmt>;
+        case ElmtType::USER12ELMT:
+            return &FESystem::RunSubElmtLoop<User12Elmt>;
+        case ElmtType::USER13ELMT:
+            return &FESystem::RunSubElmtLoop<User13Elmt>;
+        case ElmtType::USER14ELMT:
+            return &FESystem::RunSubElmtLoop<User14Elmt>;
+        case ElmtType::USER15ELMT:
+            return &FESystem::RunSubElmtLoop<User15Elmt>;
+        case ElmtType::USER16ELMT:
+            return &FESystem::RunSubElmtLoop<User16Elmt>;
+        case ElmtType::USER17ELMT:
+            return &FESystem::RunSubElmtLoop<User17Elmt>;
+        case ElmtType::USER18ELMT:
+            return &FESystem::RunSubElmtLoop<User18Elmt>;
+        case ElmtType::USER19ELMT:
+            return &FESystem::RunSubElmtLoop<User19Elmt>;
+        case ElmtType::USER20ELMT:
+            return &FESystem::RunSubElmtLoop<User20Elmt>;
+        default:
+            MessagePrinter::PrintErrorTxt("unsupported element type in FESystem, please check your code or your input file");
+            MessagePrinter::AsFem_Exit();
+            return nullptr;
+    }
+}
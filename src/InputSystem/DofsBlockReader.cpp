@@ -19,8 +19,10 @@ void DofsBlockReader::PrintHelper(){
     MessagePrinter::PrintNormalTxt("The complete information for [dofs] block:",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("[dofs]",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("name=dof1_name dof2_name ...",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("renumber=none[default],rcm,sfc",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("[end]",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("each name should be separated by a space",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("renumber is used to reduce the bandwidth of the system matrix",MessageColor::BLUE);
     MessagePrinter::PrintStars(MessageColor::BLUE);
 }
 
@@ -50,6 +52,24 @@ bool DofsBlockReader::ReadDofsBlock(ifstream &in, string str, int &linenum, DofH
             PrintHelper();
             return false;
         }
+        else if(str.find("renumber=")!=string::npos){
+            string substr=str.substr(str.find_first_of('=')+1);
+            if(substr=="none"){
+                dofHandler.SetDofRenumberType(DofRenumberType::NONE);
+            }
+            else if(substr=="rcm"){
+                dofHandler.SetDofRenumberType(DofRenumberType::RCM);
+            }
+            else if(substr=="sfc"){
+                dofHandler.SetDofRenumberType(DofRenumberType::SFC);
+            }
+            else{
+                snprintf(buff,55,"line-%d has some errors",linenum);
+                MessagePrinter::PrintErrorTxt(string(buff));
+                MessagePrinter::PrintErrorTxt(" unsupported renumber method in the [dofs] block, renumber=none,rcm,sfc is expected");
+                MessagePrinter::AsFem_Exit();
+            }
+        }
         else if(str.find("name=")!=string::npos){
             int i=str0.find_first_of('=');
             if(str.size()<=5){
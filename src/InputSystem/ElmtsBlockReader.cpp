@@ -30,6 +30,20 @@ void ElmtsBlockReader::PrintHelper(){
     MessagePrinter::PrintNormalTxt("    dofs=dof1 dof2",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("    mate=material-block-name",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("    domain=domain-name-2",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    qporder=2 [optional, the gauss point order of this block]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  [end]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  [elmt-3]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    type=mechanics",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    dofs=ux uy uz",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    mate=material-block-name",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    integration=reduced [optional, one point integration, quad4/hex8 only]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    hourglass=1.0e2 [optional, the hourglass stabilization modulus for the displacement dofs]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  [end]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  [elmt-4]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    type=cahnhilliard",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    dofs=c mu",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    mate=material-block-name",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("    mass=lumped [optional, consistent(default) or lumped time derivative terms]",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("  [end]",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("[end]",MessageColor::BLUE);
     MessagePrinter::PrintStars(MessageColor::BLUE);
@@ -321,6 +335,64 @@ bool ElmtsBlockReader::ReadElmtsBlock(ifstream &in, string str, const int &laste
                         HasBlock=true;
                     }
                 }
+                else if(str.find("qporder=")!=string::npos){
+                    number=StringUtils::SplitStrNum(str);
+                    if(number.size()!=1||int(number[0])<1){
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::PrintErrorInLineNumber(linenum);
+                        MessagePrinter::PrintErrorTxt("invalid qpoint order in [elmts] sub block, 'qporder=integer(>0)' is expected",false);
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::AsFem_Exit();
+                        return false;
+                    }
+                    elmtBlock._QpOrder=int(number[0]);
+                }
+                else if(str.find("integration=")!=string::npos){
+                    substr=str.substr(str.find_first_of('=')+1);
+                    if(substr=="reduced"){
+                        elmtBlock._IsReducedIntegration=true;
+                    }
+                    else if(substr=="full"){
+                        elmtBlock._IsReducedIntegration=false;
+                    }
+                    else{
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::PrintErrorInLineNumber(linenum);
+                        MessagePrinter::PrintErrorTxt("unsupported integration option in [elmts] sub block, 'integration=full' or 'integration=reduced' is expected",false);
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::AsFem_Exit();
+                        return false;
+                    }
+                }
+                else if(str.find("hourglass=")!=string::npos){
+                    number=StringUtils::SplitStrNum(str);
+                    if(number.size()!=1||number[0]<0.0){
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::PrintErrorInLineNumber(linenum);
+                        MessagePrinter::PrintErrorTxt("invalid hourglass stiffness in [elmts] sub block, 'hourglass=real(>=0)' is expected",false);
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::AsFem_Exit();
+                        return false;
+                    }
+                    elmtBlock._HourglassStiffness=number[0];
+                }
+                else if(str.find("mass=")!=string::npos){
+                    substr=str.substr(str.find_first_of('=')+1);
+                    if(substr=="lumped"){
+                        elmtBlock._IsLumpedMass=true;
+                    }
+                    else if(substr=="consistent"){
+                        elmtBlock._IsLumpedMass=false;
+                    }
+                    else{
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::PrintErrorInLineNumber(linenum);
+                        MessagePrinter::PrintErrorTxt("unsupported mass option in [elmts] sub block, 'mass=consistent' or 'mass=lumped' is expected",false);
+                        MessagePrinter::PrintStars();
+                        MessagePrinter::AsFem_Exit();
+                        return false;
+                    }
+                }
                 else if(str.find("[end]")!=string::npos){
                     break;
                 }
@@ -338,6 +410,18 @@ bool ElmtsBlockReader::ReadElmtsBlock(ifstream &in, string str, const int &laste
                     elmtBlock._MateBlockName="";
                 }
                 if(!HasBlock) elmtBlock._DomainName="alldomain";
+                if(elmtBlock._IsReducedIntegration&&elmtBlock._QpOrder>0){
+                    msg="both 'qporder=' and 'integration=reduced' are given in ["+elmtBlock._ElmtBlockName+"] sub block, only one of them is allowed";
+                    MessagePrinter::PrintErrorTxt(msg);
+                    MessagePrinter::AsFem_Exit();
+                    return false;
+                }
+                if(!elmtBlock._IsReducedIntegration&&elmtBlock._HourglassStiffness>0.0){
+                    msg="'hourglass=' is only used with 'integration=reduced', please check your ["+elmtBlock._ElmtBlockName+"] sub block";
+                    MessagePrinter::PrintErrorTxt(msg);
+                    MessagePrinter::AsFem_Exit();
+                    return false;
+                }
                 elmtSystem.AddBulkElmtBlock2List(elmtBlock);
                 elmtBlock.Init();// re-init the elmt block for next reading
             }
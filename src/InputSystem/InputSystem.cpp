@@ -17,123 +17,69 @@
 #include "InputSystem/InputSystem.h"
 
 InputSystem::InputSystem(){
-    _InputFileName.clear();
-    _MeshFileName.clear();
-    _HasInputFileName=false;
-    _IsBuiltInMesh=true;
-    _IsReadOnly=false;
+    SetDefaultOptions();
 }
 //**********************************
 InputSystem::InputSystem(int args,char *argv[]){
+    InitInputSystem(args,argv);
+}
+//***************************************************
+void InputSystem::SetDefaultOptions(){
     _InputFileName.clear();
     _MeshFileName.clear();
     _HasInputFileName=false;
     _IsBuiltInMesh=true;
     _IsReadOnly=false;
-
-    if(args==1){
-        // ./asfem
-        _InputFileName.clear();
-        _MeshFileName.clear();
-        _HasInputFileName=false;
-        _IsBuiltInMesh=true;
-        _IsReadOnly=false;
-    }
-    else if(args==3){
-        // ./asfem -i inputfilename.i
-        if(string("-i").find(argv[1])!=string::npos){
-            _InputFileName=argv[2];
-            _HasInputFileName=true;
-            if(_InputFileName.compare(_InputFileName.size()-2,2,".i")!=0){
-                MessagePrinter::PrintErrorTxt("Invalid input file name! The input file should have the extension .i");
-                MessagePrinter::AsFem_Exit();
-            }
-        }
-        else{
-            _HasInputFileName=false;
-            MessagePrinter::PrintErrorTxt("Invalid input args. The second args should be '-i', after it should be the input file name");
-            MessagePrinter::AsFem_Exit();
-        }
-    }
-    else{
-        _HasInputFileName=false;
-        if(string("-i").find(argv[1])!=string::npos){
-            _InputFileName=argv[2];
-            _HasInputFileName=true;
-            if(_InputFileName.compare(_InputFileName.size()-2,2,".i")!=0){
-                MessagePrinter::PrintErrorTxt("Invalid input file name! The input file should have the extension .i");
-                MessagePrinter::AsFem_Exit();
-            }
-        }
-        else{
-            _HasInputFileName=false;
-            MessagePrinter::PrintErrorTxt("Invalid input args. The second args should be '-i', after it should be the input file name");
-            MessagePrinter::AsFem_Exit();
-        }
-
-        for(int i=4-1;i<args;i++){
-            cout<<"argv["<<i<<"]="<<argv[i]<<endl;
-            if(string("--read-only").find(argv[i])!=string::npos){
-                _IsReadOnly=true;
-            }
-        }
-    }
+    _IsRestart=false;
+    _RestartFileName.clear();
+    _IsProfile=false;
+    _IsDryRun=false;
 }
 //***************************************************
 void InputSystem::InitInputSystem(int args,char *argv[]){
-    if(args==1){
-        // ./asfem
-        _InputFileName.clear();
-        _MeshFileName.clear();
-        _HasInputFileName=false;
-        _IsBuiltInMesh=true;
-        _IsReadOnly=false;
-    }
-    else if(args==3){
-        _InputFileName.clear();
-        _MeshFileName.clear();
-        _HasInputFileName=false;
-        _IsBuiltInMesh=true;
-        _IsReadOnly=false;
-        // ./asfem -i inputfilename.i
-        if(string("-i").find(argv[1])!=string::npos){
-            _InputFileName=argv[2];
+    SetDefaultOptions();
+    // ./asfem, the input file name will be asked later
+    if(args==1) return;
+
+    // ./asfem -i inputfilename.i [--read-only] [--restart file] [--profile] [--dry-run]
+    // the options can be given in any order, the other ones(i.e. -snes_monitor) are left to PETSc
+    string str;
+    for(int i=1;i<args;i++){
+        str=argv[i];
+        if(str=="-i"){
+            if(i+1>=args){
+                MessagePrinter::PrintErrorTxt("no input file name is given after '-i'");
+                MessagePrinter::AsFem_Exit();
+            }
+            _InputFileName=argv[i+1];
             _HasInputFileName=true;
-            if(_InputFileName.compare(_InputFileName.size()-2,2,".i")!=0){
+            if(_InputFileName.size()<2||_InputFileName.compare(_InputFileName.size()-2,2,".i")!=0){
                 MessagePrinter::PrintErrorTxt("Invalid input file name! The input file should have the extension .i");
                 MessagePrinter::AsFem_Exit();
             }
+            i+=1;
         }
-        else{
-            _HasInputFileName=false;
-            MessagePrinter::PrintErrorTxt("Invalid input args. The second args should be '-i', after it should be the input file name");
-            MessagePrinter::AsFem_Exit();
+        else if(str=="--read-only"){
+            _IsReadOnly=true;
         }
-    }
-    else{
-        _InputFileName.clear();
-        _MeshFileName.clear();
-        _HasInputFileName=false;
-        _IsBuiltInMesh=true;
-        _IsReadOnly=false;
-        _HasInputFileName=false;
-        if(string("-i").find(argv[1])!=string::npos){
-            _InputFileName=argv[2];
-            _HasInputFileName=true;
-            if(_InputFileName.compare(_InputFileName.size()-2,2,".i")!=0){
-                MessagePrinter::PrintErrorTxt("Invalid input file name! The input file should have the extension .i");
+        else if(str=="--restart"){
+            if(i+1>=args){
+                MessagePrinter::PrintErrorTxt("no checkpoint file name is given after '--restart'");
                 MessagePrinter::AsFem_Exit();
             }
+            _RestartFileName=argv[i+1];
+            _IsRestart=true;
+            i+=1;
         }
-        else{
-            _HasInputFileName=false;
-            MessagePrinter::PrintErrorTxt("Invalid input args. The second args should be '-i', after it should be the input file name");
-            MessagePrinter::AsFem_Exit();
+        else if(str=="--profile"){
+            _IsProfile=true;
         }
-        for(int i=4-1;i<args;i++){
-            if(string("--read-only").find(argv[i])!=string::npos){
-                _IsReadOnly=true;
-            }
+        else if(str=="--dry-run"){
+            _IsDryRun=true;
         }
     }
-}
\ No newline at end of file
+    if(!_HasInputFileName){
+        MessagePrinter::PrintErrorTxt("Invalid input args. The input file name should be given after '-i'");
+        MessagePrinter::AsFem_Exit();
+    }
+}
@@ -34,6 +34,7 @@
  *   type=gmsh <br>
  *   file=mymesh.msh <br>
  *   savemesh=true <br>
+ *   cache=true <br>
  * [end] <br>
  */
 void MeshBlockReader::PrintHelper(){
@@ -52,9 +53,28 @@ void MeshBlockReader::PrintHelper(){
     MessagePrinter::PrintNormalTxt("meshtype=edge2,edge3,quad4,quad8,quad9,hex8,hex20,hex27",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("savemesh=true,false",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("file=meshfile.msh,meshfile.inp",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("cache=true,false (only for the imported mesh file)",MessageColor::BLUE);
 
 }
 //*****************************************************************
+bool MeshBlockReader::ReadCacheOption(const string &str,const int &linenum){
+    char buff[55];
+    int i=str.find_first_of('=');
+    string substr=str.substr(i+1,str.length());
+    substr=StringUtils::RemoveStrSpace(substr);
+    if(substr.find("true")!=string::npos){
+        return true;
+    }
+    else if(substr.find("false")!=string::npos){
+        return false;
+    }
+    snprintf(buff,55,"line-%d has some errors",linenum);
+    MessagePrinter::PrintErrorTxt(string(buff));
+    MessagePrinter::PrintErrorTxt("unsupported option in cache= in the [mesh] block, cache=true[false] is expected");
+    MessagePrinter::AsFem_Exit();
+    return false;
+}
+//*****************************************************************
 
 /**
  * The the mesh block information as well as the mesh file
@@ -83,6 +103,7 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
     string meshtype;    
     MeshIO meshio; /**< we use the meshio class to read the mesh file and mesh information for our mesh class*/
     bool IsSaveMesh=false;
+    bool IsUseCache=false;/**< if true, the imported mesh will be cached in a binary file for the next run */
     // now the str already contains '[mesh]'
     getline(in,str);linenum+=1;
     str=StringUtils::RemoveStrSpace(str);
@@ -585,10 +606,7 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
                         string filename=str0.substr(5,string::npos);
                         meshio.SetMeshFileName(filename);
                         HasFileName=true;
-                        MessagePrinter::PrintNormalTxt("Start to import mesh from gmsh ...");
-                        IsSuccess=meshio.ReadMeshFromFile(mesh);
-                        MessagePrinter::PrintNormalTxt("Import mesh finished !");
-                        // mesh.SetMeshMode(false);
+                        // the mesh is imported after the whole block is read, since it depends on 'cache='
                     }
                     else{
                         snprintf(buff,55,"line-%d has some errors",linenum);
@@ -617,6 +635,9 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
                         MessagePrinter::AsFem_Exit();
                     }
                 }
+                else if(str.find("cache=")!=string::npos){
+                    IsUseCache=ReadCacheOption(str,linenum);
+                }
                 else if(str.find("savemesh=")!=string::npos){
                     int i=str.find_first_of('=');
                     string substr=str.substr(i+1,str.length());
@@ -660,6 +681,14 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
                 MessagePrinter::PrintErrorTxt("file=correct file name should be given in the [mesh] block");
                 MessagePrinter::AsFem_Exit();
             } 
+            MessagePrinter::PrintNormalTxt("Start to import mesh from gmsh ...");
+            if(IsUseCache){
+                IsSuccess=meshio.ReadMeshFromFileWithCache(mesh);
+            }
+            else{
+                IsSuccess=meshio.ReadMeshFromFile(mesh);
+            }
+            MessagePrinter::PrintNormalTxt("Import mesh finished !");
             break;
         }
         else if(str.find("type=abaqus")!=string::npos){
@@ -680,9 +709,6 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
                     if(str.compare(str.length()-4,4,".inp")==0){
                         string filename=str0.substr(5,string::npos);
                         meshio.SetMeshFileName(filename);
-                        MessagePrinter::PrintNormalTxt("Start to import mesh from abaqus ...");
-                        IsSuccess=meshio.ReadMeshFromFile(mesh);
-                        MessagePrinter::PrintNormalTxt("Import mesh finished !");
                         HasFileName=true;
                     }
                     else{
@@ -692,6 +718,9 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
                         MessagePrinter::AsFem_Exit();
                     }
                 }
+                else if(str.find("cache=")!=string::npos){
+                    IsUseCache=ReadCacheOption(str,linenum);
+                }
                 else if(str.find("savemesh=")!=string::npos){
                     int i=str.find_first_of('=');
                     string substr=str.substr(i+1,str.length());
@@ -751,6 +780,14 @@ bool MeshBlockReader::ReadMeshBlock(ifstream &in, string str, int &linenum, Mesh
                 MessagePrinter::PrintErrorTxt("file=correct file name should be given in the [mesh] block");
                 MessagePrinter::AsFem_Exit();
             }
+            MessagePrinter::PrintNormalTxt("Start to import mesh from abaqus ...");
+            if(IsUseCache){
+                IsSuccess=meshio.ReadMeshFromFileWithCache(mesh);
+            }
+            else{
+                IsSuccess=meshio.ReadMeshFromFile(mesh);
+            }
+            MessagePrinter::PrintNormalTxt("Import mesh finished !");
             break;
         }
         else if(str.find("[end]")!=string::npos){
@@ -19,6 +19,7 @@ void ProjectionBlockReader::PrintHelper(){
     MessagePrinter::PrintStars(MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("The complete information for [projection] block:",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("[projection]",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  type=lumped [consistent]",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("  name=projection-property-name",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("  scalarmate=scalar-material-name",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("  vectormate=vector-material-name",MessageColor::BLUE);
@@ -50,10 +51,25 @@ bool ProjectionBlockReader::ReadProjectionBlock(ifstream &in, string str, int &l
             continue;
         }
         
-        if(str.find("type=helper")!=string::npos){
+        if(str=="type=helper"){
             PrintHelper();
             return false;
         }
+        else if(str.compare(0,5,"type=")==0){
+            // the whole value is compared, i.e. 'type=notlumped' is not a valid lumped type
+            string substr=str.substr(5);
+            if(substr=="lumped"){
+                solutionSystem.SetProjectionType(ProjectionType::LUMPED);
+            }
+            else if(substr=="consistent"){
+                solutionSystem.SetProjectionType(ProjectionType::CONSISTENT);
+            }
+            else{
+                MessagePrinter::PrintErrorInLineNumber(linenum);
+                MessagePrinter::PrintErrorTxt("unsupported projection type in the [projection] block, 'type=lumped' or 'type=consistent' should be given");
+                MessagePrinter::AsFem_Exit();
+            }
+        }
         else if(str.compare(0,5,"name=")==0){
             int i=str0.find_first_of('=');
             string substr=str0.substr(i+1,str0.length());
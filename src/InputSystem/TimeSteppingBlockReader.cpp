@@ -27,6 +27,8 @@ void TimeSteppingBlockReader::PrintHelper(){
     MessagePrinter::PrintNormalTxt("  dtmax=1.0e-2",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("  growthfactor=1.1",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("  cutfactor=0.85",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  checkpointinterval=100",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("  checkpointkeep=2",MessageColor::BLUE);
     MessagePrinter::PrintNormalTxt("[end]",MessageColor::BLUE);
     MessagePrinter::PrintStars(MessageColor::BLUE);
 }
@@ -107,6 +109,54 @@ bool TimeSteppingBlockReader::ReadTimeSteppingBlock(ifstream &in, string str, in
                 timesteppingBlock._OptIters=int(numbers[0]);
             }
         }
+        else if(str.find("checkpointinterval=")!=string::npos||
+                str.find("CheckPointInterval=")!=string::npos||
+                str.find("CHECKPOINTINTERVAL=")!=string::npos){
+            if(!HasType){
+                MessagePrinter::PrintErrorTxt("no 'type=' found in the [timestepping] block, checkpointinterval= should be given after 'type='");
+                MessagePrinter::AsFem_Exit();
+            }
+            int i=str.find_first_of('=');
+            string substr=str.substr(i+1,str.length());
+            numbers=StringUtils::SplitStrNum(substr);
+            if(numbers.size()<1){
+                MessagePrinter::PrintErrorInLineNumber(linenum);
+                MessagePrinter::PrintErrorTxt("no checkpointinterval found in the [timestepping] block, checkpointinterval=integer should be given");
+                MessagePrinter::AsFem_Exit();
+            }
+            else{
+                if(int(numbers[0])<0){
+                    MessagePrinter::PrintErrorInLineNumber(linenum);
+                    MessagePrinter::PrintErrorTxt("invalid checkpointinterval found in [timestepping] block, checkpointinterval=integer(>=0) should be given");
+                    MessagePrinter::AsFem_Exit();
+                }
+                timesteppingBlock._CheckPointInterval=int(numbers[0]);
+            }
+        }
+        else if(str.find("checkpointkeep=")!=string::npos||
+                str.find("CheckPointKeep=")!=string::npos||
+                str.find("CHECKPOINTKEEP=")!=string::npos){
+            if(!HasType){
+                MessagePrinter::PrintErrorTxt("no 'type=' found in the [timestepping] block, checkpointkeep= should be given after 'type='");
+                MessagePrinter::AsFem_Exit();
+            }
+            int i=str.find_first_of('=');
+            string substr=str.substr(i+1,str.length());
+            numbers=StringUtils::SplitStrNum(substr);
+            if(numbers.size()<1){
+                MessagePrinter::PrintErrorInLineNumber(linenum);
+                MessagePrinter::PrintErrorTxt("no checkpointkeep found in the [timestepping] block, checkpointkeep=integer should be given");
+                MessagePrinter::AsFem_Exit();
+            }
+            else{
+                if(int(numbers[0])<1){
+                    MessagePrinter::PrintErrorInLineNumber(linenum);
+                    MessagePrinter::PrintErrorTxt("invalid checkpointkeep found in [timestepping] block, checkpointkeep=integer(>=1) should be given");
+                    MessagePrinter::AsFem_Exit();
+                }
+                timesteppingBlock._CheckPointKeep=int(numbers[0]);
+            }
+        }
         else if(str.find("dt=")!=string::npos||
                  str.find("Dt=")!=string::npos||
                  str.find("DT=")!=string::npos){
@@ -22,6 +22,7 @@ BulkMateSystem::BulkMateSystem(){
     
     _Materials.Clean();
     _MaterialsOld.Clean();
+    RenewMaterialsGeneration();
 
 }
 
@@ -30,6 +31,8 @@ BulkMateSystem::BulkMateSystem(const BulkMateSystem &newbulkmatesystem){
     _BulkMateBlockList=newbulkmatesystem._BulkMateBlockList;
     _Materials=newbulkmatesystem._Materials;
     _MaterialsOld=newbulkmatesystem._MaterialsOld;
+    _BatchMateSlots=BatchMateSlots();
+    RenewMaterialsGeneration();
 }
 
 //***************************************************
@@ -64,6 +67,16 @@ void BulkMateSystem::AddBulkMateBlock2List(MateBlock &mateblock){
 void BulkMateSystem::InitBulkMateSystem(){
     _Materials.Clean();
     _MaterialsOld.Clean();
+    _BatchMateSlots=BatchMateSlots();
+    RenewMaterialsGeneration();
+}
+//*********************************************************
+void BulkMateSystem::RenewMaterialsGeneration(){
+    // the counter is shared by all the material systems, so a new system at the address of
+    // a released one never has the same generation
+    static size_t GenerationCounter=0;
+    GenerationCounter+=1;
+    _MaterialsGeneration=GenerationCounter;
 }
 //***********************************************************
 void BulkMateSystem::PrintBulkMateSystemInfo()const{
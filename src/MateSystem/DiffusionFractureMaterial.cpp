@@ -62,7 +62,7 @@ void DiffusionFractureMaterial::ComputeConstitutiveLaws(const vector<double> &In
 
     _I.SetToIdentity();
     // for our total small strain
-    Strain=(F+F.Transpose())*0.5;// F is set as GradU in 'ComputeDeformationGradientTensor'
+    Strain.SetFromSymmetricPart(F);// F is set as GradU in 'ComputeDeformationGradientTensor'
     
     // for the diffusion induced eigen strain
     _EigenStrain=_I*Omega*C/3.0;
@@ -33,7 +33,7 @@ void IncrementSmallStrainMaterial::ComputeStrain(const LocalElmtInfo &elmtinfo,
     else if(elmtinfo.nDim==3){
         _GradU.SetFromGradU(elmtsoln.gpGradU[1],elmtsoln.gpGradU[2],elmtsoln.gpGradU[3]);
     }
-    Strain=(_GradU+_GradU.Transpose())*0.5;
+    Strain.SetFromSymmetricPart(_GradU);
 }
 //***********************************************************************************
 void IncrementSmallStrainMaterial::ComputeStressAndJacobian(const vector<double> &InputParams,
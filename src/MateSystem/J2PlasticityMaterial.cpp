@@ -36,7 +36,7 @@ void J2PlasticityMaterial::ComputeStrain(const LocalElmtInfo &elmtinfo, const Lo
     else if(elmtinfo.nDim==3){
         _GradU.SetFromGradU(elmtsoln.gpGradU[1],elmtsoln.gpGradU[2],elmtsoln.gpGradU[3]);
     }
-    Strain=(_GradU+_GradU.Transpose())*0.5;
+    Strain.SetFromSymmetricPart(_GradU);
 }
 //************************************************************
 double J2PlasticityMaterial::ComputeYieldFunction(const vector<double> &InputParams, const double &trial_strss,
@@ -66,10 +66,10 @@ void J2PlasticityMaterial::ComputeAdmissibleStressState(const vector<double> &In
     _Effect_Plastic_Strain_Old=MateOld.ScalarMaterials("effective_plastic_strain");
 
     _I.SetToIdentity();
-    _I4Sym.SetToIdentitySymmetric4();
+    UpdateElasticTangent(_E,_nu);
 
-    _devStrain=_Strain-_I*(Strain.Trace()/3.0);
-    _STrial=(_devStrain-_plastic_strain_old)*2.0*_Mu;
+    _devStrain.SetFromAxpby(1.0,_Strain,-Strain.Trace()/3.0,_I);
+    _STrial.SetFromAxpby(2.0*_Mu,_devStrain,-2.0*_Mu,_plastic_strain_old);
 
     _F= ComputeYieldFunction(InputParams,_STrial.Norm(),_Effect_Plastic_Strain_Old);
 
@@ -77,26 +77,43 @@ void J2PlasticityMaterial::ComputeAdmissibleStressState(const vector<double> &In
         // for elastic case
         _N.SetToZeros();
         _DeltaGamma=0.0;
-        _Jac.SetFromEandNu(_E,_nu);
+        Jac=_ElasticJac;
     }
     else{
         // for plastic case
         _DeltaGamma=_F/(2*_Mu+2*_hardening_modulus/3.0);
-        _N=_STrial/_STrial.Norm();
+        _N=_STrial;
+        _N*=1.0/_STrial.Norm();
         _theta=1.0-2.0*_Mu*_DeltaGamma/_STrial.Norm();
         _thetabar=1.0/(1.0+_hardening_modulus/(3*_Mu))-(1-_theta);
-        Jac=_I.OTimes(_I)*_Lambda
-            +(_I4Sym-_I.OTimes(_I)*(1.0/3.0))*2*_Mu*_theta
-            -_N.OTimes(_N)*2*_Mu*_thetabar;
+        _NxN.SetFromOTimes(_N,_N);
+        // Jac=IxI*Lambda+(I4Sym-IxI/3)*2*Mu*theta-NxN*2*Mu*thetabar
+        _SymJac.SetFromAxpby(_Lambda-2.0*_Mu*_theta/3.0,_IxI,2.0*_Mu*_theta,_I4Sym);
+        _SymJac.Axpy(-2.0*_Mu*_thetabar,_NxN);
+        // the elements only read the full-index tangent, so the one of the plastic point is converted once
+        Jac=_SymJac.ToRankFourTensor();
 
     }
     // update all the variables
     Mate.ScalarMaterials("effective_plastic_strain")=_Effect_Plastic_Strain_Old+sqrt(2.0/3.0)*_DeltaGamma;
-    Mate.Rank2Materials("plastic_strain")=_plastic_strain_old+_N*_DeltaGamma;
-    Stress=_I*_Lambda*_Strain.Trace()+_STrial-_N*2*_Mu*_DeltaGamma;
+    Mate.Rank2Materials("plastic_strain").SetFromAxpby(1.0,_plastic_strain_old,_DeltaGamma,_N);
+    Stress.SetFromAxpby(1.0,_STrial,-2.0*_Mu*_DeltaGamma,_N);
+    Stress.Axpy(_Lambda*_Strain.Trace(),_I);
 
 }
 
+//****************************************************************
+void J2PlasticityMaterial::UpdateElasticTangent(const double &E,const double &nu){
+    if(_IsTangentReady&&E==_TangentE&&nu==_TangentNu) return;
+    // the identities are constant, the elastic tangent is only built again once E or nu is changed
+    _I4Sym.SetToIdentitySymmetric4();
+    _IxI.SetFromOTimes(_I,_I);
+    _SymJac.SetFromEandNu(E,nu);
+    _ElasticJac=_SymJac.ToRankFourTensor();
+    _TangentE=E;_TangentNu=nu;
+    _IsTangentReady=true;
+}
+//****************************************************************
 void J2PlasticityMaterial::ComputeMaterialProperties(const vector<double> &InputParams,const LocalElmtInfo &elmtinfo,const LocalElmtSolution &elmtsoln,const Materials &MateOld,Materials &Mate) {
 
     //*********************************************************
@@ -113,13 +130,97 @@ void J2PlasticityMaterial::ComputeMaterialProperties(const vector<double> &Input
 
     ComputeStrain(elmtinfo,elmtsoln,_Strain);
 
-    ComputeAdmissibleStressState(InputParams,elmtinfo,elmtsoln,_Strain,MateOld,Mate,_Stress,_Jac);
+    // the tangent is written into the material map directly
+    ComputeAdmissibleStressState(InputParams,elmtinfo,elmtsoln,_Strain,MateOld,Mate,_Stress,Mate.Rank4Materials("jacobian"));
 
     Mate.Rank2Materials("stress")=_Stress;
     Mate.Rank2Materials("strain")=_Strain;
-    Mate.Rank4Materials("jacobian")=_Jac;
 
-    _devStress=_Stress-_I*(_Stress.Trace()/3.0);
+    _devStress.SetFromAxpby(1.0,_Stress,-_Stress.Trace()/3.0,_I);
     Mate.ScalarMaterials("vonMises")=sqrt(1.5*_devStress.DoubleDot(_devStress));
 
 }
+//***************************************************************
+void J2PlasticityMaterial::ComputeBatchMaterialProperties(const vector<double> &InputParams,MateBatch &batch){
+    if(InputParams.size()<4){
+        MessagePrinter::PrintErrorTxt("for J2-Plasticity material, four parameters are required, you need to give: E, nu, yield stress, and hardening modulus");
+        MessagePrinter::AsFem_Exit();
+    }
+    const double E=InputParams[1-1];
+    const double nu=InputParams[2-1];
+    const double YieldStress=InputParams[3-1];
+    const double Hardening=InputParams[4-1];
+    const double K=E/(3*(1-2*nu)); // bulk modulus
+    const double Mu=E/(2*(1+nu));  // shear modulus
+
+    const int n=batch.nPoints;
+    const double *gradu=batch.GradU.data(),*histold=batch.HistOld.data();
+    double *strain=batch.Strain.data(),*stress=batch.Stress.data(),*vm=batch.VonMises.data();
+    double *hist=batch.Hist.data(),*jac;
+    // the scratch: the coefficients of IxI, I4Sym and NxN in the jacobian, then the 9 components of N
+    double *ca=batch.Work.data(),*cb=ca+n,*cc=cb+n,*normal=cc+n;
+    int i,j,k,l,q;
+
+    for(i=0;i<3;i++){
+        for(j=0;j<3;j++){
+            #pragma omp simd
+            for(q=0;q<n;q++) strain[(i*3+j)*n+q]=0.5*(gradu[(i*3+j)*n+q]+gradu[(j*3+i)*n+q]);
+        }
+    }
+    // the same radial return as ComputeAdmissibleStressState, the elastic and plastic cases are merged by
+    // the selection of DeltaGamma, theta and thetabar, so the loop has no branch
+    #pragma omp simd
+    for(q=0;q<n;q++){
+        const double tr=strain[q]+strain[4*n+q]+strain[8*n+q];
+        double snorm=0.0,s;
+        for(int c=0;c<9;c++){
+            const double delta=(c%4==0)?1.0:0.0;
+            s=2.0*Mu*(strain[c*n+q]-tr*delta/3.0-histold[c*n+q]);
+            normal[c*n+q]=s;
+            snorm+=s*s;
+        }
+        snorm=sqrt(snorm);
+        const double epold=histold[9*n+q];
+        const double f=snorm-sqrt(2.0/3.0)*(YieldStress+epold*Hardening);
+        const bool plastic=(f>0.0);
+        const double dgamma=plastic?f/(2*Mu+2*Hardening/3.0):0.0;
+        const double invnorm=plastic?1.0/snorm:0.0;
+        const double theta=plastic?1.0-2.0*Mu*dgamma/snorm:1.0;
+        const double thetabar=plastic?1.0/(1.0+Hardening/(3*Mu))-(1-theta):0.0;
+        double trs=0.0;
+        for(int c=0;c<9;c++){
+            const double delta=(c%4==0)?1.0:0.0;
+            s=normal[c*n+q];
+            normal[c*n+q]=s*invnorm;
+            hist[c*n+q]=histold[c*n+q]+normal[c*n+q]*dgamma;
+            stress[c*n+q]=K*tr*delta+s-2*Mu*dgamma*normal[c*n+q];
+            trs+=stress[c*n+q]*delta;
+        }
+        hist[9*n+q]=epold+sqrt(2.0/3.0)*dgamma;
+        vm[q]=0.0;
+        for(int c=0;c<9;c++){
+            const double delta=(c%4==0)?1.0:0.0;
+            s=stress[c*n+q]-trs*delta/3.0;
+            vm[q]+=s*s;
+        }
+        vm[q]=sqrt(1.5*vm[q]);
+        // Jac=IxI*K+(I4Sym-IxI/3)*2*Mu*theta-NxN*2*Mu*thetabar
+        ca[q]=K-2.0*Mu*theta/3.0;
+        cb[q]=2.0*Mu*theta;
+        cc[q]=2.0*Mu*thetabar;
+    }
+    for(i=0;i<3;i++){
+        for(j=0;j<3;j++){
+            for(k=0;k<3;k++){
+                for(l=0;l<3;l++){
+                    const double ixi=1.0*((i==j)&&(k==l));
+                    const double i4sym=0.5*(((i==k)&&(j==l))+((i==l)&&(j==k)));
+                    const double *ni=normal+(i*3+j)*n,*nk=normal+(k*3+l)*n;
+                    jac=batch.Jacobian.data()+(((i*3+j)*3+k)*3+l)*n;
+                    #pragma omp simd
+                    for(q=0;q<n;q++) jac[q]=ca[q]*ixi+cb[q]*i4sym-cc[q]*ni[q]*nk[q];
+                }
+            }
+        }
+    }
+}
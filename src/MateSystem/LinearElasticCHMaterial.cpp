@@ -71,7 +71,7 @@ void LinearElasticCHMaterial::ComputeConstitutiveLaws(const vector<double> &Inpu
     CalcFreeEnergyAndDerivatives(InputParams,C,dFdc,d2Fdc2);
     
     // for different strains(coupling term) 
-    _TotalStrain=(F+F.Transpose())*0.5;// the total strain, here F is GradU
+    _TotalStrain.SetFromSymmetricPart(F);// the total strain, here F is GradU
     _I.SetToIdentity();
     // for the concentration induced eigen strain 
     _EigenStrain=_I*(C-C0)*Omega/3.0;
@@ -31,7 +31,7 @@ void LinearElasticMaterial::ComputeStrain(const LocalElmtInfo &elmtinfo, const L
     else if(elmtinfo.nDim==3){
         _GradU.SetFromGradU(elmtsoln.gpGradU[1],elmtsoln.gpGradU[2],elmtsoln.gpGradU[3]);
     }
-    Strain=(_GradU+_GradU.Transpose())*0.5;
+    Strain.SetFromSymmetricPart(_GradU);
 }
 //****************************************************************
 void LinearElasticMaterial::ComputeStressAndJacobian(const vector<double> &InputParams, const RankTwoTensor &Strain, RankTwoTensor &Stress, RankFourTensor &Jacobian){
@@ -39,9 +39,20 @@ void LinearElasticMaterial::ComputeStressAndJacobian(const vector<double> &Input
     const double E=InputParams[0];
     const double nu=InputParams[1];
 
-    Jacobian.SetToZeros();
-    Jacobian.SetFromEandNu(E,nu);
-    Stress=Jacobian.DoubleDot(Strain);
+    // the stress is calculated by the 6x6 Mandel matrix, the tangent is constant, so it is only built
+    // again once E or nu is changed, i.e. by the first point of another material block
+    UpdateElasticTangent(E,nu);
+    Stress=_SymJac.DoubleDot(Strain);
+    Jacobian=_Jac;
+}
+//****************************************************************
+void LinearElasticMaterial::UpdateElasticTangent(const double &E,const double &nu){
+    if(_IsTangentReady&&E==_TangentE&&nu==_TangentNu) return;
+    _SymJac.SetFromEandNu(E,nu);
+    // the full-index one is only filled for the elements and the UMAT-like callers
+    _Jac=_SymJac.ToRankFourTensor();
+    _TangentE=E;_TangentNu=nu;
+    _IsTangentReady=true;
 }
 //***************************************************************
 void LinearElasticMaterial::ComputeMaterialProperties(const vector<double> &InputParams, const LocalElmtInfo &elmtinfo, const LocalElmtSolution &elmtsoln, const Materials &MateOld, Materials &Mate) {
@@ -56,13 +67,63 @@ void LinearElasticMaterial::ComputeMaterialProperties(const vector<double> &Inpu
     }
 
     ComputeStrain(elmtinfo,elmtsoln,_Strain);
-    ComputeStressAndJacobian(InputParams,_Strain,_Stress,_Jac);
+    // the cached tangent is copied into the material map directly
+    ComputeStressAndJacobian(InputParams,_Strain,_Stress,Mate.Rank4Materials("jacobian"));
 
     _I.SetToIdentity();
     _devStress=_Stress-_I*(_Stress.Trace()/3.0);
     Mate.ScalarMaterials("vonMises")=sqrt(1.5*_devStress.DoubleDot(_devStress));
     Mate.Rank2Materials("strain")=_Strain;
     Mate.Rank2Materials("stress")=_Stress;
-    Mate.Rank4Materials("jacobian")=_Jac;
 
 }
+//***************************************************************
+void LinearElasticMaterial::ComputeBatchMaterialProperties(const vector<double> &InputParams,MateBatch &batch){
+    if(InputParams.size()<2){
+        MessagePrinter::PrintErrorTxt("for the linear elastic material, two parameters are required, you need to give: E and nu");
+        MessagePrinter::AsFem_Exit();
+    }
+    const double E=InputParams[0];
+    const double nu=InputParams[1];
+    const double lambda=E*nu/((1.0+nu)*(1.0-2.0*nu));
+    const double mu=E/(2.0*(1.0+nu));
+
+    const int n=batch.nPoints;
+    const double *gradu=batch.GradU.data();
+    double *strain=batch.Strain.data(),*stress=batch.Stress.data(),*vm=batch.VonMises.data(),*jac;
+    int i,j,k,l,q;
+    double value;
+
+    for(i=0;i<3;i++){
+        for(j=0;j<3;j++){
+            #pragma omp simd
+            for(q=0;q<n;q++) strain[(i*3+j)*n+q]=0.5*(gradu[(i*3+j)*n+q]+gradu[(j*3+i)*n+q]);
+        }
+    }
+    // sigma=lambda*tr(eps)*I+2*mu*eps, its trace is (3*lambda+2*mu)*tr(eps)
+    #pragma omp simd
+    for(q=0;q<n;q++){
+        const double tr=strain[q]+strain[4*n+q]+strain[8*n+q];
+        double sum=0.0,dev;
+        for(int c=0;c<9;c++){
+            const double delta=(c%4==0)?1.0:0.0;
+            stress[c*n+q]=2.0*mu*strain[c*n+q]+lambda*tr*delta;
+            dev=stress[c*n+q]-(3.0*lambda+2.0*mu)*tr*delta/3.0;
+            sum+=dev*dev;
+        }
+        vm[q]=sqrt(1.5*sum);
+    }
+    // the jacobian is the same one for all the points
+    for(i=0;i<3;i++){
+        for(j=0;j<3;j++){
+            for(k=0;k<3;k++){
+                for(l=0;l<3;l++){
+                    value=lambda*(i==j)*(k==l)+mu*((i==k)*(j==l)+(i==l)*(j==k));
+                    jac=batch.Jacobian.data()+(((i*3+j)*3+k)*3+l)*n;
+                    #pragma omp simd
+                    for(q=0;q<n;q++) jac[q]=value;
+                }
+            }
+        }
+    }
+}
@@ -23,5 +23,6 @@ MateSystem::MateSystem(){
     _Materials.Clean();
 
     _MaterialsOld.Clean();
+    RenewMaterialsGeneration();
 
 }
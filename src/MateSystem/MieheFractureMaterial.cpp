@@ -52,7 +52,7 @@ void MieheFractureMaterial::ComputeStrain(const LocalElmtInfo &elmtinfo,const Lo
         // DoFs: d ux uy uz
         GradU.SetFromGradU(elmtsoln.gpGradU[2],elmtsoln.gpGradU[3],elmtsoln.gpGradU[4]);
     }
-    Strain=(GradU+GradU.Transpose())*0.5;
+    Strain.SetFromSymmetricPart(GradU);
 }
 //************************************************************
 void MieheFractureMaterial::ComputeConstitutiveLaws(const vector<double> &InputParams,const double &damage,const RankTwoTensor &strain,RankTwoTensor &Stress,RankFourTensor &Jacobian,const Materials &MateOld, Materials &Mate){
@@ -84,20 +84,22 @@ void MieheFractureMaterial::ComputeConstitutiveLaws(const vector<double> &InputP
     I4Sym.SetToIdentitySymmetric4();
 
 
-    ProjPos=Strain.GetPositiveProjTensor();
+    Strain.CalcEigenValueAndEigenVectors(EigVal,EigVec);
+    RankTwoTensor::FillPositiveProjTensor(EigVal,EigVec,ProjPos);
     I4Sym.SetToIdentitySymmetric4();
-    ProjNeg=I4Sym-ProjPos;
+    ProjNeg.SetFromAxpby(1.0,I4Sym,-1.0,ProjPos);
 
     // for the positive and negative strain
-    EpsPos=ProjPos.DoubleDot(strain);
-    EpsNeg=Strain-EpsPos;
+    ProjPos.DoubleDotInto(strain,EpsPos);
+    EpsNeg.SetFromAxpby(1.0,Strain,-1.0,EpsPos);
 
     double trEps,signpos,signneg;
     double psi,psipos,psineg;
 
     trEps=Strain.Trace();
-    psipos=0.5*lambda*BracketPos(trEps)*BracketPos(trEps)+mu*(EpsPos*EpsPos).Trace();
-    psineg=0.5*lambda*BracketNeg(trEps)*BracketNeg(trEps)+mu*(EpsNeg*EpsNeg).Trace();
+    // EpsPos and EpsNeg are symmetric, so tr(Eps*Eps)=Eps:Eps
+    psipos=0.5*lambda*BracketPos(trEps)*BracketPos(trEps)+mu*EpsPos.DoubleDot(EpsPos);
+    psineg=0.5*lambda*BracketNeg(trEps)*BracketNeg(trEps)+mu*EpsNeg.DoubleDot(EpsNeg);
     psi=(g+k)*psipos+psineg;
 
     Mate.ScalarMaterials("Psi")=psi;
@@ -106,10 +108,10 @@ void MieheFractureMaterial::ComputeConstitutiveLaws(const vector<double> &InputP
 
 
     I.SetToIdentity();
-    StressPos=I*lambda*BracketPos(trEps)+EpsPos*2*mu;
-    StressNeg=I*lambda*BracketNeg(trEps)+EpsNeg*2*mu;
+    StressPos.SetFromAxpby(lambda*BracketPos(trEps),I,2*mu,EpsPos);
+    StressNeg.SetFromAxpby(lambda*BracketNeg(trEps),I,2*mu,EpsNeg);
 
-    Stress=StressPos*(g+k)+StressNeg;
+    Stress.SetFromAxpby(g+k,StressPos,1.0,StressNeg);
     Mate.Rank2Materials("dstressdD")=StressPos*dg;
 
     Mate.ScalarMaterials("H")=0.0;// we use H instead of Hist for our element
@@ -136,9 +138,9 @@ void MieheFractureMaterial::ComputeConstitutiveLaws(const vector<double> &InputP
     signneg=0.0;
     if(BracketNeg(trEps)<0) signneg=1.0;
 
-    Jacobian.SetToZeros();
-    Jacobian=(I.OTimes(I)*lambda*signpos+ProjPos*2*mu)*(g+k)
-        +I.OTimes(I)*lambda*signneg+ProjNeg*2*mu;
+    // Jacobian=(IxI*lambda*signpos+ProjPos*2*mu)*(g+k)+IxI*lambda*signneg+ProjNeg*2*mu
+    Jacobian.SetFromAxpby(2*mu*(g+k),ProjPos,2*mu,ProjNeg);
+    Jacobian.AddOTimes(lambda*(signpos*(g+k)+signneg),I,I);
 
 }
 //************************************************************
@@ -33,7 +33,7 @@ void Plastic1DMaterial::ComputeStrain(const LocalElmtInfo &elmtinfo, const Local
         MessagePrinter::PrintErrorTxt("Plastic1DMaterial only works for 1d case");
         MessagePrinter::AsFem_Exit();
     }
-    Strain=(_GradU+_GradU.Transpose())*0.5;
+    Strain.SetFromSymmetricPart(_GradU);
 }
 //****************************************************************************
 double Plastic1DMaterial::ComputeYieldFunction(const vector<double> &InputParams, const double &trial_strss,
@@ -0,0 +1,67 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.08
+//+++ Purpose: call the batched kernels of the built-in materials,
+//+++          where all the gauss points of one element are done
+//+++          in one call
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "MateSystem/BulkMateSystem.h"
+
+// the names are built only once, a temporary string of the long name would allocate for each point
+static const string PlasticStrainName="plastic_strain";
+static const string EffectivePlasticStrainName="effective_plastic_strain";
+
+void BulkMateSystem::PackBulkMateBatchOld(const MateType &imate,const int &q,
+                                          const ScalarMateType &scalarold,const Rank2MateType &rank2old,
+                                          MateBatch &batch)const{
+    if(imate==MateType::J2PLASTICITYMATE){
+        batch.SetRank2(rank2old.at(PlasticStrainName),q,batch.HistOld);
+        batch.HistOld[9*batch.nPoints+q]=scalarold.at(EffectivePlasticStrainName);
+    }
+}
+//**************************************************************
+void BulkMateSystem::RunBulkMateBatchLibs(const MateType &imate,const int &mateindex,MateBatch &batch){
+    switch (imate){
+        case MateType::LINEARELASTICMATE:
+            LinearElasticMaterial::ComputeBatchMaterialProperties(_BulkMateBlockList[mateindex-1]._Parameters,batch);
+            break;
+        case MateType::J2PLASTICITYMATE:
+            J2PlasticityMaterial::ComputeBatchMaterialProperties(_BulkMateBlockList[mateindex-1]._Parameters,batch);
+            break;
+        default:
+            MessagePrinter::PrintErrorTxt("unsupported material type in RunBulkMateBatchLibs of the MateSystem, the batched kernel is only available for the linear elastic and J2 plasticity materials");
+            MessagePrinter::AsFem_Exit();
+            break;
+    }
+}
+//**************************************************************
+void BulkMateSystem::UnpackBulkMateBatch(const MateType &imate,const int &q,const MateBatch &batch){
+    BatchMateSlots &slots=_BatchMateSlots;
+    if(slots.VonMises==nullptr){
+        slots.VonMises=&_Materials.ScalarMaterials("vonMises");
+        slots.Strain=&_Materials.Rank2Materials("strain");
+        slots.Stress=&_Materials.Rank2Materials("stress");
+        slots.Jacobian=&_Materials.Rank4Materials("jacobian");
+    }
+    if(imate==MateType::J2PLASTICITYMATE){
+        if(slots.EffectivePlasticStrain==nullptr){
+            slots.EffectivePlasticStrain=&_Materials.ScalarMaterials(EffectivePlasticStrainName);
+            slots.PlasticStrain=&_Materials.Rank2Materials(PlasticStrainName);
+        }
+        *slots.EffectivePlasticStrain=batch.Hist[9*batch.nPoints+q];
+        batch.GetRank2(batch.Hist,q,*slots.PlasticStrain);
+    }
+    *slots.VonMises=batch.VonMises[q];
+    batch.GetRank2(batch.Strain,q,*slots.Strain);
+    batch.GetRank2(batch.Stress,q,*slots.Stress);
+    batch.GetJacobian(q,*slots.Jacobian);
+}
@@ -51,7 +51,7 @@ void StressDecompositionMaterial::ComputeStrain(const LocalElmtInfo &elmtinfo,co
         // DoFs: d ux uy uz
         _GradU.SetFromGradU(elmtsoln.gpGradU[2],elmtsoln.gpGradU[3],elmtsoln.gpGradU[4]);
     }
-    Strain=(_GradU+_GradU.Transpose())*0.5;
+    Strain.SetFromSymmetricPart(_GradU);
 }
 //************************************************************
 void StressDecompositionMaterial::ComputeConstitutiveLaws(const vector<double> &InputParams,const double &damage,const RankTwoTensor &Strain,RankTwoTensor &Stress,RankFourTensor &Jacobian,const Materials &MateOld, Materials &Mate){
@@ -94,18 +94,19 @@ void StressDecompositionMaterial::ComputeConstitutiveLaws(const vector<double> &
     _Cijkl=_Cijkl0.Rotate(_Rot);
 
     // this stress is the temporary one!!!
-    Stress=_Cijkl.DoubleDot(Strain);
+    _Cijkl.DoubleDotInto(Strain,Stress);
 
-    _ProjPos=Stress.GetPositiveProjTensor();
+    Stress.CalcEigenValueAndEigenVectors(_EigVal,_EigVec);
+    RankTwoTensor::FillPositiveProjTensor(_EigVal,_EigVec,_ProjPos);
     _I4Sym.SetToIdentitySymmetric4();
 
     // now we can get positive and negative stress
-    _StressPos=_ProjPos.DoubleDot(Stress);
-    _StressNeg=Stress-_StressPos;
-    Stress.SetToZeros();
-    Stress=_StressPos*(g+k)+_StressNeg;
-    Jacobian.SetToZeros();
-    Jacobian=(_I4Sym-_ProjPos*(1-g-k)).DoubleDot(_Cijkl);
+    _ProjPos.DoubleDotInto(Stress,_StressPos);
+    _StressNeg.SetFromAxpby(1.0,Stress,-1.0,_StressPos);
+    Stress.SetFromAxpby(g+k,_StressPos,1.0,_StressNeg);
+    // Jacobian=(I4Sym-(1-g-k)*ProjPos):Cijkl
+    _DegProj.SetFromAxpby(1.0,_I4Sym,-(1-g-k),_ProjPos);
+    _DegProj.DoubleDotInto(_Cijkl,Jacobian);
     // for the positive and negative elastic free energy
     _psipos=0.5*_StressPos.DoubleDot(Strain);
     _psineg=0.5*_StressNeg.DoubleDot(Strain);
@@ -100,7 +100,8 @@ bool LagrangeMesh::Create1DLagrangeMesh(){
     _ElmtVolume[0]=0.0;// the 'volume' of point is zero
     _ElmtVolume[1]=0.0;// the 'volume' of point is zero
 
-    _ElmtConn.resize(_nElmts,vector<PetscInt>(0));
+    // the first two elements are the point elements(left and right), then the bulk elements
+    AllocateBulkMeshElmtConn(2,1);
     _ElmtVTKCellTypeList.resize(_nElmts,0);
     _NodeCoords.resize(_nNodes*3,0.0);
     for(PetscInt i=0;i<_nNodes;++i){
@@ -110,11 +111,8 @@ bool LagrangeMesh::Create1DLagrangeMesh(){
     }
 
     // generate the element connectivity information
-    _ElmtConn[0].push_back(1);// first component is length
-    _ElmtConn[0].push_back(1);// second one is the node index(start from 1, not zero!!!)
-
-    _ElmtConn[1].push_back(1);
-    _ElmtConn[1].push_back(_nNodes);
+    GetBulkMeshIthElmtNodeIDsPtr(1)[0]=1;// the node index(start from 1, not zero!!!)
+    GetBulkMeshIthElmtNodeIDsPtr(2)[0]=_nNodes;
 
     vector<int> left,right;
     left.clear();left.push_back(1);// element id index
@@ -127,11 +125,10 @@ bool LagrangeMesh::Create1DLagrangeMesh(){
     vector<int> tempconn;
     tempconn.clear();
     for(int e=0;e<_nBulkElmts;++e){
-        _ElmtConn[2+e].clear();
-        _ElmtConn[2+e].push_back(_nNodesPerBulkElmt);
         tempconn.push_back(2+e+1);
+        Span<int> elConn=GetBulkMeshIthElmtNodeIDsPtr(2+e+1);
         for(int j=1;j<=_nNodesPerBulkElmt;++j){
-            _ElmtConn[2+e].push_back(e*_nOrder+j);
+            elConn(j)=e*_nOrder+j;
         }
         _ElmtVTKCellTypeList[2+e]=_BulkElmtVTKCellType;
     }
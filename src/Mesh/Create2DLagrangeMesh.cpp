@@ -52,6 +52,7 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
     int e,i,j,k;
     int i1,i2,i3,i4,i5,i6,i7,i8,i9;
     int nNodesPerBCElmt;
+    Span<int> elConn;
 
     nNodesPerBCElmt=2;
 
@@ -87,7 +88,7 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
             }
         }
         // Connectivity information for bulk element
-        _ElmtConn.resize(_nElmts,vector<int>(0));
+        AllocateBulkMeshElmtConn(_nElmts-_nBulkElmts,nNodesPerBCElmt);
         _ElmtVTKCellTypeList.resize(_nElmts,0);
         _ElmtVolume.resize(_nElmts,0.0);
         tempconn.clear();
@@ -99,12 +100,11 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
                 i3=i2+_Nx+1;
                 i4=i3-1;
 
-                _ElmtConn[e-1+_nElmts-_nBulkElmts].clear();
-                _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(_nNodesPerBulkElmt);
-                _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i1);
-                _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i2);
-                _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i3);
-                _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i4);
+                elConn=GetBulkMeshIthElmtNodeIDsPtr(e+_nElmts-_nBulkElmts);
+                elConn[0]=i1;
+                elConn[1]=i2;
+                elConn[2]=i3;
+                elConn[3]=i4;
                 _ElmtVTKCellTypeList[e-1+_nElmts-_nBulkElmts]=_BulkElmtVTKCellType;
 
                 _ElmtVolume[e-1+_nElmts-_nBulkElmts]=dx*dy;
@@ -164,7 +164,7 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
             _NodeCoords[(k-1)*3+3-1]=0.0;
         }
         // Create connectivity matrix
-        _ElmtConn.resize(_nElmts,vector<int>(0));
+        AllocateBulkMeshElmtConn(_nElmts-_nBulkElmts,nNodesPerBCElmt);
         _ElmtVTKCellTypeList.resize(_nElmts,0);
         _ElmtVolume.resize(_nElmts,0.0);
         tempconn.clear();
@@ -182,16 +182,15 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
                 i8=i1+(2*_Nx+1)-(i-1);
 
 
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].clear();
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(_nNodesPerBulkElmt);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i1);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i2);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i3);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i4);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i5);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i6);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i7);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i8);
+                elConn=GetBulkMeshIthElmtNodeIDsPtr(e+_nElmts-_nBulkElmts);
+                elConn[0]=i1;
+                elConn[1]=i2;
+                elConn[2]=i3;
+                elConn[3]=i4;
+                elConn[4]=i5;
+                elConn[5]=i6;
+                elConn[6]=i7;
+                elConn[7]=i8;
 
                 _ElmtVTKCellTypeList[e-1+_nElmts-_nBulkElmts]=_BulkElmtVTKCellType;
 
@@ -232,7 +231,7 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
             }
         }
         // Create Connectivity matrix
-        _ElmtConn.resize(_nElmts,vector<int>(0));
+        AllocateBulkMeshElmtConn(_nElmts-_nBulkElmts,nNodesPerBCElmt);
         _ElmtVTKCellTypeList.resize(_nElmts,0);
         _ElmtVolume.resize(_nElmts,0.0);
         tempconn.clear();
@@ -251,17 +250,16 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
                 i9=i8+1;
 
 
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].clear();
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(_nNodesPerBulkElmt);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i1);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i2);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i3);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i4);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i5);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i6);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i7);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i8);
-                _ElmtConn[(e-1)+_nElmts-_nBulkElmts].push_back(i9);
+                elConn=GetBulkMeshIthElmtNodeIDsPtr(e+_nElmts-_nBulkElmts);
+                elConn[0]=i1;
+                elConn[1]=i2;
+                elConn[2]=i3;
+                elConn[3]=i4;
+                elConn[4]=i5;
+                elConn[5]=i6;
+                elConn[6]=i7;
+                elConn[7]=i8;
+                elConn[8]=i9;
 
                 _ElmtVTKCellTypeList[e-1+_nElmts-_nBulkElmts]=_BulkElmtVTKCellType;
 
@@ -323,21 +321,19 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
     i=1;
     for(j=1;j<=_Ny;j++){
         e=(j-1)*_Nx+i;
-        _ElmtConn[nBCElmts].clear();
+        elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
         if(nNodesPerBCElmt==2){
             // quad4 case
-            _ElmtConn[nBCElmts].push_back(2);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
             _ElmtVTKCellTypeList[nBCElmts]=3;
             leftnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
             leftnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
         }
         else{
-            _ElmtConn[nBCElmts].push_back(3);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+            elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
             _ElmtVTKCellTypeList[nBCElmts]=4;
 
             leftnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
@@ -356,22 +352,20 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
     rightnodeids.clear();
     i=_Nx;
     for(j=1;j<=_Ny;j++){
-        _ElmtConn[nBCElmts].clear();
+        elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
         e=(j-1)*_Nx+i;
         if(nNodesPerBCElmt==2){
             // quad4 case
-            _ElmtConn[nBCElmts].push_back(2);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
             _ElmtVTKCellTypeList[nBCElmts]=3;
             rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
             rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
         }
         else{
-            _ElmtConn[nBCElmts].push_back(3);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+            elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
             _ElmtVTKCellTypeList[nBCElmts]=4;
             rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
             rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
@@ -389,21 +383,19 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
     j=1;
     for(i=1;i<=_Nx;i++){
         e=(j-1)*_Nx+i;
-        _ElmtConn[nBCElmts].clear();
+        elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
         if(nNodesPerBCElmt==2){
             // quad4 case
-            _ElmtConn[nBCElmts].push_back(2);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
             _ElmtVTKCellTypeList[nBCElmts]=3;
             bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
             bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
         }
         else{
-            _ElmtConn[nBCElmts].push_back(3);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+            elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
             _ElmtVTKCellTypeList[nBCElmts]=4;
             bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
             bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
@@ -421,21 +413,19 @@ bool LagrangeMesh::Create2DLagrangeMesh(){
     j=_Ny;
     for(i=1;i<=_Nx;i++){
         e=(j-1)*_Nx+i;
-        _ElmtConn[nBCElmts].clear();
+        elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
         if(nNodesPerBCElmt==2){
             // quad4 case
-            _ElmtConn[nBCElmts].push_back(2);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
             _ElmtVTKCellTypeList[nBCElmts]=3;
             topnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
             topnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
         }
         else{
-            _ElmtConn[nBCElmts].push_back(3);
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-            _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
+            elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+            elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+            elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
             _ElmtVTKCellTypeList[nBCElmts]=4;
             topnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
             topnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
@@ -58,6 +58,7 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     int i20,i21,i22,i23,i24,i25,i26,i27;
     int nNodesPerBCElmt=4;
     int VTKCellType;
+    Span<int> elConn;
 
     if(_BulkMeshType==MeshType::HEX8){
         _nOrder=1;
@@ -95,7 +96,7 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
             }
         }
         // Create Connectivity matrix
-        _ElmtConn.resize(_nElmts,vector<int>(0));
+        AllocateBulkMeshElmtConn(_nElmts-_nBulkElmts,nNodesPerBCElmt);
         _ElmtVolume.resize(_nElmts,0.0);
         tempconn.clear();
         _ElmtVTKCellTypeList.resize(_nElmts,0);
@@ -113,16 +114,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                     i7=i3+(_Nx+1)*(_Ny+1);
                     i8=i4+(_Nx+1)*(_Ny+1);
 
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].clear();
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(_nNodesPerBulkElmt);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i1);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i2);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i3);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i4);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i5);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i6);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i7);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i8);
+                    elConn=GetBulkMeshIthElmtNodeIDsPtr(e+_nElmts-_nBulkElmts);
+                    elConn[0]=i1;
+                    elConn[1]=i2;
+                    elConn[2]=i3;
+                    elConn[3]=i4;
+                    elConn[4]=i5;
+                    elConn[5]=i6;
+                    elConn[6]=i7;
+                    elConn[7]=i8;
                     _ElmtVTKCellTypeList[e-1+_nElmts-_nBulkElmts]=VTKCellType;
 
                     _ElmtVolume[e-1+_nElmts-_nBulkElmts]=dx*dy*dz;
@@ -227,7 +227,7 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
         // Create Connectivity matrix
         //***************************************
         tempconn.clear();
-        _ElmtConn.resize(_nElmts,vector<int>(0));
+        AllocateBulkMeshElmtConn(_nElmts-_nBulkElmts,nNodesPerBCElmt);
         _ElmtVolume.resize(_nElmts,0.0);
         _ElmtVTKCellTypeList.resize(_nElmts,0);
         for(k=1;k<=_Nz;++k){
@@ -259,30 +259,29 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                     i19=i18+_Nx+1;
                     i20=i19-1;
 
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].clear();
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(_nNodesPerBulkElmt);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i1);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i2);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i3);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i4);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i5);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i6);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i7);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i8);
-
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i9);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i10);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i11);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i12);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i13);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i14);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i15);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i16);
-
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i17);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i18);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i19);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i20);
+                    elConn=GetBulkMeshIthElmtNodeIDsPtr(e+_nElmts-_nBulkElmts);
+                    elConn[0]=i1;
+                    elConn[1]=i2;
+                    elConn[2]=i3;
+                    elConn[3]=i4;
+                    elConn[4]=i5;
+                    elConn[5]=i6;
+                    elConn[6]=i7;
+                    elConn[7]=i8;
+
+                    elConn[8]=i9;
+                    elConn[9]=i10;
+                    elConn[10]=i11;
+                    elConn[11]=i12;
+                    elConn[12]=i13;
+                    elConn[13]=i14;
+                    elConn[14]=i15;
+                    elConn[15]=i16;
+
+                    elConn[16]=i17;
+                    elConn[17]=i18;
+                    elConn[18]=i19;
+                    elConn[19]=i20;
 
                     _ElmtVTKCellTypeList[e-1+_nElmts-_nBulkElmts]=VTKCellType;
 
@@ -358,7 +357,7 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
         }
         // Create Connectivity matrix
         tempconn.clear();
-        _ElmtConn.resize(_nElmts,vector<int>(0));
+        AllocateBulkMeshElmtConn(_nElmts-_nBulkElmts,nNodesPerBCElmt);
         _ElmtVolume.resize(_nElmts,0.0);
         _ElmtVTKCellTypeList.resize(_nElmts,0);
         for(k=1;k<=_Nz;++k){
@@ -404,37 +403,36 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
 
                     i27=i21+1;
 
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].clear();
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(_nNodesPerBulkElmt);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i1);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i2);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i3);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i4);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i5);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i6);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i7);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i8);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i9);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i10);
-
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i11);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i12);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i13);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i14);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i15);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i16);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i17);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i18);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i19);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i20);
-
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i21);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i22);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i23);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i24);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i25);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i26);
-                    _ElmtConn[e-1+_nElmts-_nBulkElmts].push_back(i27);
+                    elConn=GetBulkMeshIthElmtNodeIDsPtr(e+_nElmts-_nBulkElmts);
+                    elConn[0]=i1;
+                    elConn[1]=i2;
+                    elConn[2]=i3;
+                    elConn[3]=i4;
+                    elConn[4]=i5;
+                    elConn[5]=i6;
+                    elConn[6]=i7;
+                    elConn[7]=i8;
+                    elConn[8]=i9;
+                    elConn[9]=i10;
+
+                    elConn[10]=i11;
+                    elConn[11]=i12;
+                    elConn[12]=i13;
+                    elConn[13]=i14;
+                    elConn[14]=i15;
+                    elConn[15]=i16;
+                    elConn[16]=i17;
+                    elConn[17]=i18;
+                    elConn[18]=i19;
+                    elConn[19]=i20;
+
+                    elConn[20]=i21;
+                    elConn[21]=i22;
+                    elConn[22]=i23;
+                    elConn[23]=i24;
+                    elConn[24]=i25;
+                    elConn[25]=i26;
+                    elConn[26]=i27;
 
                     _ElmtVTKCellTypeList[e-1+_nElmts-_nBulkElmts]=VTKCellType;
 
@@ -520,15 +518,14 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     for(k=1;k<=_Nz;k++){
         for(j=1;j<=_Ny;j++){
             e=(j-1)*_Nx+i+(k-1)*_Nx*_Ny;
-            _ElmtConn[nBCElmts].clear();
+            elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
             if(nNodesPerBCElmt==4){
                 // hex8 case
                 // must out of plane
-                _ElmtConn[nBCElmts].push_back(4);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
                 _ElmtVTKCellTypeList[nBCElmts]=9;
 
                 leftnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
@@ -537,16 +534,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 leftnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
             }
             else if(nNodesPerBCElmt==8){
-                _ElmtConn[nBCElmts].push_back(8);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,17));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,16));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,20));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,12));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,17);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,16);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,20);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,12);
 
                 _ElmtVTKCellTypeList[nBCElmts]=23;
 
@@ -561,18 +557,17 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 leftnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,12));
             }
             else if(nNodesPerBCElmt==9){
-                _ElmtConn[nBCElmts].push_back(9);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,17));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,16));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,20));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,12));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,17);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,16);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,20);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,12);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,21));
+                elConn[8]=GetBulkMeshIthBulkElmtJthNodeID(e,21);
 
                 _ElmtVTKCellTypeList[nBCElmts]=28;
 
@@ -602,15 +597,14 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     for(k=1;k<=_Nz;k++){
         for(j=1;j<=_Ny;j++){
             e=(j-1)*_Nx+i+(k-1)*_Nx*_Ny;
-            _ElmtConn[nBCElmts].clear();
+            elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
             if(nNodesPerBCElmt==4){
                 // hex8 case
                 // must out of plane
-                _ElmtConn[nBCElmts].push_back(4);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
                 _ElmtVTKCellTypeList[nBCElmts]=9;
                 
                 rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
@@ -619,16 +613,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
             }
             else if(nNodesPerBCElmt==8){
-                _ElmtConn[nBCElmts].push_back(8);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,10));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,19));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,14));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,18));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,10);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,19);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,14);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,18);
                 _ElmtVTKCellTypeList[nBCElmts]=23;
 
                 rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
@@ -642,18 +635,17 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,18));
             }
             else if(nNodesPerBCElmt==9){
-                _ElmtConn[nBCElmts].push_back(9);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,10));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,19));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,14));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,18));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,22));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,10);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,19);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,14);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,18);
+
+                elConn[8]=GetBulkMeshIthBulkElmtJthNodeID(e,22);
                 _ElmtVTKCellTypeList[nBCElmts]=28;
 
                 rightnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
@@ -682,15 +674,14 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     for(k=1;k<=_Nz;k++){
         for(i=1;i<=_Nx;i++){
             e=(j-1)*_Nx+i+(k-1)*_Nx*_Ny;
-            _ElmtConn[nBCElmts].clear();
+            elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
             if(nNodesPerBCElmt==4){
                 // hex8 case
                 // must out of plane
-                _ElmtConn[nBCElmts].push_back(4);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
                 _ElmtVTKCellTypeList[nBCElmts]=9;
 
                 bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
@@ -699,16 +690,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
             }
             else if(nNodesPerBCElmt==8){
-                _ElmtConn[nBCElmts].push_back(8);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,9));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,18));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,13));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,17));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,9);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,18);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,13);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,17);
                 _ElmtVTKCellTypeList[nBCElmts]=23;
 
                 bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
@@ -722,18 +712,17 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,17));
             }
             else if(nNodesPerBCElmt==9){
-                _ElmtConn[nBCElmts].push_back(9);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,9));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,18));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,13));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,17));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,23));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,9);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,18);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,13);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,17);
+
+                elConn[8]=GetBulkMeshIthBulkElmtJthNodeID(e,23);
                 _ElmtVTKCellTypeList[nBCElmts]=28;
 
                 bottomnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
@@ -762,15 +751,14 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     for(k=1;k<=_Nz;k++){
         for(i=1;i<=_Nx;i++){
             e=(j-1)*_Nx+i+(k-1)*_Nx*_Ny;
-            _ElmtConn[nBCElmts].clear();
+            elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
             if(nNodesPerBCElmt==4){
                 // hex8 case
                 // must out of plane
-                _ElmtConn[nBCElmts].push_back(4);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
 
                 _ElmtVTKCellTypeList[nBCElmts]=9;
 
@@ -780,16 +768,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 topnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
             }
             else if(nNodesPerBCElmt==8){
-                _ElmtConn[nBCElmts].push_back(8);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,20));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,15));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,19));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,11));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,20);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,15);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,19);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,11);
 
                 _ElmtVTKCellTypeList[nBCElmts]=23;
 
@@ -804,18 +791,17 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 topnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,11));
             }
             else if(nNodesPerBCElmt==9){
-                _ElmtConn[nBCElmts].push_back(9);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,20));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,15));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,19));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,11));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,20);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,15);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,19);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,11);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,24));
+                elConn[8]=GetBulkMeshIthBulkElmtJthNodeID(e,24);
 
                 _ElmtVTKCellTypeList[nBCElmts]=28;
 
@@ -845,15 +831,14 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     for(j=1;j<=_Ny;j++){
         for(i=1;i<=_Nx;i++){
             e=(j-1)*_Nx+i+(k-1)*_Nx*_Ny;
-            _ElmtConn[nBCElmts].clear();
+            elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
             if(nNodesPerBCElmt==4){
                 // hex8 case
                 // must out of plane
-                _ElmtConn[nBCElmts].push_back(4);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
 
                 _ElmtVTKCellTypeList[nBCElmts]=9;
 
@@ -863,16 +848,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 backnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
             }
             else if(nNodesPerBCElmt==8){
-                _ElmtConn[nBCElmts].push_back(8);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,12));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,11));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,10));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,9));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,12);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,11);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,10);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,9);
 
                 _ElmtVTKCellTypeList[nBCElmts]=23;
 
@@ -887,18 +871,17 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 backnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,9));
             }
             else if(nNodesPerBCElmt==9){
-                _ElmtConn[nBCElmts].push_back(9);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,1));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,4));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,3));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,2));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,1);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,4);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,3);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,2);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,12));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,11));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,10));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,9));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,12);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,11);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,10);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,9);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,25));
+                elConn[8]=GetBulkMeshIthBulkElmtJthNodeID(e,25);
 
                 _ElmtVTKCellTypeList[nBCElmts]=28;
 
@@ -928,15 +911,14 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
     for(j=1;j<=_Ny;j++){
         for(i=1;i<=_Nx;i++){
             e=(j-1)*_Nx+i+(k-1)*_Nx*_Ny;
-            _ElmtConn[nBCElmts].clear();
+            elConn=GetBulkMeshIthElmtNodeIDsPtr(nBCElmts+1);
             if(nNodesPerBCElmt==4){
                 // hex8 case
                 // must out of plane
-                _ElmtConn[nBCElmts].push_back(4);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
 
                 _ElmtVTKCellTypeList[nBCElmts]=9;
 
@@ -946,16 +928,15 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 frontnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
             }
             else if(nNodesPerBCElmt==8){
-                _ElmtConn[nBCElmts].push_back(8);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
 
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,13));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,14));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,15));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,16));
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,13);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,14);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,15);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,16);
 
                 _ElmtVTKCellTypeList[nBCElmts]=23;
 
@@ -970,18 +951,17 @@ bool LagrangeMesh::Create3DLagrangeMesh(){
                 frontnodeids.push_back(GetBulkMeshIthBulkElmtJthNodeID(e,16));
             }
             else if(nNodesPerBCElmt==9){
-                _ElmtConn[nBCElmts].push_back(9);
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,5));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,6));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,7));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,8));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,13));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,14));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,15));
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,16));
-
-                _ElmtConn[nBCElmts].push_back(GetBulkMeshIthBulkElmtJthNodeID(e,26));
+                elConn[0]=GetBulkMeshIthBulkElmtJthNodeID(e,5);
+                elConn[1]=GetBulkMeshIthBulkElmtJthNodeID(e,6);
+                elConn[2]=GetBulkMeshIthBulkElmtJthNodeID(e,7);
+                elConn[3]=GetBulkMeshIthBulkElmtJthNodeID(e,8);
+
+                elConn[4]=GetBulkMeshIthBulkElmtJthNodeID(e,13);
+                elConn[5]=GetBulkMeshIthBulkElmtJthNodeID(e,14);
+                elConn[6]=GetBulkMeshIthBulkElmtJthNodeID(e,15);
+                elConn[7]=GetBulkMeshIthBulkElmtJthNodeID(e,16);
+
+                elConn[8]=GetBulkMeshIthBulkElmtJthNodeID(e,26);
 
                 _ElmtVTKCellTypeList[nBCElmts]=28;
 
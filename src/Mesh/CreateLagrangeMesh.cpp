@@ -19,18 +19,20 @@
 #include "Mesh/LagrangeMesh.h"
 
 bool LagrangeMesh::CreateLagrangeMesh(){
+    bool IsSuccess=false;
     if(GetBulkMeshDim()==1){
-        return Create1DLagrangeMesh();
+        IsSuccess=Create1DLagrangeMesh();
     }
     else if(GetBulkMeshDim()==2){
-        return Create2DLagrangeMesh();
+        IsSuccess=Create2DLagrangeMesh();
     }
     else if(GetBulkMeshDim()==3){
-        return Create3DLagrangeMesh();
+        IsSuccess=Create3DLagrangeMesh();
     }
     else{
         MessagePrinter::PrintErrorTxt("unsupported dim(>3) for mesh generation");
         return false;
     }
-    return false;
-}
\ No newline at end of file
+    if(IsSuccess) UpdateBulkMeshPhysicalGroupIndex();
+    return IsSuccess;
+}
@@ -18,6 +18,7 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "Mesh/LagrangeMesh.h"
+#include "Utils/MemoryUsage.h"
 
 LagrangeMesh::LagrangeMesh(){
     _IsMeshCreated=false;
@@ -33,6 +34,8 @@ LagrangeMesh::LagrangeMesh(){
     _LineMeshType=MeshType::EDGE2;
     _NodeCoords.clear();// store all the nodes/controlpts' coordinate
     _ElmtConn.clear();  // store all the element(bulk+surface+line+node elements)
+    _ElmtConnOffset.clear();
+    _BulkElmtConnStride=0;_BulkElmtConnOffset=0;
     _ElmtVolume.clear();// it could be: volume(3D), area(2D) or length(1D)
 
     _ElmtVTKCellTypeList.clear();
@@ -63,6 +66,14 @@ LagrangeMesh::LagrangeMesh(){
     _NodeSetPhysicalGroupID2NameList.clear();
     _NodeSetPhysicalGroupName2IDList.clear();
     _NodeSetPhysicalName2NodeIDsList.clear();
+
+    _PhysicalGroupNameIndex.clear();
+    _PhysicalID2NameIndex.clear();
+    _PhysicalName2IDIndex.clear();
+    _PhysicalName2NodesNumPerElmtIndex.clear();
+    _PhysicalName2ElmtIDsIndex.clear();
+    _NodeSetPhysicalName2NodeIDsIndex.clear();
+    _EmptyIDList.clear();
     
 }
 
@@ -128,4 +139,76 @@ void LagrangeMesh::SetBulkMeshMeshTypeName(string meshname){
         MessagePrinter::PrintErrorTxt("unsupported mesh type setting");
         MessagePrinter::AsFem_Exit();
     }
-}
\ No newline at end of file
+}//************************************************************
+void LagrangeMesh::AllocateBulkMeshElmtConn(const vector<int> &elmtnodesnum){
+    _ElmtConnOffset.resize(elmtnodesnum.size()+1);
+    _ElmtConnOffset[0]=0;
+    for(int e=0;e<static_cast<int>(elmtnodesnum.size());e++){
+        _ElmtConnOffset[e+1]=_ElmtConnOffset[e]+elmtnodesnum[e];
+    }
+    _ElmtConn.assign(_ElmtConnOffset.back(),0);
+    UpdateBulkMeshElmtConnStride();
+}
+void LagrangeMesh::AllocateBulkMeshElmtConn(const int &nbcelmts,const int &nnodesperbcelmt){
+    vector<int> elmtnodesnum(_nElmts,_nNodesPerBulkElmt);
+    for(int e=0;e<nbcelmts;e++) elmtnodesnum[e]=nnodesperbcelmt;
+    AllocateBulkMeshElmtConn(elmtnodesnum);
+}
+//************************************************************
+void LagrangeMesh::UpdateBulkMeshElmtConnStride(){
+    // the bulk elements are always stored at the end of the element list
+    _BulkElmtConnStride=0;_BulkElmtConnOffset=0;
+    if(_nBulkElmts<1||_nElmts<_nBulkElmts||static_cast<int>(_ElmtConnOffset.size())!=_nElmts+1) return;
+    int stride=_ElmtConnOffset[_nElmts-_nBulkElmts+1]-_ElmtConnOffset[_nElmts-_nBulkElmts];
+    for(int e=_nElmts-_nBulkElmts;e<_nElmts;e++){
+        if(_ElmtConnOffset[e+1]-_ElmtConnOffset[e]!=stride) return;
+    }
+    _BulkElmtConnStride=stride;
+    _BulkElmtConnOffset=_ElmtConnOffset[_nElmts-_nBulkElmts];
+}
+//************************************************************
+void LagrangeMesh::UpdateBulkMeshPhysicalGroupIndex(){
+    // emplace never overwrites the existing key, so the first one is used for the duplicated name,
+    // which is the same as the linear search
+    auto BuildIndex=[](const auto &list,unordered_map<string,int> &index){
+        index.clear();
+        index.reserve(list.size());
+        for(int i=0;i<static_cast<int>(list.size());i++) index.emplace(list[i].first,i);
+    };
+    _PhysicalGroupNameIndex.clear();
+    _PhysicalGroupNameIndex.reserve(_PhysicalGroupNameList.size());
+    for(int i=0;i<static_cast<int>(_PhysicalGroupNameList.size())&&i<static_cast<int>(_PhysicalGroupDimList.size());i++){
+        _PhysicalGroupNameIndex.emplace(_PhysicalGroupNameList[i],i);
+    }
+    _PhysicalID2NameIndex.clear();
+    _PhysicalID2NameIndex.reserve(_PhysicalGroupID2NameList.size());
+    for(int i=0;i<static_cast<int>(_PhysicalGroupID2NameList.size());i++){
+        _PhysicalID2NameIndex.emplace(_PhysicalGroupID2NameList[i].first,i);
+    }
+    BuildIndex(_PhysicalGroupName2IDList,_PhysicalName2IDIndex);
+    BuildIndex(_PhysicalGroupName2NodesNumPerElmtList,_PhysicalName2NodesNumPerElmtIndex);
+    BuildIndex(_PhysicalName2ElmtIDsList,_PhysicalName2ElmtIDsIndex);
+    BuildIndex(_NodeSetPhysicalName2NodeIDsList,_NodeSetPhysicalName2NodeIDsIndex);
+}
+
+double LagrangeMesh::GetBulkMeshMemoryUsage()const{
+    double bytes=0.0;
+    bytes+=MemoryUsage::Of(_NodeCoords);
+    bytes+=MemoryUsage::Of(_ElmtConn)+MemoryUsage::Of(_ElmtConnOffset);
+    bytes+=MemoryUsage::Of(_ElmtVolume);
+    bytes+=MemoryUsage::Of(_ElmtVTKCellTypeList)+MemoryUsage::Of(_ElmtPhyIDList);
+    bytes+=MemoryUsage::Of(_ElmtDimList)+MemoryUsage::Of(_ElmtMeshTypeList);
+    // the physical groups, the element/node id lists are the dominant part
+    bytes+=MemoryUsage::Of(_PhysicalGroupNameList)+MemoryUsage::Of(_PhysicalGroupIDList);
+    bytes+=MemoryUsage::Of(_PhysicalGroupDimList)+MemoryUsage::Of(_PhysicalGroupName2DimList);
+    bytes+=MemoryUsage::Of(_PhysicalGroupID2NameList)+MemoryUsage::Of(_PhysicalGroupName2IDList);
+    bytes+=MemoryUsage::Of(_PhysicalGroupName2NodesNumPerElmtList);
+    bytes+=MemoryUsage::Of(_PhysicalName2ElmtIDsList);
+    bytes+=MemoryUsage::Of(_NodeSetPhysicalGroupNameList)+MemoryUsage::Of(_NodeSetPhysicalGroupIDList);
+    bytes+=MemoryUsage::Of(_NodeSetPhysicalGroupID2NameList)+MemoryUsage::Of(_NodeSetPhysicalGroupName2IDList);
+    bytes+=MemoryUsage::Of(_NodeSetPhysicalName2NodeIDsList);
+    bytes+=MemoryUsage::Of(_PhysicalGroupNameIndex)+MemoryUsage::Of(_PhysicalID2NameIndex);
+    bytes+=MemoryUsage::Of(_PhysicalName2IDIndex)+MemoryUsage::Of(_PhysicalName2NodesNumPerElmtIndex);
+    bytes+=MemoryUsage::Of(_PhysicalName2ElmtIDsIndex)+MemoryUsage::Of(_NodeSetPhysicalName2NodeIDsIndex);
+    return bytes;
+}
@@ -0,0 +1,319 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.22
+//+++ Purpose: save/read the lagrange mesh to/from a compact binary
+//+++          file, which is used as the cache of the imported
+//+++          gmsh/abaqus mesh. The binary file is mapped into the
+//+++          memory (mmap) for the fast loading
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <cstring>
+
+#include "Mesh/LagrangeMesh.h"
+#include "Utils/MappedFile.h"
+
+static const char MeshCacheMagic[8]={'A','S','F','E','M','M','S','H'};
+static const int MeshCacheVersion=2;
+
+//***************************************************************
+//*** the sequential reader with the bound check on the mapped file
+//***************************************************************
+class MeshCacheReader{
+public:
+    MeshCacheReader(const char *data,const size_t &size):_Data(data),_Size(size){}
+    inline bool IsGood()const{return _IsGood;}
+
+    template<class T>
+    void Read(T &value){
+        ReadRaw(&value,sizeof(T));
+    }
+    template<class T>
+    void ReadVec(vector<T> &vec){
+        int n=-1;
+        Read(n);
+        if(!_IsGood||n<0){_IsGood=false;return;}
+        vec.resize(n);
+        if(n>0) ReadRaw(vec.data(),sizeof(T)*static_cast<size_t>(n));
+    }
+    void ReadStr(string &str){
+        int n=-1;
+        Read(n);
+        if(!_IsGood||n<0||_Pos+static_cast<size_t>(n)>_Size){_IsGood=false;return;}
+        str.assign(_Data+_Pos,n);
+        _Pos+=n;
+    }
+    void ReadStrVec(vector<string> &vec){
+        int n=-1;
+        Read(n);
+        if(!_IsGood||n<0){_IsGood=false;return;}
+        vec.resize(n);
+        for(auto &it:vec) ReadStr(it);
+    }
+private:
+    void ReadRaw(void *dest,const size_t &bytes){
+        if(!_IsGood||_Pos+bytes>_Size){_IsGood=false;return;}
+        memcpy(dest,_Data+_Pos,bytes);
+        _Pos+=bytes;
+    }
+private:
+    const char *_Data;
+    size_t _Size,_Pos=0;
+    bool _IsGood=true;
+};
+
+//***************************************************************
+//*** helper functions for the writing
+//***************************************************************
+template<class T>
+static void WriteValue(ofstream &out,const T &value){
+    out.write(reinterpret_cast<const char*>(&value),sizeof(T));
+}
+template<class T>
+static void WriteVec(ofstream &out,const vector<T> &vec){
+    int n=static_cast<int>(vec.size());
+    WriteValue(out,n);
+    if(n>0) out.write(reinterpret_cast<const char*>(vec.data()),sizeof(T)*vec.size());
+}
+static void WriteStr(ofstream &out,const string &str){
+    int n=static_cast<int>(str.size());
+    WriteValue(out,n);
+    out.write(str.c_str(),n);
+}
+static void WriteStrVec(ofstream &out,const vector<string> &vec){
+    int n=static_cast<int>(vec.size());
+    WriteValue(out,n);
+    for(const auto &it:vec) WriteStr(out,it);
+}
+// the pair list is stored as two separated arrays
+template<class T1,class T2>
+static void SplitPairList(const vector<pair<T1,T2>> &list,vector<T1> &first,vector<T2> &second){
+    first.resize(list.size());second.resize(list.size());
+    for(size_t i=0;i<list.size();i++){
+        first[i]=list[i].first;second[i]=list[i].second;
+    }
+}
+template<class T1,class T2>
+static void MergePairList(const vector<T1> &first,const vector<T2> &second,vector<pair<T1,T2>> &list){
+    list.resize(first.size());
+    for(size_t i=0;i<first.size();i++){
+        list[i]=make_pair(first[i],second[i]);
+    }
+}
+static void WriteStrIntPairList(ofstream &out,const vector<pair<string,int>> &list){
+    vector<string> names;vector<int> ids;
+    SplitPairList(list,names,ids);
+    WriteStrVec(out,names);WriteVec(out,ids);
+}
+static bool ReadStrIntPairList(MeshCacheReader &reader,vector<pair<string,int>> &list){
+    vector<string> names;vector<int> ids;
+    reader.ReadStrVec(names);reader.ReadVec(ids);
+    if(!reader.IsGood()||names.size()!=ids.size()) return false;
+    MergePairList(names,ids,list);
+    return true;
+}
+static void WriteIntStrPairList(ofstream &out,const vector<pair<int,string>> &list){
+    vector<int> ids;vector<string> names;
+    SplitPairList(list,ids,names);
+    WriteVec(out,ids);WriteStrVec(out,names);
+}
+static bool ReadIntStrPairList(MeshCacheReader &reader,vector<pair<int,string>> &list){
+    vector<int> ids;vector<string> names;
+    reader.ReadVec(ids);reader.ReadStrVec(names);
+    if(!reader.IsGood()||names.size()!=ids.size()) return false;
+    MergePairList(ids,names,list);
+    return true;
+}
+// the id list of each group is flattened with the offset array
+static void WriteStrIDsPairList(ofstream &out,const vector<pair<string,vector<int>>> &list){
+    vector<string> names(list.size());
+    vector<int> offset(list.size()+1,0),ids;
+    for(size_t i=0;i<list.size();i++){
+        names[i]=list[i].first;
+        offset[i+1]=offset[i]+static_cast<int>(list[i].second.size());
+        ids.insert(ids.end(),list[i].second.begin(),list[i].second.end());
+    }
+    WriteStrVec(out,names);WriteVec(out,offset);WriteVec(out,ids);
+}
+static bool ReadStrIDsPairList(MeshCacheReader &reader,vector<pair<string,vector<int>>> &list){
+    vector<string> names;
+    vector<int> offset,ids;
+    reader.ReadStrVec(names);reader.ReadVec(offset);reader.ReadVec(ids);
+    if(!reader.IsGood()||offset.size()!=names.size()+1) return false;
+    if(offset.back()!=static_cast<int>(ids.size())) return false;
+    list.resize(names.size());
+    for(size_t i=0;i<names.size();i++){
+        if(offset[i]>offset[i+1]) return false;
+        list[i].first=names[i];
+        list[i].second.assign(ids.begin()+offset[i],ids.begin()+offset[i+1]);
+    }
+    return true;
+}
+
+//***************************************************************
+uint64_t LagrangeMesh::GetFileContentHash(const string &filename){
+    // FNV-1a 64 bit hash, the size of the file is mixed in as well
+    MappedFile file(filename);
+    if(!file.IsOpen()) return 0;
+    uint64_t hash=14695981039346656037ULL;
+    const unsigned char *data=reinterpret_cast<const unsigned char*>(file.GetData());
+    for(size_t i=0;i<file.GetSize();i++){
+        hash^=data[i];
+        hash*=1099511628211ULL;
+    }
+    hash^=static_cast<uint64_t>(file.GetSize());
+    hash*=1099511628211ULL;
+    return hash;
+}
+//***************************************************************
+bool LagrangeMesh::SaveLagrangeMeshToBinaryFile(const string &filename,const uint64_t &srchash)const{
+    // the file is written to a temporary one first, then renamed, so that
+    // other processes never see an incomplete cache file
+    string tmpname=filename+".tmp";
+    ofstream out;
+    out.open(tmpname,ios::out|ios::binary);
+    if(!out.is_open()) return false;
+
+    out.write(MeshCacheMagic,8);
+    WriteValue(out,MeshCacheVersion);
+    WriteValue(out,srchash);
+
+    //*** for the basic information
+    int ints[14]={_nNodes,_nElmts,
+                  _nNodesPerBulkElmt,_nNodesPerSurfaceElmt,_nNodesPerLineElmt,
+                  _nBulkElmts,_nSurfaceElmts,_nLineElmts,
+                  _nMaxDim,_nMinDim,_Nx,_Ny,_Nz,_nOrder};
+    out.write(reinterpret_cast<const char*>(ints),sizeof(ints));
+    int types[4]={static_cast<int>(_BulkMeshType),static_cast<int>(_SurfaceMeshType),
+                  static_cast<int>(_LineMeshType),_BulkElmtVTKCellType};
+    out.write(reinterpret_cast<const char*>(types),sizeof(types));
+    double geo[7]={_Xmin,_Xmax,_Ymin,_Ymax,_Zmin,_Zmax,_TotalVolume};
+    out.write(reinterpret_cast<const char*>(geo),sizeof(geo));
+    WriteStr(out,_BulkMeshTypeName);
+
+    //*** for the nodes and elements, the connectivity is already flat
+    WriteVec(out,_NodeCoords);
+    WriteVec(out,_ElmtConnOffset);
+    WriteVec(out,_ElmtConn);
+    WriteVec(out,_ElmtVolume);
+    WriteVec(out,_ElmtVTKCellTypeList);
+    WriteVec(out,_ElmtPhyIDList);
+    WriteVec(out,_ElmtDimList);
+    vector<int> meshtypes(_ElmtMeshTypeList.size());
+    for(size_t e=0;e<_ElmtMeshTypeList.size();e++) meshtypes[e]=static_cast<int>(_ElmtMeshTypeList[e]);
+    WriteVec(out,meshtypes);
+
+    //*** for the physical groups
+    WriteValue(out,_nPhysicalGroups);
+    WriteStrVec(out,_PhysicalGroupNameList);
+    WriteVec(out,_PhysicalGroupIDList);
+    WriteVec(out,_PhysicalGroupDimList);
+    WriteStrIntPairList(out,_PhysicalGroupName2DimList);
+    WriteIntStrPairList(out,_PhysicalGroupID2NameList);
+    WriteStrIntPairList(out,_PhysicalGroupName2IDList);
+    WriteStrIntPairList(out,_PhysicalGroupName2NodesNumPerElmtList);
+    WriteStrIDsPairList(out,_PhysicalName2ElmtIDsList);
+
+    //*** for the node sets
+    WriteValue(out,_nNodeSetPhysicalGroups);
+    WriteStrVec(out,_NodeSetPhysicalGroupNameList);
+    WriteVec(out,_NodeSetPhysicalGroupIDList);
+    WriteIntStrPairList(out,_NodeSetPhysicalGroupID2NameList);
+    WriteStrIntPairList(out,_NodeSetPhysicalGroupName2IDList);
+    WriteStrIDsPairList(out,_NodeSetPhysicalName2NodeIDsList);
+
+    bool IsSuccess=out.good();
+    out.close();
+    if(!IsSuccess||rename(tmpname.c_str(),filename.c_str())!=0){
+        remove(tmpname.c_str());
+        return false;
+    }
+    return true;
+}
+//***************************************************************
+bool LagrangeMesh::ReadLagrangeMeshFromBinaryFile(const string &filename,const uint64_t &srchash){
+    MappedFile file(filename);
+    if(!file.IsOpen()) return false;
+
+    MeshCacheReader reader(file.GetData(),file.GetSize());
+    char magic[8];
+    int version;
+    uint64_t hash;
+    reader.Read(magic);
+    reader.Read(version);
+    reader.Read(hash);
+    if(!reader.IsGood()||memcmp(magic,MeshCacheMagic,8)!=0) return false;
+    // the cache is outdated if the source mesh file is changed
+    if(version!=MeshCacheVersion||hash!=srchash) return false;
+
+    //*** for the basic information
+    int ints[14],types[4];
+    double geo[7];
+    reader.Read(ints);
+    reader.Read(types);
+    reader.Read(geo);
+    reader.ReadStr(_BulkMeshTypeName);
+    if(!reader.IsGood()) return false;
+    _nNodes=ints[0];_nElmts=ints[1];
+    _nNodesPerBulkElmt=ints[2];_nNodesPerSurfaceElmt=ints[3];_nNodesPerLineElmt=ints[4];
+    _nBulkElmts=ints[5];_nSurfaceElmts=ints[6];_nLineElmts=ints[7];
+    _nMaxDim=ints[8];_nMinDim=ints[9];
+    _Nx=ints[10];_Ny=ints[11];_Nz=ints[12];_nOrder=ints[13];
+    _BulkMeshType=static_cast<MeshType>(types[0]);
+    _SurfaceMeshType=static_cast<MeshType>(types[1]);
+    _LineMeshType=static_cast<MeshType>(types[2]);
+    _BulkElmtVTKCellType=types[3];
+    _Xmin=geo[0];_Xmax=geo[1];_Ymin=geo[2];_Ymax=geo[3];_Zmin=geo[4];_Zmax=geo[5];
+    _TotalVolume=geo[6];
+
+    //*** for the nodes and elements
+    vector<int> meshtypes;
+    reader.ReadVec(_NodeCoords);
+    reader.ReadVec(_ElmtConnOffset);
+    reader.ReadVec(_ElmtConn);
+    reader.ReadVec(_ElmtVolume);
+    reader.ReadVec(_ElmtVTKCellTypeList);
+    reader.ReadVec(_ElmtPhyIDList);
+    reader.ReadVec(_ElmtDimList);
+    reader.ReadVec(meshtypes);
+    if(!reader.IsGood()) return false;
+    if(static_cast<int>(_NodeCoords.size())!=3*_nNodes) return false;
+    if(static_cast<int>(_ElmtConnOffset.size())!=_nElmts+1||_ElmtConnOffset[0]!=0) return false;
+    if(_ElmtConnOffset.back()!=static_cast<int>(_ElmtConn.size())) return false;
+    for(int e=0;e<_nElmts;e++){
+        if(_ElmtConnOffset[e]>_ElmtConnOffset[e+1]) return false;
+    }
+    UpdateBulkMeshElmtConnStride();
+    _ElmtMeshTypeList.resize(meshtypes.size());
+    for(size_t e=0;e<meshtypes.size();e++) _ElmtMeshTypeList[e]=static_cast<MeshType>(meshtypes[e]);
+
+    //*** for the physical groups
+    reader.Read(_nPhysicalGroups);
+    reader.ReadStrVec(_PhysicalGroupNameList);
+    reader.ReadVec(_PhysicalGroupIDList);
+    reader.ReadVec(_PhysicalGroupDimList);
+    if(!ReadStrIntPairList(reader,_PhysicalGroupName2DimList)) return false;
+    if(!ReadIntStrPairList(reader,_PhysicalGroupID2NameList)) return false;
+    if(!ReadStrIntPairList(reader,_PhysicalGroupName2IDList)) return false;
+    if(!ReadStrIntPairList(reader,_PhysicalGroupName2NodesNumPerElmtList)) return false;
+    if(!ReadStrIDsPairList(reader,_PhysicalName2ElmtIDsList)) return false;
+
+    //*** for the node sets
+    reader.Read(_nNodeSetPhysicalGroups);
+    reader.ReadStrVec(_NodeSetPhysicalGroupNameList);
+    reader.ReadVec(_NodeSetPhysicalGroupIDList);
+    if(!ReadIntStrPairList(reader,_NodeSetPhysicalGroupID2NameList)) return false;
+    if(!ReadStrIntPairList(reader,_NodeSetPhysicalGroupName2IDList)) return false;
+    if(!ReadStrIDsPairList(reader,_NodeSetPhysicalName2NodeIDsList)) return false;
+    if(!reader.IsGood()) return false;
+
+    UpdateBulkMeshPhysicalGroupIndex();
+    return true;
+}
@@ -31,7 +31,6 @@ bool AbaqusIO::ReadMeshFromFile(Mesh &mesh){
     //*** init all the mesh array and physical information
     //************************************************************
     mesh.GetBulkMeshNodeCoordsPtr().clear();
-    mesh.GetBulkMeshElmtConnPtr().clear();
     mesh.GetBulkMeshElmtVolumePtr().clear();
 
     mesh.GetBulkMeshElmtVTKCellTypeListPtr().clear();
@@ -141,7 +140,8 @@ bool AbaqusIO::ReadMeshFromFile(Mesh &mesh){
             mesh.SetBulkMeshMeshType(GetElmtMeshTypeFromInp());
             mesh.SetBulkMeshMeshTypeName(GetElmtMeshTypeNameFromInp());
             // allocate memory for connectivity and other array
-            mesh.GetBulkMeshElmtConnPtr().resize(_nElmts,vector<int>(0));
+            // no lower dimension element is used, all the elements have the same nodes number
+            mesh.AllocateBulkMeshElmtConn(nLowerDimElmts,0);
             mesh.GetBulkMeshElmtVTKCellTypeListPtr().resize(_nElmts,0);
             mesh.GetBulkMeshElmtPhyIDListPtr().resize(_nElmts,0);
             mesh.GetBulkMeshElmtMeshTypeListPtr().resize(_nElmts,MeshType::NULLTYPE);
@@ -163,10 +163,9 @@ bool AbaqusIO::ReadMeshFromFile(Mesh &mesh){
                 elmtid=static_cast<int>(numbers[0]);
                 bulkelmtid.push_back(elmtid);
 
-                mesh.GetBulkMeshElmtConnPtr()[elmtid-1].resize(_nNodesPerBulkElmt+1,0);
-                mesh.GetBulkMeshElmtConnPtr()[elmtid-1][0]=_nNodesPerBulkElmt;
+                Span<int> elConn=mesh.GetBulkMeshIthElmtNodeIDsPtr(elmtid);
                 for(int j=1;j<=_nNodesPerBulkElmt;j++){
-                    mesh.GetBulkMeshElmtConnPtr()[elmtid-1][j]=static_cast<int>(numbers[j]);
+                    elConn(j)=static_cast<int>(numbers[j]);
                 }
 
                 // set bulk elements' other properties
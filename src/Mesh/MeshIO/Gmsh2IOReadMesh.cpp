@@ -33,7 +33,6 @@ bool Gmsh2IO::ReadMeshFromFile(Mesh &mesh){
 
     //*** initialize
     mesh.GetBulkMeshNodeCoordsPtr().clear();
-    mesh.GetBulkMeshElmtConnPtr().clear();
     mesh.GetBulkMeshElmtVolumePtr().clear();
 
     mesh.GetBulkMeshElmtVTKCellTypeListPtr().clear();
@@ -177,7 +176,6 @@ bool Gmsh2IO::ReadMeshFromFile(Mesh &mesh){
             mesh.SetBulkMeshElmtsNum(_nElmts);
             mesh.GetBulkMeshElmtVolumePtr().resize(_nElmts,0.0);
             mesh.GetBulkMeshElmtDimListPtr().resize(_nElmts,0);
-            mesh.GetBulkMeshElmtConnPtr().resize(_nElmts,vector<int>(0));
             mesh.GetBulkMeshElmtVTKCellTypeListPtr().resize(_nElmts,0);
             mesh.GetBulkMeshElmtPhyIDListPtr().resize(_nElmts,0);
             mesh.GetBulkMeshElmtMeshTypeListPtr().resize(_nElmts,MeshType::NULLTYPE);
@@ -185,6 +183,8 @@ bool Gmsh2IO::ReadMeshFromFile(Mesh &mesh){
             int elmtid,phyid,geoid,ntags,elmttype,vtktype;
             int nodes,dim,maxdim,elmtorder;
             vector<int> tempconn;
+            // the connectivity is stored in the reading order first, then it is copied to the flat array of the mesh
+            vector<int> elmtnodesnum(_nElmts,0),elmtconnstart(_nElmts,0),elmtconnlist;
             MeshType meshtype,bcmeshtype;
             string meshtypename;
 
@@ -246,9 +246,6 @@ bool Gmsh2IO::ReadMeshFromFile(Mesh &mesh){
                 if(dim<_nMinDim) _nMinDim=dim;
                 if(phyid>MaxPhyIDofElmt) MaxPhyIDofElmt=phyid;
 
-                mesh.GetBulkMeshElmtConnPtr()[elmtid-1].resize(nodes+1,0);
-                mesh.GetBulkMeshElmtConnPtr()[elmtid-1][0]=nodes;
-
                 tempconn.resize(nodes,0);
                 for(int j=0;j<nodes;j++){
                     _in>>tempconn[j];
@@ -263,9 +260,9 @@ bool Gmsh2IO::ReadMeshFromFile(Mesh &mesh){
                     NodeSetPhyID2NodeIDsList[phyid].push_back(tempconn[0]);
                 }
 
-                for(int j=0;j<nodes;j++){
-                    mesh.GetBulkMeshElmtConnPtr()[elmtid-1][j+1]=tempconn[j];
-                }
+                elmtnodesnum[elmtid-1]=nodes;
+                elmtconnstart[elmtid-1]=static_cast<int>(elmtconnlist.size());
+                elmtconnlist.insert(elmtconnlist.end(),tempconn.begin(),tempconn.end());
 
                 mesh.GetBulkMeshElmtDimListPtr()[elmtid-1]=dim;
                 mesh.GetBulkMeshElmtMeshTypeListPtr()[elmtid-1]=meshtype;
@@ -309,6 +306,14 @@ bool Gmsh2IO::ReadMeshFromFile(Mesh &mesh){
                 mesh.SetBulkMeshBulkElmtsNum(nBulkElmts);
                 _nBulkElmts=nBulkElmts;
             }
+
+            mesh.AllocateBulkMeshElmtConn(elmtnodesnum);
+            for(int e=1;e<=_nElmts;e++){
+                Span<int> elConn=mesh.GetBulkMeshIthElmtNodeIDsPtr(e);
+                for(int j=0;j<elConn.size();j++){
+                    elConn[j]=elmtconnlist[elmtconnstart[e-1]+j];
+                }
+            }
             
         }//end-of-read-element-info
         
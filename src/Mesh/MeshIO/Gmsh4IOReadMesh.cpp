@@ -9,10 +9,213 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //+++ Author : Yang Bai
 //+++ Date   : 2020.06.26
-//+++ Purpose: implement the mesh import for msh(ver=2) file format
+//+++ Purpose: implement the mesh import for msh(ver=4) file format
+//+++          both the ascii(file-type=0) and the binary
+//+++          (file-type=1) files are supported. The whole file
+//+++          is mapped into the memory and parsed in place, no
+//+++          string is created for each line
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+#include <charconv>
+#include <cstring>
+#include <cstdlib>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+
 #include "Mesh/Gmsh4IO.h"
+#include "Utils/MappedFile.h"
+
+//***************************************************************
+//*** the sequential reader of the msh4 file, the numbers are
+//*** parsed directly from the mapped buffer, for the binary file
+//*** the raw data is copied with the endianness handled
+//***************************************************************
+class Gmsh4Reader{
+public:
+    Gmsh4Reader(const char *data,const size_t &size):_Data(data),_Size(size){}
+    inline bool IsGood()const{return _IsGood;}
+    inline bool IsBinary()const{return _IsBinary;}
+    /**
+     * switch to the binary mode, the data-size is the size of the 'size_t' in the file
+     */
+    inline void SetBinaryMode(const bool &isswap,const int &datasize){
+        _IsBinary=true;_IsSwap=isswap;_DataSize=datasize;
+    }
+    /**
+     * move to the beginning of the next line
+     */
+    void SkipLine(){
+        while(_Pos<_Size&&_Data[_Pos]!='\n') _Pos++;
+        if(_Pos<_Size) _Pos++;
+    }
+    /**
+     * find the next section header(i.e. '$Nodes'), the name without '$' is returned, false for the end of file
+     */
+    bool NextSection(string_view &name){
+        size_t start,end;
+        while(_Pos<_Size){
+            if(_Data[_Pos]=='$'){
+                start=_Pos+1;
+                SkipLine();
+                end=_Pos;
+                while(end>start&&(_Data[end-1]=='\n'||_Data[end-1]=='\r'||_Data[end-1]==' ')) end--;
+                name=string_view(_Data+start,end-start);
+                return true;
+            }
+            SkipLine();
+        }
+        return false;
+    }
+    /**
+     * skip the whole section until '$Endxxx', it is used for the unsupported sections
+     */
+    void SkipSection(const string_view &name){
+        string endname="$End"+string(name);
+        while(_Pos<_Size){
+            if(_Size-_Pos>=endname.size()&&memcmp(_Data+_Pos,endname.c_str(),endname.size())==0){
+                SkipLine();
+                return;
+            }
+            SkipLine();
+        }
+    }
+
+    //*** the ascii readers, the physical names and the format line are always in ascii
+    long long ReadAsciiInt(){
+        long long value=0;
+        SkipSpace();
+        auto res=from_chars(_Data+_Pos,_Data+_Size,value);
+        if(res.ec!=errc()){_IsGood=false;return 0;}
+        _Pos=static_cast<size_t>(res.ptr-_Data);
+        return value;
+    }
+    double ReadAsciiDouble(){
+        double value=0.0;
+        SkipSpace();
+#if defined(__cpp_lib_to_chars)
+        auto res=from_chars(_Data+_Pos,_Data+_Size,value);
+        if(res.ec!=errc()){_IsGood=false;return 0.0;}
+        _Pos=static_cast<size_t>(res.ptr-_Data);
+#else
+        // the floating point from_chars is not available, the token is copied to a small buffer for strtod
+        char buff[64];
+        size_t n=0;
+        while(_Pos+n<_Size&&n<63&&!IsSpace(_Data[_Pos+n])){buff[n]=_Data[_Pos+n];n++;}
+        buff[n]='\0';
+        char *end=nullptr;
+        value=strtod(buff,&end);
+        if(end==buff){_IsGood=false;return 0.0;}
+        _Pos+=static_cast<size_t>(end-buff);
+#endif
+        return value;
+    }
+    /**
+     * read the physical name, the '"' is removed, the space inside the quotes is kept
+     */
+    string ReadAsciiName(){
+        size_t start;
+        SkipSpace();
+        if(_Pos<_Size&&_Data[_Pos]=='"'){
+            start=++_Pos;
+            while(_Pos<_Size&&_Data[_Pos]!='"'&&_Data[_Pos]!='\n') _Pos++;
+            string name(_Data+start,_Pos-start);
+            if(_Pos<_Size&&_Data[_Pos]=='"') _Pos++;
+            return name;
+        }
+        start=_Pos;
+        while(_Pos<_Size&&!IsSpace(_Data[_Pos])) _Pos++;
+        return string(_Data+start,_Pos-start);
+    }
+    /**
+     * read the raw 4-byte integer of the binary file, it is used to detect the endianness
+     */
+    int ReadRawInt(){
+        int value=0;
+        if(_Pos+sizeof(int)>_Size){_IsGood=false;return 0;}
+        memcpy(&value,_Data+_Pos,sizeof(int));
+        _Pos+=sizeof(int);
+        return value;
+    }
+
+    //*** the readers for the data blocks, they work for both ascii and binary files
+    int ReadInt(){
+        if(_IsBinary) return ReadBinary<int32_t>();
+        return static_cast<int>(ReadAsciiInt());
+    }
+    long long ReadSize(){
+        if(_IsBinary){
+            if(_DataSize==8) return static_cast<long long>(ReadBinary<uint64_t>());
+            return static_cast<long long>(ReadBinary<uint32_t>());
+        }
+        return ReadAsciiInt();
+    }
+    double ReadDouble(){
+        if(_IsBinary) return ReadBinary<double>();
+        return ReadAsciiDouble();
+    }
+    /**
+     * read n 'size_t' values, for the binary file the whole block is copied once
+     */
+    void ReadSizeArray(const size_t &n,vector<long long> &values){
+        values.resize(n);
+        if(_IsBinary&&_DataSize==8&&!_IsSwap){
+            if(_Pos+n*8>_Size){_IsGood=false;return;}
+            static_assert(sizeof(long long)==8,"long long must be 8 bytes");
+            memcpy(values.data(),_Data+_Pos,n*8);
+            _Pos+=n*8;
+            return;
+        }
+        for(size_t i=0;i<n;i++) values[i]=ReadSize();
+    }
+    /**
+     * read n double values, for the binary file the whole block is copied once
+     */
+    void ReadDoubleArray(const size_t &n,vector<double> &values){
+        values.resize(n);
+        if(_IsBinary&&!_IsSwap){
+            if(_Pos+n*sizeof(double)>_Size){_IsGood=false;return;}
+            memcpy(values.data(),_Data+_Pos,n*sizeof(double));
+            _Pos+=n*sizeof(double);
+            return;
+        }
+        for(size_t i=0;i<n;i++) values[i]=ReadDouble();
+    }
+
+private:
+    static inline bool IsSpace(const char &c){return c==' '||c=='\t'||c=='\n'||c=='\r';}
+    inline void SkipSpace(){
+        while(_Pos<_Size&&IsSpace(_Data[_Pos])) _Pos++;
+    }
+    template<class T>
+    T ReadBinary(){
+        T value{};
+        if(_Pos+sizeof(T)>_Size){_IsGood=false;return value;}
+        memcpy(&value,_Data+_Pos,sizeof(T));
+        _Pos+=sizeof(T);
+        if(_IsSwap){
+            char *bytes=reinterpret_cast<char*>(&value);
+            for(size_t i=0;i<sizeof(T)/2;i++) swap(bytes[i],bytes[sizeof(T)-1-i]);
+        }
+        return value;
+    }
+private:
+    const char *_Data;
+    size_t _Size,_Pos=0;
+    bool _IsGood=true;
+    bool _IsBinary=false,_IsSwap=false;
+    int _DataSize=8;
+};
+
+//***************************************************************
+//*** store the physical id of the entity, the entity tag may be
+//*** larger than the number of the entities
+//***************************************************************
+static void SetEntityPhyID(vector<int> &entityphyids,const int &tag,const int &phyid){
+    if(tag<1) return;
+    if(tag>static_cast<int>(entityphyids.size())) entityphyids.resize(tag,0);
+    entityphyids[tag-1]=phyid;
+}
 
 bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
     if(!_HasSetMeshFileName){
@@ -20,22 +223,21 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
         return false;
     }
     string str;
-    _in.open(_MeshFileName.c_str(),ios::in);
-    if(!_in.is_open()){
+    MappedFile file(_MeshFileName);
+    if(!file.IsOpen()){
         str="can\'t read the .msh file(="+_MeshFileName+"), please make sure your mesh file name is correct";
         MessagePrinter::PrintErrorTxt(str);
         MessagePrinter::AsFem_Exit();
     }
+    Gmsh4Reader reader(file.GetData(),file.GetSize());
 
     double version;
     int format,size;
-    vector<double> numbers;
 
     //******************************************************
     //*** initialize all the arraies
     //******************************************************
     mesh.GetBulkMeshNodeCoordsPtr().clear();
-    mesh.GetBulkMeshElmtConnPtr().clear();
     mesh.GetBulkMeshElmtVolumePtr().clear();
 
     mesh.GetBulkMeshElmtVTKCellTypeListPtr().clear();
@@ -75,15 +277,19 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
 
     vector<double> NodeCoords;
     vector<int>    NodeIDFlag;//used to remove the discontinue node id
-    vector<vector<int>> ElmtConn;
+    // the elements are stored in the reading order(flat array), ElmtIDFlag maps the element tag to it
+    vector<int> ElmtConnOffset,ElmtConn;
     vector<int> ElmtDimVec,ElmtPhyIDVec,ElmtIDFlag,ElmtVTKCellType;
     vector<MeshType> ElmtTypeVec;
+    vector<long long> tags;
+    vector<double> coords;
     int nNodes,nElmts;
     int numEntityBlocks,numNodes,minNodeTag,maxNodeTag;
     int numElements,minElementTag,maxElementTag;
 
     numEntityBlocks=numNodes=minNodeTag=maxNodeTag=0;
     numElements=minElementTag=maxElementTag=0;
+    nNodes=nElmts=0;
 
     NodeCoords.clear();ElmtConn.clear();
     _PointsEntityPhyIDs.clear();
@@ -95,23 +301,47 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
     _Ymax=-1.0e16;_Ymin=1.0e16;
     _Zmax=-1.0e16;_Zmin=1.0e16;
 
-    map<int,vector<int>> NodeSetPhyID2NodeIDsList;
+    unordered_map<int,vector<int>> NodeSetPhyID2NodeIDsList;
+    string_view section;
     //*****************************************************
     //*** start to read mesh file
     //*****************************************************
-    while(!_in.eof()){
-        // now we start to read *.msh file
-        getline(_in,str);
-        if(str.find("$MeshFormat")!=string::npos) {
-            _in >> version >> format >> size;
+    while(reader.NextSection(section)){
+        if(section=="MeshFormat") {
+            version=reader.ReadAsciiDouble();
+            format=static_cast<int>(reader.ReadAsciiInt());
+            size=static_cast<int>(reader.ReadAsciiInt());
             if ((version != 4.0) && (version != 4.1) && (version != 4.2)) {
                 // currently, only the gmsh2 format is supported!!!
                 str = "version=" + to_string(version) + " is not supported yet";
                 MessagePrinter::PrintErrorTxt(str);
                 return false;
             }
+            if(format==1){
+                // for binary file, an integer 1 is written after the format line to detect the endianness
+                if(version!=4.1){
+                    MessagePrinter::PrintErrorTxt("only the msh4.1 binary file is supported, please export your mesh with 'Version 4.1'");
+                    return false;
+                }
+                if(size!=4&&size!=8){
+                    MessagePrinter::PrintErrorTxt("invalid data-size(="+to_string(size)+") in the $MeshFormat block of your msh4 file");
+                    return false;
+                }
+                reader.SkipLine();
+                int one=reader.ReadRawInt();
+                if(one==1){
+                    reader.SetBinaryMode(false,size);
+                }
+                else if(one==(1<<24)){
+                    reader.SetBinaryMode(true,size);
+                }
+                else{
+                    MessagePrinter::PrintErrorTxt("can\'t detect the endianness of your binary msh4 file");
+                    return false;
+                }
+            }
         }
-        else if(str.find("$PhysicalNames")!=string::npos) {
+        else if(section=="PhysicalNames") {
             _nPhysicGroups = 0;
             mesh.GetBulkMeshPhysicalGroupNameListPtr().clear();
             mesh.GetBulkMeshPhysicalGroupIDListPtr().clear();
@@ -133,14 +363,12 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
 
             int phydim, phyid;
             string phyname;
-            _in >> _nPhysicGroups;
-            getline(_in, str);//remove \n in this line
+            // the physical names are always written in ascii, even for the binary file
+            _nPhysicGroups=static_cast<int>(reader.ReadAsciiInt());
             for (int i = 0; i < _nPhysicGroups; i++) {
-                getline(_in, str);
-                istringstream s_stream(str);
-                s_stream >> phydim >> phyid >> phyname;
-                // remove the '"' ,keep only the text
-                phyname.erase(std::remove(phyname.begin(), phyname.end(), '"'), phyname.end());
+                phydim=static_cast<int>(reader.ReadAsciiInt());
+                phyid=static_cast<int>(reader.ReadAsciiInt());
+                phyname=reader.ReadAsciiName();
                 mesh.GetBulkMeshPhysicalGroupNameListPtr().push_back(phyname);
                 mesh.GetBulkMeshPhysicalGroupIDListPtr().push_back(phyid);
                 mesh.GetBulkMeshPhysicalGroupDimListPtr().push_back(phydim);
@@ -164,118 +392,104 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
             }
             mesh.SetBulkMeshNodeSetPhysicalGroupNums(_nNodeSetPhysicalGroups);
         } // end-of-physical group information
-        else if(str.find("$Entities")!=string::npos){
+        else if(section=="Entities"){
             // read the entities block
-            getline(_in,str);
-            numbers=StringUtils::SplitStrNum(str);
-            int numPoints,numCurves,numSurfaces,numVolumes;
-            if(numbers.size()!=4){
+            long long numPoints,numCurves,numSurfaces,numVolumes;
+            numPoints=reader.ReadSize();
+            numCurves=reader.ReadSize();
+            numSurfaces=reader.ReadSize();
+            numVolumes=reader.ReadSize();
+            if(!reader.IsGood()||numPoints<0||numCurves<0||numSurfaces<0||numVolumes<0){
                 MessagePrinter::PrintErrorTxt("invalid entity block information in your msh4 file inside the $Entities");
                 MessagePrinter::AsFem_Exit();
             }
-            numPoints=static_cast<int>(numbers[1-1]);
-            numCurves=static_cast<int>(numbers[2-1]);
-            numSurfaces=static_cast<int>(numbers[3-1]);
-            numVolumes=static_cast<int>(numbers[4-1]);
 
-            // factor=10 to avoid the unordered entitie index(especially the nodal entities)
-            _PointsEntityPhyIDs.resize(numPoints*10,0);
-            _CurvesEntityPhyIDS.resize(numCurves*10,0);
-            _SurfaceEntityPhyIDs.resize(numSurfaces*10,0);
-            _VolumesEntityPhyIDs.resize(numVolumes*10,0);
+            // the entity tag is normally not larger than the entities number, otherwise the array will be extended
+            _PointsEntityPhyIDs.assign(numPoints,0);
+            _CurvesEntityPhyIDS.assign(numCurves,0);
+            _SurfaceEntityPhyIDs.assign(numSurfaces,0);
+            _VolumesEntityPhyIDs.assign(numVolumes,0);
 
-            int i,j;
-            int nodeid,curveid,surfaceid,volumeid;
+            long long i,j,nPhyTags,nBoundTags;
+            int tag,phyid;
 
             //********************************************
             //*** read points entities
+            //*** pointTag X Y Z numPhysicalTags physicalTag ...
             for(i=0;i<numPoints;i++){
-                getline(_in,str);
-                numbers=StringUtils::SplitStrNum(str);
-                nodeid=static_cast<int>(numbers[1-1]);
-                if(static_cast<int>(numbers[5-1])>0){
-                    _PointsEntityPhyIDs[nodeid-1]=static_cast<int>(numbers[6-1]);
-                }
-            }
-            //*** read curvess entities
-            for(i=0;i<numCurves;i++){
-                getline(_in,str);
-                numbers=StringUtils::SplitStrNum(str);
-                curveid=static_cast<int>(numbers[1-1]);
-                j=static_cast<int>(numbers[8-1]);
-                if(j>0){
-                    _CurvesEntityPhyIDS[curveid-1]=static_cast<int>(numbers[8+j-1]);
+                tag=reader.ReadInt();
+                for(j=0;j<3;j++) reader.ReadDouble();
+                nPhyTags=reader.ReadSize();
+                for(j=0;j<nPhyTags;j++){
+                    phyid=reader.ReadInt();
+                    // the first physical tag is used for the point
+                    if(j==0) SetEntityPhyID(_PointsEntityPhyIDs,tag,phyid);
                 }
             }
-            //*** read surfaces entities
-            for(i=0;i<numSurfaces;i++){
-                getline(_in,str);
-                numbers=StringUtils::SplitStrNum(str);
-                surfaceid=static_cast<int>(numbers[1-1]);
-                j=static_cast<int>(numbers[8-1]);
-                if(j>0){
-                    _SurfaceEntityPhyIDs[surfaceid-1]=static_cast<int>(numbers[8+j-1]);
+            //*** read curves/surfaces/volumes entities
+            //*** tag minX minY minZ maxX maxY maxZ numPhysicalTags physicalTag ... numBoundingXXX tag ...
+            vector<int>* entityphyids[3]={&_CurvesEntityPhyIDS,&_SurfaceEntityPhyIDs,&_VolumesEntityPhyIDs};
+            long long numEntities[3]={numCurves,numSurfaces,numVolumes};
+            for(int dim=0;dim<3;dim++){
+                for(i=0;i<numEntities[dim];i++){
+                    tag=reader.ReadInt();
+                    for(j=0;j<6;j++) reader.ReadDouble();
+                    nPhyTags=reader.ReadSize();
+                    for(j=0;j<nPhyTags;j++){
+                        phyid=reader.ReadInt();
+                        // the last physical tag is used for the curve/surface/volume
+                        if(j==nPhyTags-1) SetEntityPhyID(*entityphyids[dim],tag,phyid);
+                    }
+                    nBoundTags=reader.ReadSize();
+                    for(j=0;j<nBoundTags;j++) reader.ReadInt();
                 }
             }
-            //*** read volumes entities
-            for(i=0;i<numVolumes;i++){
-                getline(_in,str);
-                numbers=StringUtils::SplitStrNum(str);
-                volumeid=static_cast<int>(numbers[1-1]);
-                j=static_cast<int>(numbers[8-1]);
-                if(j>0){
-                    _VolumesEntityPhyIDs[volumeid-1]=static_cast<int>(numbers[8+j-1]);
-                }
+            if(!reader.IsGood()){
+                MessagePrinter::PrintErrorTxt("invalid entities information in your msh4 file inside the $Entities block");
+                MessagePrinter::AsFem_Exit();
             }
         }
-        else if(str.find("$Nodes")!=string::npos){
+        else if(section=="Nodes"){
             // start to read node coordinates
-            getline(_in,str); // read the entities
-            numbers=StringUtils::SplitStrNum(str);
-            if(numbers.size()!=4){
+            // numEntityBlocks(size_t) numNodes(size_t) minNodeTag(size_t) maxNodeTag(size_t)
+            numEntityBlocks=static_cast<int>(reader.ReadSize());
+            numNodes=static_cast<int>(reader.ReadSize());mesh.SetBulkMeshNodesNum(numNodes);
+            minNodeTag=static_cast<int>(reader.ReadSize());
+            maxNodeTag=static_cast<int>(reader.ReadSize());
+            if(!reader.IsGood()||numEntityBlocks<0||numNodes<0||maxNodeTag<0){
                 MessagePrinter::PrintErrorTxt("invalid entities information in $Nodes block of your msh4 file");
                 MessagePrinter::AsFem_Exit();
             }
-            numEntityBlocks=static_cast<int>(numbers[1-1]);
-            numNodes=static_cast<int>(numbers[2-1]);mesh.SetBulkMeshNodesNum(numNodes);
-            minNodeTag=static_cast<int>(numbers[3-1]);
-            maxNodeTag=static_cast<int>(numbers[4-1]);
             NodeCoords.resize(3*maxNodeTag,0.0);// here the node id may not be contineous case !!!
             NodeIDFlag.resize(maxNodeTag,0);
-            vector<int> nodeid;
             double x,y,z;
-            int i,j,numNodesInBlock;
+            int i,j,entityDim,parametric,numNodesInBlock,stride;
             nNodes=0;
             for(int nBlock=0;nBlock<numEntityBlocks;nBlock++){
-                nodeid.clear();
                 // entityDim(int) entityTag(int) parametric(int; 0 or 1) numNodesInBlock(size_t)
-                getline(_in,str);
-                numbers=StringUtils::SplitStrNum(str);
-                if(numbers.size()!=4){
+                entityDim=reader.ReadInt();
+                reader.ReadInt();
+                parametric=reader.ReadInt();
+                numNodesInBlock=static_cast<int>(reader.ReadSize());
+                if(!reader.IsGood()||numNodesInBlock<0){
                     MessagePrinter::PrintErrorTxt("invalid node entities in your msh4 file inside the $Nodes block");
                     MessagePrinter::AsFem_Exit();
                 }
-                numNodesInBlock=static_cast<int>(numbers[4-1]);
-                for(i=0;i<numNodesInBlock;i++){
-                    getline(_in,str); // read the node id
-                    numbers=StringUtils::SplitStrNum(str);
-                    if(static_cast<int>(numbers[0])<minNodeTag||static_cast<int>(numbers[0])>maxNodeTag){
-                        MessagePrinter::PrintErrorTxt("invalid node Tag in your msh4 file inside the $Nodes");
-                        MessagePrinter::AsFem_Exit();
-                    }
-                    else{
-                        nodeid.push_back(static_cast<int>(numbers[0]));// store the node id
-                    }
+                // the node tags of the whole block, then the coordinates(and the parametric coordinates)
+                reader.ReadSizeArray(numNodesInBlock,tags);
+                stride=3+(parametric==1?entityDim:0);
+                reader.ReadDoubleArray(static_cast<size_t>(numNodesInBlock)*stride,coords);
+                if(!reader.IsGood()){
+                    MessagePrinter::PrintErrorTxt("invalid node coordinates information in your msh4 file inside the $Nodes block");
+                    MessagePrinter::AsFem_Exit();
                 }
                 for(i=0;i<numNodesInBlock;i++){
-                    getline(_in,str);
-                    numbers=StringUtils::SplitStrNum(str);
-                    if(numbers.size()!=3){
-                        MessagePrinter::PrintErrorTxt("invalid node coordinates information in your msh4 file inside the $Nodes block");
+                    j=static_cast<int>(tags[i]);
+                    if(j<minNodeTag||j>maxNodeTag){
+                        MessagePrinter::PrintErrorTxt("invalid node Tag in your msh4 file inside the $Nodes");
                         MessagePrinter::AsFem_Exit();
                     }
-                    x=numbers[0];y=numbers[1];z=numbers[2];
-                    j=nodeid[i];
+                    x=coords[i*stride+0];y=coords[i*stride+1];z=coords[i*stride+2];
                     NodeCoords[(j-1)*3+0]=x;
                     NodeCoords[(j-1)*3+1]=y;
                     NodeCoords[(j-1)*3+2]=z;
@@ -295,19 +509,17 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
                 MessagePrinter::AsFem_Exit();
             }
         }// end-of-nodes-read
-        else if(str.find("$Elements")!=string::npos){
+        else if(section=="Elements"){
             // read the element information
-            getline(_in,str);// read the element total entities
-            numbers=StringUtils::SplitStrNum(str);
-            if(numbers.size()!=4){
-                //numEntityBlocks(size_t) numElements(size_t) minElementTag(size_t) maxElementTag(size_t)
+            //numEntityBlocks(size_t) numElements(size_t) minElementTag(size_t) maxElementTag(size_t)
+            numEntityBlocks=static_cast<int>(reader.ReadSize());
+            numElements=static_cast<int>(reader.ReadSize());
+            minElementTag=static_cast<int>(reader.ReadSize());
+            maxElementTag=static_cast<int>(reader.ReadSize());
+            if(!reader.IsGood()||numEntityBlocks<0||numElements<0||maxElementTag<0){
                 MessagePrinter::PrintErrorTxt("invalid element entities in your msh4 file inside the $Elements");
                 MessagePrinter::AsFem_Exit();
             }
-            numEntityBlocks=static_cast<int>(numbers[1-1]);
-            numElements=static_cast<int>(numbers[2-1]);
-            minElementTag=static_cast<int>(numbers[3-1]);
-            maxElementTag=static_cast<int>(numbers[4-1]);
 
             nElmts=0;
             _nPointElmts=0;
@@ -319,12 +531,13 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
             _nNodesPerBulkElmt=0;
 
             // here we use the maxElementTag, since the id of elements could be discontineous !!!
-            ElmtConn.resize(maxElementTag,vector<int>(0));
-            ElmtDimVec.resize(maxElementTag,0);
-            ElmtPhyIDVec.resize(maxElementTag,0);
-            ElmtTypeVec.resize(maxElementTag,MeshType::NULLTYPE);
-            ElmtIDFlag.resize(maxElementTag,0);
-            ElmtVTKCellType.resize(maxElementTag,0);
+            ElmtIDFlag.assign(maxElementTag,0);
+            ElmtConnOffset.assign(1,0);
+            ElmtConnOffset.reserve(numElements+1);
+            ElmtDimVec.reserve(numElements);
+            ElmtPhyIDVec.reserve(numElements);
+            ElmtTypeVec.reserve(numElements);
+            ElmtVTKCellType.reserve(numElements);
 
             mesh.SetBulkMeshElmtsNum(numElements);
 
@@ -335,17 +548,20 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
             order=0;
 
             for(int nBlocks=0;nBlocks<numEntityBlocks;nBlocks++){
-                getline(_in,str);//get current element entities
                 //entityDim(int) entityTag(int) elementType(int; see below) numElementsInBlock(size_t)
-                numbers=StringUtils::SplitStrNum(str);
-                if(numbers.size()!=4){
+                entityDim=reader.ReadInt();
+                entityTag=reader.ReadInt();
+                elementType=reader.ReadInt();
+                numElementsInBlock=static_cast<int>(reader.ReadSize());
+                if(!reader.IsGood()||numElementsInBlock<0){
                     MessagePrinter::PrintErrorTxt("invalid element entities for current element in your msh4 file inside the $Elements");
                     MessagePrinter::AsFem_Exit();
                 }
-                entityDim=static_cast<int>(numbers[1-1]);
-                entityTag=static_cast<int>(numbers[2-1]);
-                elementType=static_cast<int>(numbers[3-1]);
-                numElementsInBlock=static_cast<int>(numbers[4-1]);
+                nodesnum=GetElmtNodesNumFromGmshElmtType(elementType);
+                if(nodesnum<1){
+                    MessagePrinter::PrintErrorTxt("unsupported element type(="+to_string(elementType)+") in your msh4 file inside the $Elements");
+                    MessagePrinter::AsFem_Exit();
+                }
                 phyid=GetPhysicalIDViaEntityTag(entityDim,entityTag);
                 vtktype=GetElmtVTKCellTypeFromGmshElmtType(elementType);
                 meshtype=GetElmtMeshTypeFromGmshElmtType(elementType);
@@ -376,15 +592,15 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
                 }
                 if(entityDim==1){
                     _nLineElmts+=numElementsInBlock;
-                    _nNodesPerLineElmt=GetElmtNodesNumFromGmshElmtType(elementType);
+                    _nNodesPerLineElmt=nodesnum;
                 }
                 if(entityDim==2){
                     _nSurfaceElmts+=numElementsInBlock;
-                    _nNodesPerSurfaceElmt=GetElmtNodesNumFromGmshElmtType(elementType);
+                    _nNodesPerSurfaceElmt=nodesnum;
                 }
                 if(entityDim==3){
                     _nBulkElmts+=numElementsInBlock;
-                    _nNodesPerBulkElmt=GetElmtNodesNumFromGmshElmtType(elementType);
+                    _nNodesPerBulkElmt=nodesnum;
                 }
 
                 if(entityDim>_nMaxDim) _nMaxDim=entityDim;
@@ -392,35 +608,40 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
 
                 if(phyid>MaxPhyIDofElmt) MaxPhyIDofElmt=phyid;
 
+                // elementTag(size_t) nodeTag(size_t) ... for each element, the whole block is read once
+                reader.ReadSizeArray(static_cast<size_t>(numElementsInBlock)*(1+nodesnum),tags);
+                if(!reader.IsGood()){
+                    MessagePrinter::PrintErrorTxt("invalid element connectivity in your msh4 file inside the $Elements");
+                    MessagePrinter::AsFem_Exit();
+                }
                 for(i=0;i<numElementsInBlock;i++){
-                    getline(_in,str);
-                    numbers=StringUtils::SplitStrNum(str);
-                    nodesnum=static_cast<int>(numbers.size()-1);
-                    elmtid=static_cast<int>(numbers[1-1]);
+                    const long long *elmtdata=tags.data()+static_cast<size_t>(i)*(1+nodesnum);
+                    elmtid=static_cast<int>(elmtdata[0]);
                     if(elmtid<minElementTag||elmtid>maxElementTag){
                         MessagePrinter::PrintErrorTxt("invalid element Tag in your msh4 file inside the $Elements");
                         MessagePrinter::AsFem_Exit();
                     }
-                    ElmtConn[elmtid-1].clear();
-                    ElmtConn[elmtid-1].resize(1+nodesnum);
-                    ElmtConn[elmtid-1][0]=nodesnum;
-
-                    ElmtDimVec[elmtid-1]=entityDim;
-                    ElmtPhyIDVec[elmtid-1]=phyid;
-                    ElmtVTKCellType[elmtid-1]=vtktype;
-                    ElmtTypeVec[elmtid-1]=meshtype;
-                    ElmtIDFlag[elmtid-1]=1;
+                    if(ElmtIDFlag[elmtid-1]>0){
+                        MessagePrinter::PrintErrorTxt("duplicated element Tag(="+to_string(elmtid)+") in your msh4 file inside the $Elements");
+                        MessagePrinter::AsFem_Exit();
+                    }
+                    ElmtDimVec.push_back(entityDim);
+                    ElmtPhyIDVec.push_back(phyid);
+                    ElmtVTKCellType.push_back(vtktype);
+                    ElmtTypeVec.push_back(meshtype);
                     for(j=1;j<=nodesnum;j++){
-                        ElmtConn[elmtid-1][j]=static_cast<int>(numbers[j]);
+                        ElmtConn.push_back(static_cast<int>(elmtdata[j]));
                     }
+                    ElmtConnOffset.push_back(static_cast<int>(ElmtConn.size()));
                     nElmts+=1;
+                    ElmtIDFlag[elmtid-1]=nElmts;// the reading index(start from 1)
                     if(entityDim==0){
                         // for node set
                         if(nodesnum!=1){
-                            MessagePrinter::PrintErrorTxt("invalid node set(element) in your msh2 file, the connectivity array should only contain 1 element(node id)");
+                            MessagePrinter::PrintErrorTxt("invalid node set(element) in your msh4 file, the connectivity array should only contain 1 element(node id)");
                             MessagePrinter::AsFem_Exit();
                         }
-                        NodeSetPhyID2NodeIDsList[phyid].push_back(static_cast<int>(numbers[1]));
+                        NodeSetPhyID2NodeIDsList[phyid].push_back(static_cast<int>(elmtdata[1]));
                     }
                 }// end-of-local-element-connectivity
             }// end-of-element-entity-block
@@ -452,8 +673,12 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
             }
 
         }// end-of-element-reading
+        else if(section.substr(0,3)!="End"){
+            // the other sections(i.e. $Periodic, $NodeData) are not used, the whole section is skipped
+            reader.SkipSection(section);
+        }
 
-    } // end-of-ifstream-read
+    } // end-of-file-read
 
     //**********************************************************************************
     //*** now we re-arrange the node id and element id, to make them to be continue
@@ -482,22 +707,34 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
     mesh.SetBulkMeshElmtsNum(_nElmts);
     mesh.GetBulkMeshElmtVolumePtr().resize(_nElmts,0.0);
     mesh.GetBulkMeshElmtDimListPtr().resize(_nElmts,0);
-    mesh.GetBulkMeshElmtConnPtr().resize(_nElmts,vector<int>(0));
     mesh.GetBulkMeshElmtVTKCellTypeListPtr().resize(_nElmts,0);
     mesh.GetBulkMeshElmtPhyIDListPtr().resize(_nElmts,0);
     mesh.GetBulkMeshElmtMeshTypeListPtr().resize(_nElmts,MeshType::NULLTYPE);
+    // the elements are sorted by their tags, ElmtIDFlag gives the reading index of each tag
+    vector<int> elmtnodesnum;
+    elmtnodesnum.reserve(_nElmts);
+    for(int e=0;e<maxElementTag;e++){
+        if(ElmtIDFlag[e]>0) elmtnodesnum.push_back(ElmtConnOffset[ElmtIDFlag[e]]-ElmtConnOffset[ElmtIDFlag[e]-1]);
+    }
+    mesh.AllocateBulkMeshElmtConn(elmtnodesnum);
+    int ie;
     for(int e=0;e<maxElementTag;e++){
         if(ElmtIDFlag[e]>0){
             count+=1;
+            ie=ElmtIDFlag[e]-1;
             ElmtIDFlag[e]=count;// the active element id
-            mesh.GetBulkMeshElmtDimListPtr()[count-1]=ElmtDimVec[e];
-            mesh.GetBulkMeshElmtVTKCellTypeListPtr()[count-1]=ElmtVTKCellType[e];
-            mesh.GetBulkMeshElmtPhyIDListPtr()[count-1]=ElmtPhyIDVec[e];
-            mesh.GetBulkMeshElmtMeshTypeListPtr()[count-1]=ElmtTypeVec[e];
-            mesh.GetBulkMeshElmtConnPtr()[count-1].resize(ElmtConn[e][0]+1);
-            mesh.GetBulkMeshElmtConnPtr()[count-1][0]=ElmtConn[e][0];
-            for(int i=1;i<=ElmtConn[e][0];i++){
-                mesh.GetBulkMeshElmtConnPtr()[count-1][i]=ElmtConn[e][i];
+            mesh.GetBulkMeshElmtDimListPtr()[count-1]=ElmtDimVec[ie];
+            mesh.GetBulkMeshElmtVTKCellTypeListPtr()[count-1]=ElmtVTKCellType[ie];
+            mesh.GetBulkMeshElmtPhyIDListPtr()[count-1]=ElmtPhyIDVec[ie];
+            mesh.GetBulkMeshElmtMeshTypeListPtr()[count-1]=ElmtTypeVec[ie];
+            Span<int> elConn=mesh.GetBulkMeshIthElmtNodeIDsPtr(count);
+            for(int i=ElmtConnOffset[ie];i<ElmtConnOffset[ie+1];i++){
+                jj=ElmtConn[i];
+                if(jj<1||jj>maxNodeTag||NodeIDFlag[jj-1]<1){
+                    MessagePrinter::PrintErrorTxt("element "+to_string(e+1)+" refers to an undefined node(="+to_string(jj)+") in your msh4 file");
+                    MessagePrinter::AsFem_Exit();
+                }
+                elConn[i-ElmtConnOffset[ie]]=NodeIDFlag[jj-1];// the continuous node id
             }
         }
     }
@@ -631,12 +868,10 @@ bool Gmsh4IO::ReadMeshFromFile(Mesh &mesh){
         phyid=mesh.GetBulkMeshNodeSetPhysicalIDListPtr()[i];
         phyname=mesh.GetBulkMeshNodeSetPhysicalNameListPtr()[i];
         HasNodePhyID=false;
-        for(const auto &it:NodeSetPhyID2NodeIDsList){
-            if(phyid==it.first){
-                mesh.GetBulkMeshNodeSetPhysicalName2NodeIDsListPtr().push_back(make_pair(phyname,it.second));
-                HasNodePhyID=true;
-                break;
-            }
+        auto it=NodeSetPhyID2NodeIDsList.find(phyid);
+        if(it!=NodeSetPhyID2NodeIDsList.end()){
+            mesh.GetBulkMeshNodeSetPhysicalName2NodeIDsListPtr().push_back(make_pair(phyname,it->second));
+            HasNodePhyID=true;
         }
         if(!HasNodePhyID){
             MessagePrinter::PrintErrorTxt("you defined "+phyname+" in your $Physical block of the msh4 file, however, we can not find the related nodes in $Elements block");
@@ -27,24 +27,29 @@ MeshIO::MeshIO(){
 }
 
 bool MeshIO::ReadMeshFromFile(Mesh &mesh){
+    bool IsSuccess=false;
     switch (_MeshIOType)
     {
     case MeshIOType::GMSH2:
         // cout<<"using gmsh2"<<endl;
-        return Gmsh2IO::ReadMeshFromFile(mesh);
+        IsSuccess=Gmsh2IO::ReadMeshFromFile(mesh);
         break;
     case MeshIOType::GMSH4:
         // cout<<"using gmsh4"<<endl;
-        return Gmsh4IO::ReadMeshFromFile(mesh);
+        IsSuccess=Gmsh4IO::ReadMeshFromFile(mesh);
         break;
     case MeshIOType::NETGEN:
         MessagePrinter::PrintErrorTxt("Netgen mesh is not supported yet!");
         return false;
     case MeshIOType::ABAQUS:
-        return AbaqusIO::ReadMeshFromFile(mesh);
+        IsSuccess=AbaqusIO::ReadMeshFromFile(mesh);
+        break;
     default:
         return false;
     }
+    // the physical groups are filled by the reader directly, so the name index must be rebuilt
+    if(IsSuccess) mesh.UpdateBulkMeshPhysicalGroupIndex();
+    return IsSuccess;
 }
 void MeshIO::SetMeshFileName(string filename){
     if(IsGmsh2MeshFile(filename)){
@@ -82,4 +87,37 @@ string MeshIO::GetMeshFileName()const{
     default:
         return "";
     }
-}
\ No newline at end of file
+}
+//*****************************************************
+bool MeshIO::ReadMeshFromFileWithCache(Mesh &mesh){
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+
+    string meshfile=GetMeshFileName();
+    string cachefile=meshfile+".cache";
+    // only the master rank reads the whole mesh file for the hash, the others just receive it
+    uint64_t hash=0;
+    if(rank==0) hash=LagrangeMesh::GetFileContentHash(meshfile);
+    MPI_Bcast(&hash,1,MPI_UINT64_T,0,PETSC_COMM_WORLD);
+    if(hash==0){
+        MessagePrinter::PrintErrorTxt("can\'t open the mesh file(="+meshfile+"), please check your input file");
+        MessagePrinter::AsFem_Exit();
+    }
+    if(mesh.ReadLagrangeMeshFromBinaryFile(cachefile,hash)){
+        MessagePrinter::PrintNormalTxt("Load mesh from the cache file(="+cachefile+")");
+        return true;
+    }
+
+    if(!ReadMeshFromFile(mesh)) return false;
+
+    // only the master rank writes the cache, the others just use the parsed mesh
+    if(rank==0){
+        if(mesh.SaveLagrangeMeshToBinaryFile(cachefile,hash)){
+            MessagePrinter::PrintNormalTxt("Save mesh to the cache file(="+cachefile+")");
+        }
+        else{
+            MessagePrinter::PrintWarningTxt("can\'t write the mesh cache file(="+cachefile+"), the mesh file will be parsed again in the next run");
+        }
+    }
+    return true;
+}
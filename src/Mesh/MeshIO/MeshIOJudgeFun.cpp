@@ -37,6 +37,8 @@ bool MeshIO::IsGmsh2MeshFile(string filename){
                 _in.close();
                 return false;
             }
+            // only the format block is needed, the rest(may be binary) is not scanned
+            break;
         }
     }
     _in.close();
@@ -70,6 +72,8 @@ bool MeshIO::IsGmsh4MeshFile(string filename){
                 _in.close();
                 return false;
             }
+            // only the format block is needed, the rest(may be binary) is not scanned
+            break;
         }
     }
     _in.close();
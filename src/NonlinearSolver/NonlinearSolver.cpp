@@ -17,6 +17,7 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "NonlinearSolver/NonlinearSolver.h"
+#include "Utils/MemoryUsage.h"
 
 NonlinearSolver::NonlinearSolver(){
     _Rnorm0=1.0;_Rnorm=1.0;
@@ -162,6 +163,52 @@ void NonlinearSolver::Init(){
 //***************************************************
 void NonlinearSolver::ReleaseMem(){
     SNESDestroy(&_snes);
+    _HasFactor=false;
+}
+
+//****************************************************
+/**
+ * the memory of the factorized matrices of the preconditioner, the sub-blocks of bjacobi/asm are counted as well
+ */
+static double GetPCFactorMemoryUsage(PC pc){
+    PetscBool isfactor,isbjacobi,isasm;
+    PetscObjectTypeCompareAny((PetscObject)pc,&isfactor,PCLU,PCILU,PCCHOLESKY,PCICC,"");
+    if(isfactor){
+        Mat F;
+        PCFactorGetMatrix(pc,&F);
+        return MemoryUsage::Of(F);
+    }
+    PetscObjectTypeCompare((PetscObject)pc,PCBJACOBI,&isbjacobi);
+    PetscObjectTypeCompare((PetscObject)pc,PCASM,&isasm);
+    if(!isbjacobi&&!isasm) return 0.0;
+
+    PetscInt nlocal,first;
+    KSP *subksp;
+    PC subpc;
+    double bytes=0.0;
+    if(isbjacobi){
+        PCBJacobiGetSubKSP(pc,&nlocal,&first,&subksp);
+    }
+    else{
+        PCASMGetSubKSP(pc,&nlocal,&first,&subksp);
+    }
+    for(PetscInt i=0;i<nlocal;i++){
+        KSPGetPC(subksp[i],&subpc);
+        bytes+=GetPCFactorMemoryUsage(subpc);
+    }
+    return bytes;
+}
+double NonlinearSolver::GetFactorMemoryUsage()const{
+    if(!_HasFactor) return 0.0;
+    return GetPCFactorMemoryUsage(_pc);
+}
+double NonlinearSolver::EstimateFactorMemoryUsage(const Mat &A)const{
+    // the direct solvers use LU, the krylov ones use the PETSc default preconditioner(ILU(0) or bjacobi+ILU(0))
+    double fill=1.0;
+    if(_LinearSolverName.find("default")==0||_LinearSolverName=="mumps"||_LinearSolverName=="superlu"){
+        fill=5.0;
+    }
+    return fill*MemoryUsage::Of(A);
 }
 
 //****************************************************
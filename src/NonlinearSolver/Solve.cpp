@@ -14,6 +14,7 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "NonlinearSolver/NonlinearSolver.h"
+#include "Utils/Profiler.h"
 
 //***************************************************************
 //*** here we define a monitor to print out the iteration info
@@ -285,6 +286,12 @@ bool NonlinearSolver::Solve(Mesh &mesh,DofHandler &dofHandler,
     SNESSolve(_snes,NULL,_appctx._solutionSystem->_Unew);
    
     SNESGetConvergedReason(_snes,&_snesreason);
+    _HasFactor=true;
+    if(Profiler::IsActive()){
+        PetscInt kspiters;
+        SNESGetLinearSolveIterations(_snes,&kspiters);
+        Profiler::AddSolverIters(_monctx.iters,kspiters,_snesreason>0);
+    }
     
     _Iters=_monctx.iters;
     _Rnorm=_monctx.rnorm;
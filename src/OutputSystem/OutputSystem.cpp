@@ -60,6 +60,15 @@ void OutputSystem::SetOutputType(OutputType outputtype){
 }
 
 //****************************************************
+double OutputSystem::GetMemoryUsage(const SolutionSystem &solutionSystem)const{
+    if(!solutionSystem.IsInit()) return 0.0;
+    // the values of the gathered vectors and the indices of the scatter context
+    PetscInt nU,nProj;
+    VecGetSize(solutionSystem._Unew,&nU);
+    VecGetSize(solutionSystem._Proj,&nProj);
+    return static_cast<double>((nU+nProj)*(sizeof(PetscScalar)+sizeof(PetscInt)));
+}
+
 void OutputSystem::PrintInfo()const{
     MessagePrinter::PrintNormalTxt("Output system information summary:");
     MessagePrinter::PrintNormalTxt("  output file format ="+_OutputTypeName);
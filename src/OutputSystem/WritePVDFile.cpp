@@ -90,3 +90,42 @@ void OutputSystem::WriteResultToPVDFile(const double &timestep,string resultfile
         out.close();
     }
 }
+//**********************************************
+void OutputSystem::ReopenPVDFile(const double &t){
+    MPI_Comm_rank(PETSC_COMM_WORLD, &_rank);
+    _PVDFileName=_InputFileName.substr(0,_InputFileName.size()-2)+".pvd";// remove ".i" extension name
+    if(_rank==0){
+        ifstream in;
+        string line;
+        vector<string> lines;
+        in.open(_PVDFileName,ios::in);
+        if(!in.is_open()){
+            WritePVDFileHeader();
+            WritePVDFileEnd();
+            return;
+        }
+        while(getline(in,line)){
+            if(line.find("<DataSet timestep=\"")!=string::npos){
+                // the time is written with 6 digits, so a relative tolerance is used
+                if(atof(line.substr(line.find_first_of('"')+1).c_str())>t+1.0e-5*abs(t)) continue;
+            }
+            if(line.find("</Collection>")!=string::npos) break;
+            lines.push_back(line);
+        }
+        in.close();
+
+        ofstream out;
+        out.open(_PVDFileName,ios::out);
+        if (!out.is_open()){
+            string str="can\'t open pvd file(="+_PVDFileName+")!, please make sure you have write permission";
+            MessagePrinter::PrintErrorTxt(str);
+            MessagePrinter::AsFem_Exit();
+        }
+        for(const auto &it:lines){
+            out<<it<<endl;
+        }
+        out<<"</Collection>\n";
+        out<<"</VTKFile>\n";
+        out.close();
+    }
+}
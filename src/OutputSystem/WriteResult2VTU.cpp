@@ -22,31 +22,11 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
     VecScatterEnd(_scatterU,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
 
 
-    //*** for projected variables
+    //*** for projected variables and materials, all of them are stored in one blocked vector
     VecScatterCreateToAll(solutionSystem._Proj,&_scatterProj,&_ProjSeq);
     VecScatterBegin(_scatterProj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
     VecScatterEnd(_scatterProj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
 
-    //*** for projected scalar materials
-    VecScatterCreateToAll(solutionSystem._ProjScalarMate,&_scatterProjScalar,&_ProjScalarSeq);
-    VecScatterBegin(_scatterProjScalar,solutionSystem._ProjScalarMate,_ProjScalarSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjScalar,solutionSystem._ProjScalarMate,_ProjScalarSeq,INSERT_VALUES,SCATTER_FORWARD);
-
-    //*** for projected vector materials
-    VecScatterCreateToAll(solutionSystem._ProjVectorMate,&_scatterProjVector,&_ProjVectorSeq);
-    VecScatterBegin(_scatterProjVector,solutionSystem._ProjVectorMate,_ProjVectorSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjVector,solutionSystem._ProjVectorMate,_ProjVectorSeq,INSERT_VALUES,SCATTER_FORWARD);
-
-    //*** for projected rank-2 materials
-    VecScatterCreateToAll(solutionSystem._ProjRank2Mate,&_scatterProjRank2,&_ProjRank2Seq);
-    VecScatterBegin(_scatterProjRank2,solutionSystem._ProjRank2Mate,_ProjRank2Seq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjRank2,solutionSystem._ProjRank2Mate,_ProjRank2Seq,INSERT_VALUES,SCATTER_FORWARD);
-
-    //*** for projected rank-4 materials
-    VecScatterCreateToAll(solutionSystem._ProjRank4Mate,&_scatterProjRank4,&_ProjRank4Seq);
-    VecScatterBegin(_scatterProjRank4,solutionSystem._ProjRank4Mate,_ProjRank4Seq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjRank4,solutionSystem._ProjRank4Mate,_ProjRank4Seq,INSERT_VALUES,SCATTER_FORWARD);
-
     if(_rank == 0){
         _OutputFileName=_InputFileName.substr(0,_InputFileName.size()-2);// remove ".i" extension name
         _VTUFileName = _OutputFileName + ".vtu";
@@ -173,7 +153,7 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
 
         string dofname,projname;
         PetscScalar value;
-        int nProj;
+        int nProj,nProjBlockSize=solutionSystem.GetProjBlockSize();
 
         // output solutions
         for (j = 1;j<=dofHandler.GetDofsNumPerNode();++j){
@@ -196,7 +176,7 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
             projname=solutionSystem.GetIthProjName(j);
             _VTUFile<<"<DataArray type=\"Float64\"  Name=\""<<projname<<"\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
             for(i=1;i<=mesh.GetBulkMeshNodesNum();++i){
-                iInd =(i-1)*(1+nProj)+j;
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetProjVariableOffset()+j-1;
                 VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<"\n";
             }
@@ -210,8 +190,8 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
             projname=solutionSystem.GetIthScalarMateName(j);
             _VTUFile<<"<DataArray type=\"Float64\"  Name=\""<<projname<<"\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
             for(i=1;i<=mesh.GetBulkMeshNodesNum();++i){
-                iInd =(i-1)*(1+nProj)+j;
-                VecGetValues(_ProjScalarSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetScalarMateProjOffset()+j-1;
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<"\n";
             }
             _VTUFile<<"</DataArray>\n\n";
@@ -224,16 +204,16 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
             projname=solutionSystem.GetIthVectorMateName(j);
             _VTUFile<<"<DataArray type=\"Float64\"  Name=\""<<projname<<"\"  NumberOfComponents=\"3\" format=\"ascii\">\n";
             for(i=1;i<=mesh.GetBulkMeshNodesNum();++i){
-                iInd =(i-1)*(1+nProj*3)+3*(j-1)+1;
-                VecGetValues(_ProjVectorSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetVectorMateProjOffset()+3*(j-1);
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                 //***************************************
-                iInd =(i-1)*(1+nProj*3)+3*(j-1)+2;
-                VecGetValues(_ProjVectorSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetVectorMateProjOffset()+3*(j-1)+1;
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                 //***************************************
-                iInd =(i-1)*(1+nProj*3)+3*(j-1)+3;
-                VecGetValues(_ProjVectorSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetVectorMateProjOffset()+3*(j-1)+2;
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<"\n";
             }
             _VTUFile<<"</DataArray>\n\n";
@@ -251,8 +231,8 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
                 for(i1=1;i1<=3;i1++){
                     for(j1=1;j1<=3;j1++){
                         ii+=1;
-                        iInd =(i-1)*(1+nProj*9)+9*(j-1)+ii;
-                        VecGetValues(_ProjRank2Seq,1,&iInd,&value);
+                        iInd =(i-1)*nProjBlockSize+solutionSystem.GetRank2MateProjOffset()+9*(j-1)+ii-1;
+                        VecGetValues(_ProjSeq,1,&iInd,&value);
                         _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                     }
                     _VTUFile<<"\n";
@@ -273,8 +253,8 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
                 for(i1=1;i1<=6;i1++){
                     for(j1=1;j1<=6;j1++){
                         ii+=1;
-                        iInd =(i-1)*(1+nProj*36)+36*(j-1)+ii;
-                        VecGetValues(_ProjRank4Seq,1,&iInd,&value);
+                        iInd =(i-1)*nProjBlockSize+solutionSystem.GetRank4MateProjOffset()+36*(j-1)+ii-1;
+                        VecGetValues(_ProjSeq,1,&iInd,&value);
                         _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                     }
                     _VTUFile<<"\n";
@@ -294,21 +274,9 @@ void OutputSystem::WriteResult2VTU(const Mesh &mesh,const DofHandler &dofHandler
 
     VecScatterDestroy(&_scatterU);
     VecDestroy(&_Useq);
-    // for projected variables
+    // for projected variables and materials
     VecScatterDestroy(&_scatterProj);
     VecDestroy(&_ProjSeq);
-    // for projected scalars
-    VecScatterDestroy(&_scatterProjScalar);
-    VecDestroy(&_ProjScalarSeq);
-    // for projected vectors
-    VecScatterDestroy(&_scatterProjVector);
-    VecDestroy(&_ProjVectorSeq);
-    // for projected rank-2
-    VecScatterDestroy(&_scatterProjRank2);
-    VecDestroy(&_ProjRank2Seq);
-    // for projected rank-4
-    VecScatterDestroy(&_scatterProjRank4);
-    VecDestroy(&_ProjRank4Seq);
 }
 void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofHandler &dofHandler,const SolutionSystem &solutionSystem){
     MPI_Comm_rank(PETSC_COMM_WORLD, &_rank);
@@ -317,31 +285,11 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
     VecScatterBegin(_scatterU,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
     VecScatterEnd(_scatterU,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
 
-    //*** for projected variables
+    //*** for projected variables and materials, all of them are stored in one blocked vector
     VecScatterCreateToAll(solutionSystem._Proj,&_scatterProj,&_ProjSeq);
     VecScatterBegin(_scatterProj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
     VecScatterEnd(_scatterProj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
 
-    //*** for projected scalar materials
-    VecScatterCreateToAll(solutionSystem._ProjScalarMate,&_scatterProjScalar,&_ProjScalarSeq);
-    VecScatterBegin(_scatterProjScalar,solutionSystem._ProjScalarMate,_ProjScalarSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjScalar,solutionSystem._ProjScalarMate,_ProjScalarSeq,INSERT_VALUES,SCATTER_FORWARD);
-
-    //*** for projected vector materials
-    VecScatterCreateToAll(solutionSystem._ProjVectorMate,&_scatterProjVector,&_ProjVectorSeq);
-    VecScatterBegin(_scatterProjVector,solutionSystem._ProjVectorMate,_ProjVectorSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjVector,solutionSystem._ProjVectorMate,_ProjVectorSeq,INSERT_VALUES,SCATTER_FORWARD);
-
-    //*** for projected rank-2 materials
-    VecScatterCreateToAll(solutionSystem._ProjRank2Mate,&_scatterProjRank2,&_ProjRank2Seq);
-    VecScatterBegin(_scatterProjRank2,solutionSystem._ProjRank2Mate,_ProjRank2Seq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjRank2,solutionSystem._ProjRank2Mate,_ProjRank2Seq,INSERT_VALUES,SCATTER_FORWARD);
-
-    //*** for projected rank-4 materials
-    VecScatterCreateToAll(solutionSystem._ProjRank4Mate,&_scatterProjRank4,&_ProjRank4Seq);
-    VecScatterBegin(_scatterProjRank4,solutionSystem._ProjRank4Mate,_ProjRank4Seq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterProjRank4,solutionSystem._ProjRank4Mate,_ProjRank4Seq,INSERT_VALUES,SCATTER_FORWARD);
-
     if(_rank == 0){
         ostringstream ss;
         ss<<setfill('0')<<setw(8)<<step;
@@ -470,7 +418,7 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
 
         string dofname,projname;
         PetscScalar value;
-        int nProj;
+        int nProj,nProjBlockSize=solutionSystem.GetProjBlockSize();
 
         // output solutions
         for (j = 1;j<=dofHandler.GetDofsNumPerNode();++j){
@@ -493,7 +441,7 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
             projname=solutionSystem.GetIthProjName(j);
             _VTUFile<<"<DataArray type=\"Float64\"  Name=\""<<projname<<"\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
             for(i=1;i<=mesh.GetBulkMeshNodesNum();++i){
-                iInd =(i-1)*(1+nProj)+j;
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetProjVariableOffset()+j-1;
                 VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<"\n";
             }
@@ -507,8 +455,8 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
             projname=solutionSystem.GetIthScalarMateName(j);
             _VTUFile<<"<DataArray type=\"Float64\"  Name=\""<<projname<<"\"  NumberOfComponents=\"1\" format=\"ascii\">\n";
             for(i=1;i<=mesh.GetBulkMeshNodesNum();++i){
-                iInd =(i-1)*(1+nProj)+j;
-                VecGetValues(_ProjScalarSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetScalarMateProjOffset()+j-1;
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<"\n";
             }
             _VTUFile<<"</DataArray>\n\n";
@@ -521,16 +469,16 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
             projname=solutionSystem.GetIthVectorMateName(j);
             _VTUFile<<"<DataArray type=\"Float64\"  Name=\""<<projname<<"\"  NumberOfComponents=\"3\" format=\"ascii\">\n";
             for(i=1;i<=mesh.GetBulkMeshNodesNum();++i){
-                iInd =(i-1)*(1+nProj*3)+3*(j-1)+1;
-                VecGetValues(_ProjVectorSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetVectorMateProjOffset()+3*(j-1);
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                 //***************************************
-                iInd =(i-1)*(1+nProj*3)+3*(j-1)+2;
-                VecGetValues(_ProjVectorSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetVectorMateProjOffset()+3*(j-1)+1;
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                 //***************************************
-                iInd =(i-1)*(1+nProj*3)+3*(j-1)+3;
-                VecGetValues(_ProjVectorSeq,1,&iInd,&value);
+                iInd =(i-1)*nProjBlockSize+solutionSystem.GetVectorMateProjOffset()+3*(j-1)+2;
+                VecGetValues(_ProjSeq,1,&iInd,&value);
                 _VTUFile<<scientific<<setprecision(6)<<value<<"\n";
             }
             _VTUFile<<"</DataArray>\n\n";
@@ -548,8 +496,8 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
                 for(i1=1;i1<=3;i1++){
                     for(j1=1;j1<=3;j1++){
                         ii+=1;
-                        iInd =(i-1)*(1+nProj*9)+9*(j-1)+ii;
-                        VecGetValues(_ProjRank2Seq,1,&iInd,&value);
+                        iInd =(i-1)*nProjBlockSize+solutionSystem.GetRank2MateProjOffset()+9*(j-1)+ii-1;
+                        VecGetValues(_ProjSeq,1,&iInd,&value);
                         _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                     }
                     _VTUFile<<"\n";
@@ -570,8 +518,8 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
                 for(i1=1;i1<=6;i1++){
                     for(j1=1;j1<=6;j1++){
                         ii+=1;
-                        iInd =(i-1)*(1+nProj*36)+36*(j-1)+ii;
-                        VecGetValues(_ProjRank4Seq,1,&iInd,&value);
+                        iInd =(i-1)*nProjBlockSize+solutionSystem.GetRank4MateProjOffset()+36*(j-1)+ii-1;
+                        VecGetValues(_ProjSeq,1,&iInd,&value);
                         _VTUFile<<scientific<<setprecision(6)<<value<<" ";
                     }
                     _VTUFile<<"\n";
@@ -591,19 +539,7 @@ void OutputSystem::WriteResult2VTU(const int &step, const Mesh &mesh, const DofH
 
     VecScatterDestroy(&_scatterU);
     VecDestroy(&_Useq);
-    // for projected variables
+    // for projected variables and materials
     VecScatterDestroy(&_scatterProj);
     VecDestroy(&_ProjSeq);
-    // for projected scalars
-    VecScatterDestroy(&_scatterProjScalar);
-    VecDestroy(&_ProjScalarSeq);
-    // for projected vectors
-    VecScatterDestroy(&_scatterProjVector);
-    VecDestroy(&_ProjVectorSeq);
-    // for projected rank-2
-    VecScatterDestroy(&_scatterProjRank2);
-    VecDestroy(&_ProjRank2Seq);
-    // for projected rank-4
-    VecScatterDestroy(&_scatterProjRank4);
-    VecDestroy(&_ProjRank4Seq);
 }
@@ -13,8 +13,10 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "OutputSystem/OutputSystem.h"
+#include "Utils/Profiler.h"
 
 void OutputSystem::WriteResultToFile(const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem){
+    ProfileScope profile(ProfileEvent::OUTPUT);
     if(_OutputType==OutputType::VTU){
         WriteResult2VTU(mesh,dofHandler,solutionSystem);
     }
@@ -24,6 +26,7 @@ void OutputSystem::WriteResultToFile(const Mesh &mesh,const DofHandler &dofHandl
     }
 }
 void OutputSystem::WriteResultToFile(const int &step,const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem){
+    ProfileScope profile(ProfileEvent::OUTPUT);
     if(_OutputType==OutputType::VTU){
         WriteResult2VTU(step,mesh,dofHandler,solutionSystem);
     }
@@ -18,7 +18,7 @@
 double Postprocess::AreaPostProcess(vector<string> sidenamelist,const Mesh &mesh,FE &fe){
     double area=0.0;
     int nDim,nNodesPerBCElmt;
-    int i,e,ee,gpInd;
+    int i,e,ee,gpInd,eStart,eEnd;
     Nodes elNodes;
     elNodes.InitNodes(16);
     double xi,eta,JxW;
@@ -32,7 +32,8 @@ double Postprocess::AreaPostProcess(vector<string> sidenamelist,const Mesh &mesh
 
     area=0.0;
     for(const auto &sidename:sidenamelist){
-        for(e=1;e<=mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename);e++){
+        GetRankLocalRange(mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename),eStart,eEnd);
+        for(e=eStart+1;e<=eEnd;e++){
             nDim=mesh.GetBulkMeshDimViaPhyName(sidename);
             nNodesPerBCElmt=mesh.GetBulkMeshNodesNumPerElmtViaPhysicalName(sidename);
             //cout<<"nNodesPerBCElmt="<<nNodesPerBCElmt<<endl;
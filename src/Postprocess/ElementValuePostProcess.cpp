@@ -10,18 +10,20 @@
 //+++ Author : Yang Bai
 //+++ Date   : 2021.02.22
 //+++ Purpose: this pps can calculate the dofs value of specific elmtid
+//+++          only the rank whose element range contains it returns
+//+++          the value
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "Postprocess/Postprocess.h"
 
 double Postprocess::ElementValuePostProcess(const int &elmtid,string variablename,
-                                         const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem){
+                                         const Mesh &mesh,const DofHandler &dofHandler){
     if(elmtid<1||elmtid>mesh.GetBulkMeshBulkElmtsNum()){
         MessagePrinter::PrintErrorTxt("elmtid="+to_string(elmtid)+" is invalid for ElementValuePostProcess");
         MessagePrinter::AsFem_Exit();
     }
     double elmtvalue=0.0,val;
-    int DofIndex,j,iInd,i;
+    int DofIndex,j,iInd,i,eStart,eEnd;
     DofIndex=dofHandler.GetDofIDviaDofName(variablename);
     if(DofIndex<1){
         MessagePrinter::PrintErrorTxt("error detected in ElementValuePostProcess,"
@@ -32,19 +34,19 @@ double Postprocess::ElementValuePostProcess(const int &elmtid,string variablenam
 
     elmtvalue=0.0;
 
-    VecScatterCreateToAll(solutionSystem._Unew,&_scatteru,&_Useq);
-    VecScatterBegin(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
+    // the elements are split among the ranks by GetRankLocalRange, only the rank whose range contains elmtid
+    // returns the value, so it is counted once in the sum over the ranks
+    GetRankLocalRange(mesh.GetBulkMeshBulkElmtsNum(),eStart,eEnd);
+    if(elmtid-1<eStart||elmtid-1>=eEnd){
+        return 0.0;
+    }
 
     for(i=1;i<=mesh.GetBulkMeshIthBulkElmtNodesNum(elmtid);i++){
         j=mesh.GetBulkMeshIthBulkElmtJthNodeID(elmtid,i);
         iInd=dofHandler.GetBulkMeshIthNodeJthDofIndex(j,DofIndex)-1;
-        VecGetValues(_Useq,1,&iInd,&val);
+        val=GetPPSSolutionValue(iInd);
         elmtvalue+=val;
     }
-    // delete scatter
-    VecScatterDestroy(&_scatteru);
-    VecDestroy(&_Useq);
 
     return static_cast<double>(elmtvalue/mesh.GetBulkMeshIthBulkElmtNodesNum(elmtid));
 }
@@ -16,10 +16,10 @@
 #include "Postprocess/Postprocess.h"
 
 double Postprocess::ElementalIntegralPostProcess(vector<string> domainnamelist,string variablename,
-                                                 const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem){
+                                                 const Mesh &mesh,const DofHandler &dofHandler,FE &fe){
     double value=0.0,dofvalue;
     int nDim,nNodesPerElmt;
-    int i,j,e,ee,iInd,gpInd,DofIndex;
+    int i,j,e,ee,iInd,gpInd,DofIndex,eStart,eEnd;
     Nodes elNodes;
     elNodes.InitNodes(27);
     double xi,eta,zeta,JxW;
@@ -40,14 +40,11 @@ double Postprocess::ElementalIntegralPostProcess(vector<string> domainnamelist,s
         MessagePrinter::AsFem_Exit();
     }
 
-    VecScatterCreateToAll(solutionSystem._Unew,&_scatteru,&_Useq);
-    VecScatterBegin(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-
     value=0.0;
 
     for(const auto &domainname:domainnamelist){
-        for(e=1;e<=mesh.GetBulkMeshElmtsNumViaPhysicalName(domainname);e++){
+        GetRankLocalRange(mesh.GetBulkMeshElmtsNumViaPhysicalName(domainname),eStart,eEnd);
+        for(e=eStart+1;e<=eEnd;e++){
             nDim=mesh.GetBulkMeshDimViaPhyName(domainname);
             if(nDim!=mesh.GetBulkMeshDim()){
                 MessagePrinter::PrintErrorTxt("error detected in ElementalIntegralPostProcess,"
@@ -61,7 +58,7 @@ double Postprocess::ElementalIntegralPostProcess(vector<string> domainnamelist,s
             for(i=1;i<=nNodesPerElmt;++i){
                 j=mesh.GetBulkMeshIthElmtJthNodeID(ee,i);
                 iInd=dofHandler.GetBulkMeshIthNodeJthDofIndex(j,DofIndex)-1;
-                VecGetValues(_Useq,1,&iInd,&dofvalue);
+                dofvalue=GetPPSSolutionValue(iInd);
                 elU[i-1]=dofvalue;
             }
             if(nDim==0){
@@ -94,9 +91,5 @@ double Postprocess::ElementalIntegralPostProcess(vector<string> domainnamelist,s
             }
         }
     }
-    // delete scatter
-    VecScatterDestroy(&_scatteru);
-    VecDestroy(&_Useq);
-
     return value;
 }
@@ -10,12 +10,14 @@
 //+++ Author : Yang Bai
 //+++ Date   : 2021.02.22
 //+++ Purpose: this pps can calculate the dofs value of specific nodeid
+//+++          only the rank who owns the dof returns the value, the
+//+++          others return zero, so the reduction gives the value
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "Postprocess/Postprocess.h"
 
 double Postprocess::NodeValuePostProcess(const int &nodeid,string variablename,
-                                         const Mesh &mesh,const DofHandler &dofHandler,const SolutionSystem &solutionSystem){
+                                         const Mesh &mesh,const DofHandler &dofHandler){
     if(nodeid<1||nodeid>mesh.GetBulkMeshNodesNum()){
         MessagePrinter::PrintErrorTxt("nodeid="+to_string(nodeid)+" is invalid for NodeValuePostProcess");
         MessagePrinter::AsFem_Exit();
@@ -32,13 +34,8 @@ double Postprocess::NodeValuePostProcess(const int &nodeid,string variablename,
 
     j=dofHandler.GetBulkMeshIthNodeJthDofIndex(nodeid,DofIndex)-1;
 
-    VecScatterCreateToAll(solutionSystem._Unew,&_scatteru,&_Useq);
-    VecScatterBegin(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-
-    VecGetValues(_Useq,1,&j,&nodevalue);
-    // delete scatter
-    VecScatterDestroy(&_scatteru);
-    VecDestroy(&_Useq);
+    if(j>=_UStart&&j<_UEnd){
+        nodevalue=GetPPSSolutionValue(j);
+    }
     return nodevalue;
 }
@@ -24,6 +24,15 @@ Postprocess::Postprocess(){
     _VariableNameList.clear();
     _PPSValues.clear();
     _OutputInterval=1;
+    _rank=0;_size=1;
+    _IsUScatterCreated=false;
+    _IsProjScatterCreated=false;
+    _UStart=0;_UEnd=0;
+    _Useqvals=nullptr;
+    _ProjSeqvals=nullptr;
+    _IsCollectingIndices=false;
+    _UIndices.clear();
+    _ProjIndices.clear();
 }
 //************************************************************
 void Postprocess::PrintPostprocessInfo()const{
@@ -67,7 +76,7 @@ void Postprocess::AddPostprocessBlock(PostprocessBlock &postprocessblock){
     }
 }
 //**********************************************************
-void Postprocess::InitPPSOutput(){
+void Postprocess::InitPPSOutput(const bool &isrestart){
     if(_nPostProcessBlocks<1){
         MessagePrinter::PrintWarningTxt("no [postprocess] block is found, AsFem will not do any postprocess for you");
         return;
@@ -80,6 +89,15 @@ void Postprocess::InitPPSOutput(){
             _PPSValues.push_back(0.0);
         }
         MPI_Comm_rank(PETSC_COMM_WORLD, &_rank);
+        if(isrestart){
+            // for restart, the previous records will be reused
+            ifstream in;
+            in.open(_CSVFileName,ios::in);
+            if(in.is_open()){
+                in.close();
+                return;
+            }
+        }
         if(_rank==0){
             ofstream out;
             out.open(_CSVFileName,ios::out);
@@ -96,4 +114,61 @@ void Postprocess::InitPPSOutput(){
             out.close();
         }
     }
-}
\ No newline at end of file
+}
+//**********************************************************
+void Postprocess::RemovePPSOutputAfter(const double &t){
+    if(_nPostProcessBlocks<1) return;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &_rank);
+    if(_rank==0){
+        ifstream in;
+        string line;
+        vector<string> lines;
+        in.open(_CSVFileName,ios::in);
+        if(!in.is_open()) return;
+        getline(in,line);
+        lines.push_back(line);// the header
+        while(getline(in,line)){
+            if(line.size()<1) continue;
+            // the time is written with 8 digits, so a relative tolerance is used
+            if(atof(line.substr(0,line.find_first_of(',')).c_str())<=t+1.0e-7*abs(t)){
+                lines.push_back(line);
+            }
+        }
+        in.close();
+
+        ofstream out;
+        out.open(_CSVFileName,ios::out);
+        if (!out.is_open()){
+            string str="can\'t open the csv file(="+_CSVFileName+")!, please make sure you have write permission";
+            MessagePrinter::PrintErrorTxt(str);
+            MessagePrinter::AsFem_Exit();
+        }
+        for(const auto &it:lines){
+            out<<it<<endl;
+        }
+        out.close();
+    }
+}
+//**********************************************************
+bool Postprocess::IsProjectionRequired()const{
+    for(const auto &block:_PostProcessBlockList){
+        if(block._PostprocessType==PostprocessType::PROJVARIABLESIDEINTEGRALPPS||
+           block._PostprocessType==PostprocessType::RANK2MATESIDEINTEGRALPPS){
+            return true;
+        }
+    }
+    return false;
+}
+//**********************************************************
+void Postprocess::ReleaseMem(){
+    if(_IsUScatterCreated){
+        VecScatterDestroy(&_scatteru);
+        VecDestroy(&_Useq);
+        _IsUScatterCreated=false;
+    }
+    if(_IsProjScatterCreated){
+        VecScatterDestroy(&_scatterproj);
+        VecDestroy(&_ProjSeq);
+        _IsProjScatterCreated=false;
+    }
+}
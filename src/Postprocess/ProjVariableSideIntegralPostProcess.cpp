@@ -19,18 +19,14 @@ double Postprocess::ProjVariableSideIntegralPostProcess(vector<string> sidenamel
                                                         const Mesh &mesh,FE &fe,const SolutionSystem &solutionSystem){
     double value=0.0,dofvalue;
     int nDim,nNodesPerElmt;
-    int i,j,e,ee,iInd,gpInd,nProj,ProjIndex;
+    int i,j,e,ee,iInd,gpInd,nProjBlockSize,ProjIndex,eStart,eEnd;
     Nodes elNodes;
     elNodes.InitNodes(27);
     double xi,eta,JxW;
     double elU[27];
 
-    VecScatterCreateToAll(solutionSystem._Proj,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-
     value=0.0;
-    nProj=solutionSystem.GetProjNumPerNode();
+    nProjBlockSize=solutionSystem.GetProjBlockSize();
     ProjIndex=solutionSystem.GetProjIDViaName(variablename);
 
     if(sidenamelist.size()<1){
@@ -45,7 +41,8 @@ double Postprocess::ProjVariableSideIntegralPostProcess(vector<string> sidenamel
         MessagePrinter::AsFem_Exit();
     }
     for(const auto &sidename:sidenamelist){
-        for(e=1;e<=mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename);e++){
+        GetRankLocalRange(mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename),eStart,eEnd);
+        for(e=eStart+1;e<=eEnd;e++){
             nDim=mesh.GetBulkMeshDimViaPhyName(sidename);
             if(nDim==mesh.GetBulkMeshDim()){
                 MessagePrinter::PrintErrorTxt("error detected in ProjVariableSideIntegralPostProcess,"
@@ -58,8 +55,8 @@ double Postprocess::ProjVariableSideIntegralPostProcess(vector<string> sidenamel
             // get the dof value for each nodal point
             for(i=1;i<=nNodesPerElmt;++i){
                 j=mesh.GetBulkMeshIthElmtJthNodeID(ee,i);
-                iInd=(j-1)*(nProj+1)+ProjIndex;
-                VecGetValues(_ProjSeq,1,&iInd,&dofvalue);
+                iInd=(j-1)*nProjBlockSize+solutionSystem.GetProjVariableOffset()+ProjIndex-1;
+                dofvalue=GetPPSProjValue(iInd);
                 elU[i-1]=dofvalue;
             }
             if(nDim==0){
@@ -101,9 +98,5 @@ double Postprocess::ProjVariableSideIntegralPostProcess(vector<string> sidenamel
             }
         }
     }
-    // delete scatter
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
-
     return value;
 }
\ No newline at end of file
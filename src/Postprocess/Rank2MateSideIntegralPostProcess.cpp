@@ -20,18 +20,14 @@ double Postprocess::Rank2MateSideIntegralPostProcess(vector<string> sidenamelist
                                                      const Mesh &mesh,FE &fe,const SolutionSystem &solutionSystem){
     double value=0.0,dofvalue;
     int nDim,nNodesPerElmt;
-    int i,j,e,ee,gpInd,iInd,nProj,ProjIndex;
+    int i,j,e,ee,gpInd,iInd,nProjBlockSize,ProjIndex,eStart,eEnd;
     Nodes elNodes;
     elNodes.InitNodes(27);
     double xi,eta,JxW;
     double elU[27];
 
-    VecScatterCreateToAll(solutionSystem._ProjRank2Mate,&_scatterproj,&_ProjSeq);
-    VecScatterBegin(_scatterproj,solutionSystem._ProjRank2Mate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatterproj,solutionSystem._ProjRank2Mate,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
-
     value=0.0;
-    nProj=solutionSystem.GetRank2MateProjNumPerNode();
+    nProjBlockSize=solutionSystem.GetProjBlockSize();
     ProjIndex=solutionSystem.GetRank2MateIDViaName(matename);
 
     if(sidenamelist.size()<1){
@@ -46,7 +42,8 @@ double Postprocess::Rank2MateSideIntegralPostProcess(vector<string> sidenamelist
         MessagePrinter::AsFem_Exit();
     }
     for(const auto &sidename:sidenamelist){
-        for(e=1;e<=mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename);e++){
+        GetRankLocalRange(mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename),eStart,eEnd);
+        for(e=eStart+1;e<=eEnd;e++){
             nDim=mesh.GetBulkMeshDimViaPhyName(sidename);
             if(nDim==mesh.GetBulkMeshDim()){
                 MessagePrinter::PrintErrorTxt("error detected in Rank2MateSideIntegralPostProcess,"
@@ -59,8 +56,8 @@ double Postprocess::Rank2MateSideIntegralPostProcess(vector<string> sidenamelist
             // get the dof value for each nodal point
             for(i=1;i<=nNodesPerElmt;++i){
                 j=mesh.GetBulkMeshIthElmtJthNodeID(ee,i);
-                iInd=(j-1)*(nProj*9+1)+(ProjIndex-1)*9+(ii-1)*3+jj;
-                VecGetValues(_ProjSeq,1,&iInd,&dofvalue);
+                iInd=(j-1)*nProjBlockSize+solutionSystem.GetRank2MateProjOffset()+(ProjIndex-1)*9+(ii-1)*3+jj-1;
+                dofvalue=GetPPSProjValue(iInd);
                 elU[i-1]=dofvalue;
             }
             if(nDim==0){
@@ -102,9 +99,5 @@ double Postprocess::Rank2MateSideIntegralPostProcess(vector<string> sidenamelist
             }
         }
     }
-    // delete scatter
-    VecScatterDestroy(&_scatterproj);
-    VecDestroy(&_ProjSeq);
-
     return value;
 }
\ No newline at end of file
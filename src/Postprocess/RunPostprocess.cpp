@@ -10,18 +10,77 @@
 //+++ Author : Yang Bai
 //+++ Date   : 2021.02.22
 //+++ Purpose: run different types of postprocess for our FEM analysis
+//+++          the solution is scattered once for all the blocks, each
+//+++          rank only works on its own elements(nodes) and receives
+//+++          the entries they read, the partial values are summed up
+//+++          by one MPI_Allreduce
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "Postprocess/Postprocess.h"
+#include "Utils/Profiler.h"
 
 void Postprocess::RunPostprocess(const double &time,const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem){
+    ProfileScope profile(ProfileEvent::POSTPROCESS);
     if(_nPostProcessBlocks<1){
         return;
     }
+    bool IsSolutionRequired,IsProjRequired;
+
+    MPI_Comm_rank(PETSC_COMM_WORLD, &_rank);
+    MPI_Comm_size(PETSC_COMM_WORLD, &_size);
+
+    IsSolutionRequired=false;
+    IsProjRequired=false;
+    for(const auto &block:_PostProcessBlockList){
+        if(block._PostprocessType==PostprocessType::NODALVALUEPPS||
+           block._PostprocessType==PostprocessType::ELEMENTVALUEPPS||
+           block._PostprocessType==PostprocessType::SIDEINTEGRALPPS||
+           block._PostprocessType==PostprocessType::ELEMENTINTEGRALPPS){
+            IsSolutionRequired=true;
+        }
+        else if(block._PostprocessType==PostprocessType::PROJVARIABLESIDEINTEGRALPPS||
+                block._PostprocessType==PostprocessType::RANK2MATESIDEINTEGRALPPS){
+            IsProjRequired=true;
+        }
+    }
+    // all the blocks share the same sequential copy of the solution in current step
+    ScatterPPSSolution(mesh,dofHandler,fe,solutionSystem,IsSolutionRequired,IsProjRequired);
+
+    RunPPSBlocks(mesh,dofHandler,fe,solutionSystem);
+
+    if(IsSolutionRequired) VecRestoreArrayRead(_Useq,&_Useqvals);
+    if(IsProjRequired) VecRestoreArrayRead(_ProjSeq,&_ProjSeqvals);
+
+    // each block only holds the contribution of current rank, so one reduction is enough for all the blocks
+    MPI_Allreduce(MPI_IN_PLACE,_PPSValues.data(),_nPostProcessBlocks,MPI_DOUBLE,MPI_SUM,PETSC_COMM_WORLD);
+
+    if(_rank==0){
+        ofstream out;
+        out.open(_CSVFileName,ios::app|ios::out);
+        if (!out.is_open()){
+            string str="can\'t open the csv file(="+_CSVFileName+")!, please make sure you have write permission";
+            MessagePrinter::PrintErrorTxt(str);
+            MessagePrinter::AsFem_Exit();
+        }
+        char buff[20];
+        sprintf(buff,"%-15.8e",time);
+        out<<buff;
+        for(const auto &it:_PPSValues){
+            sprintf(buff,",%-15.8e",it);
+            out<<buff;
+        }
+        out<<endl;
+        out.close();
+    }
+}
+
+//****************************************************************
+void Postprocess::RunPPSBlocks(const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem){
     PostprocessType ppstype;
     int nodeid,elmtid,iInd,jInd;
     string dofname,projvarname,rank2matename;
     vector<string> sidenamelist,domainnamelsit;
+
     for(int i=0;i<_nPostProcessBlocks;i++){
         ppstype=_PostProcessBlockList[i]._PostprocessType;
         nodeid=_PostProcessBlockList[i]._NodeID;
@@ -37,22 +96,22 @@ void Postprocess::RunPostprocess(const double &time,const Mesh &mesh,const DofHa
             case PostprocessType::NULLPPS:
                 break;
             case PostprocessType::NODALVALUEPPS:
-                _PPSValues[i]=NodeValuePostProcess(nodeid,dofname,mesh,dofHandler,solutionSystem);
+                _PPSValues[i]=NodeValuePostProcess(nodeid,dofname,mesh,dofHandler);
                 break;
             case PostprocessType::ELEMENTVALUEPPS:
-                _PPSValues[i]=ElementValuePostProcess(elmtid,dofname,mesh,dofHandler,solutionSystem);
+                _PPSValues[i]=ElementValuePostProcess(elmtid,dofname,mesh,dofHandler);
                 break;
             case PostprocessType::AREAPPS:
                 _PPSValues[i]=AreaPostProcess(sidenamelist,mesh,fe);
                 break;
             case PostprocessType::SIDEINTEGRALPPS:
-                _PPSValues[i]=SideIntegralPostProcess(sidenamelist,dofname,mesh,dofHandler,fe,solutionSystem);
+                _PPSValues[i]=SideIntegralPostProcess(sidenamelist,dofname,mesh,dofHandler,fe);
                 break;
             case PostprocessType::RANK2MATESIDEINTEGRALPPS:
                 _PPSValues[i]=Rank2MateSideIntegralPostProcess(sidenamelist,rank2matename,iInd,jInd,mesh,fe,solutionSystem);
                 break;
             case PostprocessType::ELEMENTINTEGRALPPS:
-                _PPSValues[i]=ElementalIntegralPostProcess(domainnamelsit,dofname,mesh,dofHandler,fe,solutionSystem);
+                _PPSValues[i]=ElementalIntegralPostProcess(domainnamelsit,dofname,mesh,dofHandler,fe);
                 break;
             case PostprocessType::VOLUMEPPS:
                 _PPSValues[i]=VolumePostProcess(domainnamelsit,mesh,fe);
@@ -66,25 +125,47 @@ void Postprocess::RunPostprocess(const double &time,const Mesh &mesh,const DofHa
                 break;
         }
     }
-
-    MPI_Comm_rank(PETSC_COMM_WORLD, &_rank);
-    if(_rank==0){
-        ofstream out;
-        out.open(_CSVFileName,ios::app|ios::out);
-        if (!out.is_open()){
-            string str="can\'t open the csv file(="+_CSVFileName+")!, please make sure you have write permission";
-            MessagePrinter::PrintErrorTxt(str);
-            MessagePrinter::AsFem_Exit();
+}
+//****************************************************************
+void Postprocess::ScatterPPSSolution(const Mesh &mesh,const DofHandler &dofHandler,FE &fe,const SolutionSystem &solutionSystem,
+                                     const bool &IsSolutionRequired,const bool &IsProjRequired){
+    IS is;
+    if((IsSolutionRequired&&!_IsUScatterCreated)||(IsProjRequired&&!_IsProjScatterCreated)){
+        // the first pass only records the indices read by the local elements(nodes), then each rank just
+        // receives these entries instead of the whole vectors
+        VecGetOwnershipRange(solutionSystem._Unew,&_UStart,&_UEnd);
+        _UIndices.clear();
+        _ProjIndices.clear();
+        _IsCollectingIndices=true;
+        RunPPSBlocks(mesh,dofHandler,fe,solutionSystem);
+        _IsCollectingIndices=false;
+        sort(_UIndices.begin(),_UIndices.end());
+        _UIndices.erase(unique(_UIndices.begin(),_UIndices.end()),_UIndices.end());
+        sort(_ProjIndices.begin(),_ProjIndices.end());
+        _ProjIndices.erase(unique(_ProjIndices.begin(),_ProjIndices.end()),_ProjIndices.end());
+    }
+    if(IsSolutionRequired){
+        if(!_IsUScatterCreated){
+            ISCreateGeneral(PETSC_COMM_SELF,static_cast<PetscInt>(_UIndices.size()),_UIndices.data(),PETSC_COPY_VALUES,&is);
+            VecCreateSeq(PETSC_COMM_SELF,static_cast<PetscInt>(_UIndices.size()),&_Useq);
+            VecScatterCreate(solutionSystem._Unew,is,_Useq,NULL,&_scatteru);
+            ISDestroy(&is);
+            _IsUScatterCreated=true;
         }
-        char buff[20];
-        sprintf(buff,"%-15.8e",time);
-        out<<buff;
-        for(const auto &it:_PPSValues){
-            sprintf(buff,",%-15.8e",it);
-            out<<buff;
+        VecScatterBegin(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
+        VecScatterEnd(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
+        VecGetArrayRead(_Useq,&_Useqvals);
+    }
+    if(IsProjRequired){
+        if(!_IsProjScatterCreated){
+            ISCreateGeneral(PETSC_COMM_SELF,static_cast<PetscInt>(_ProjIndices.size()),_ProjIndices.data(),PETSC_COPY_VALUES,&is);
+            VecCreateSeq(PETSC_COMM_SELF,static_cast<PetscInt>(_ProjIndices.size()),&_ProjSeq);
+            VecScatterCreate(solutionSystem._Proj,is,_ProjSeq,NULL,&_scatterproj);
+            ISDestroy(&is);
+            _IsProjScatterCreated=true;
         }
-        out<<endl;
-        out.close();
+        VecScatterBegin(_scatterproj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
+        VecScatterEnd(_scatterproj,solutionSystem._Proj,_ProjSeq,INSERT_VALUES,SCATTER_FORWARD);
+        VecGetArrayRead(_ProjSeq,&_ProjSeqvals);
     }
 }
-
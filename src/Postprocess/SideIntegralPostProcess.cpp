@@ -16,20 +16,15 @@
 #include "Postprocess/Postprocess.h"
 
 double Postprocess::SideIntegralPostProcess(vector<string> sidenamelist,string dofname,
-                                            const Mesh &mesh,const DofHandler &dofHandler,FE &fe,
-                                            const SolutionSystem &solutionSystem){
+                                            const Mesh &mesh,const DofHandler &dofHandler,FE &fe){
     double dofvalue,value;
     int nDim,nNodesPerElmt;
-    int i,j,e,ee,iInd,gpInd,DofIndex;
+    int i,j,e,ee,iInd,gpInd,DofIndex,eStart,eEnd;
     Nodes elNodes;
     elNodes.InitNodes(27);
     double xi,eta,JxW;
     double elU[27];
 
-    VecScatterCreateToAll(solutionSystem._Unew,&_scatteru,&_Useq);
-    VecScatterBegin(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-    VecScatterEnd(_scatteru,solutionSystem._Unew,_Useq,INSERT_VALUES,SCATTER_FORWARD);
-
     DofIndex=dofHandler.GetDofIDviaDofName(dofname);
     value=0.0;
 
@@ -45,7 +40,8 @@ double Postprocess::SideIntegralPostProcess(vector<string> sidenamelist,string d
         MessagePrinter::AsFem_Exit();
     }
     for(const auto &sidename:sidenamelist){
-        for(e=1;e<=mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename);e++){
+        GetRankLocalRange(mesh.GetBulkMeshElmtsNumViaPhysicalName(sidename),eStart,eEnd);
+        for(e=eStart+1;e<=eEnd;e++){
             nDim=mesh.GetBulkMeshDimViaPhyName(sidename);
             if(nDim==mesh.GetBulkMeshDim()){
                 MessagePrinter::PrintErrorTxt("error detected in ProjVariableSideIntegralPostProcess,"
@@ -59,7 +55,7 @@ double Postprocess::SideIntegralPostProcess(vector<string> sidenamelist,string d
             for(i=1;i<=nNodesPerElmt;++i){
                 j=mesh.GetBulkMeshIthElmtJthNodeID(ee,i);
                 iInd=dofHandler.GetBulkMeshIthNodeJthDofIndex(j,DofIndex)-1;
-                VecGetValues(_Useq,1,&iInd,&dofvalue);
+                dofvalue=GetPPSSolutionValue(iInd);
                 elU[i-1]=dofvalue;
             }
             if(nDim==0){
@@ -101,9 +97,5 @@ double Postprocess::SideIntegralPostProcess(vector<string> sidenamelist,string d
             }
         }
     }
-    // delete scatter
-    VecScatterDestroy(&_scatteru);
-    VecDestroy(&_Useq);
-
     return value;
 }
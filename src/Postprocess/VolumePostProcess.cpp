@@ -18,7 +18,7 @@
 double Postprocess::VolumePostProcess(vector<string> domainnamelist,const Mesh &mesh,FE &fe){
     double volume=0.0;
     int nDim,nNodesPerElmt;
-    int i,e,ee,gpInd;
+    int i,e,ee,gpInd,eStart,eEnd;
     Nodes elNodes;
     elNodes.InitNodes(27);
     double xi,eta,zeta,JxW;
@@ -31,7 +31,8 @@ double Postprocess::VolumePostProcess(vector<string> domainnamelist,const Mesh &
 
     volume=0.0;
     for(const auto &domainname:domainnamelist){
-        for(e=1;e<=mesh.GetBulkMeshElmtsNumViaPhysicalName(domainname);e++){
+        GetRankLocalRange(mesh.GetBulkMeshElmtsNumViaPhysicalName(domainname),eStart,eEnd);
+        for(e=eStart+1;e<=eEnd;e++){
             nDim=mesh.GetBulkMeshDimViaPhyName(domainname);
             if(nDim!=mesh.GetBulkMeshDim()){
                 MessagePrinter::PrintErrorTxt("error detected in VolumePostProcess,"
@@ -64,10 +64,6 @@ void SolutionSystem::InitSolution(const int &ndofs,const int &nelmts,const int &
         _nProjPerNode=static_cast<int>(_ProjectionNameList.size());
         _IsProjection=true;
     }
-    VecCreate(PETSC_COMM_WORLD,&_Proj);
-    VecSetSizes(_Proj,PETSC_DECIDE,_nNodes*(1+_nProjPerNode));
-    VecSetUp(_Proj);
-    VecSet(_Proj,0.0);
     //*****************************************************
     //*** for scalar type projection quantities
     //*****************************************************
@@ -79,10 +75,6 @@ void SolutionSystem::InitSolution(const int &ndofs,const int &nelmts,const int &
         _nScalarProjPerNode=static_cast<int>(_ScalarMateProjectionNameList.size());
         _IsProjection=true;
     }
-    VecCreate(PETSC_COMM_WORLD,&_ProjScalarMate);
-    VecSetSizes(_ProjScalarMate,PETSC_DECIDE,_nNodes*(1+_nScalarProjPerNode));
-    VecSetUp(_ProjScalarMate);
-    VecSet(_ProjScalarMate,0.0);
     //*****************************************************
     //*** for vector type projection quantities
     //*****************************************************
@@ -94,10 +86,6 @@ void SolutionSystem::InitSolution(const int &ndofs,const int &nelmts,const int &
         _nVectorProjPerNode=static_cast<int>(_VectorMateProjctionNameList.size());
         _IsProjection=true;
     }
-    VecCreate(PETSC_COMM_WORLD,&_ProjVectorMate);
-    VecSetSizes(_ProjVectorMate,PETSC_DECIDE,_nNodes*(1+_nVectorProjPerNode*3));
-    VecSetUp(_ProjVectorMate);
-    VecSet(_ProjVectorMate,0.0);
     //*****************************************************
     //*** for rank-2 tensor type projection quantities
     //*****************************************************
@@ -109,10 +97,6 @@ void SolutionSystem::InitSolution(const int &ndofs,const int &nelmts,const int &
         _nRank2ProjPerNode=static_cast<int>(_Rank2MateProjectionNameList.size());
         _IsProjection=true;
     }
-    VecCreate(PETSC_COMM_WORLD,&_ProjRank2Mate);
-    VecSetSizes(_ProjRank2Mate,PETSC_DECIDE,_nNodes*(1+_nRank2ProjPerNode*9));
-    VecSetUp(_ProjRank2Mate);
-    VecSet(_ProjRank2Mate,0.0);
     //*****************************************************
     //*** for rank-4 tensor type projection quantities
     //*****************************************************
@@ -124,11 +108,18 @@ void SolutionSystem::InitSolution(const int &ndofs,const int &nelmts,const int &
         _nRank4ProjPerNode=static_cast<int>(_Rank4MateProjectionNameList.size());
         _IsProjection=true;
     }
-    VecCreate(PETSC_COMM_WORLD,&_ProjRank4Mate);
-    VecSetSizes(_ProjRank4Mate,PETSC_DECIDE,_nNodes*(1+_nRank4ProjPerNode*36));
-    VecSetUp(_ProjRank4Mate);
-    VecSet(_ProjRank4Mate,0.0);
-
+    //*****************************************************
+    //*** all the projected quantities are packed into one
+    //*** blocked vector, each node owns one block:
+    //*** [variables,scalar,vector,rank-2,rank-4]
+    //*****************************************************
+    _nProjBlockSize=_nProjPerNode+_nScalarProjPerNode+3*_nVectorProjPerNode+9*_nRank2ProjPerNode+36*_nRank4ProjPerNode;
+    if(_nProjBlockSize<1) _nProjBlockSize=1;// a dummy block, PETSc doesn't accept the zero block size
+    VecCreate(PETSC_COMM_WORLD,&_Proj);
+    VecSetSizes(_Proj,PETSC_DECIDE,_nNodes*_nProjBlockSize);
+    VecSetBlockSize(_Proj,_nProjBlockSize);
+    VecSetUp(_Proj);
+    VecSet(_Proj,0.0);
 
     // initialize the size of material properties on each gauss point
     _ScalarMaterials.resize(_nElmts*_nGPointsPerBulkElmt);
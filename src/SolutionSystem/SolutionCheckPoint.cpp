@@ -0,0 +1,144 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.14
+//+++ Purpose: write/read the solution vectors and the material
+//+++          history on each gauss point to/from binary files,
+//+++          which is used by the checkpoint/restart
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "SolutionSystem/SolutionSystem.h"
+
+//*********************************************************
+//*** helper functions for the binary I/O of the material maps
+//*********************************************************
+static void WriteMateName(ofstream &out,const string &name){
+    int len=static_cast<int>(name.size());
+    out.write(reinterpret_cast<const char*>(&len),sizeof(int));
+    out.write(name.c_str(),len);
+}
+static bool ReadMateName(ifstream &in,string &name){
+    int len;
+    in.read(reinterpret_cast<char*>(&len),sizeof(int));
+    if(!in.good()||len<0) return false;
+    name.resize(len);
+    in.read(&name[0],len);
+    return in.good();
+}
+template<class T>
+static void WriteMateMap(ofstream &out,const map<string,T> &mate,const int &ncomps){
+    int n=static_cast<int>(mate.size());
+    double value;
+    out.write(reinterpret_cast<const char*>(&n),sizeof(int));
+    for(const auto &it:mate){
+        WriteMateName(out,it.first);
+        for(int k=1;k<=ncomps;k++){
+            value=it.second[k];
+            out.write(reinterpret_cast<const char*>(&value),sizeof(double));
+        }
+    }
+}
+template<class T>
+static bool ReadMateMap(ifstream &in,map<string,T> &mate,const int &ncomps){
+    int n;
+    string name;
+    T temp;
+    in.read(reinterpret_cast<char*>(&n),sizeof(int));
+    if(!in.good()||n<0) return false;
+    mate.clear();
+    for(int i=0;i<n;i++){
+        if(!ReadMateName(in,name)) return false;
+        for(int k=1;k<=ncomps;k++){
+            in.read(reinterpret_cast<char*>(&temp[k]),sizeof(double));
+        }
+        mate[name]=temp;
+    }
+    return in.good();
+}
+// the scalar material is a plain double, no component access is available
+static void WriteScalarMateMap(ofstream &out,const ScalarMateType &mate){
+    int n=static_cast<int>(mate.size());
+    out.write(reinterpret_cast<const char*>(&n),sizeof(int));
+    for(const auto &it:mate){
+        WriteMateName(out,it.first);
+        out.write(reinterpret_cast<const char*>(&it.second),sizeof(double));
+    }
+}
+static bool ReadScalarMateMap(ifstream &in,ScalarMateType &mate){
+    int n;
+    string name;
+    double value;
+    in.read(reinterpret_cast<char*>(&n),sizeof(int));
+    if(!in.good()||n<0) return false;
+    mate.clear();
+    for(int i=0;i<n;i++){
+        if(!ReadMateName(in,name)) return false;
+        in.read(reinterpret_cast<char*>(&value),sizeof(double));
+        mate[name]=value;
+    }
+    return in.good();
+}
+
+//*********************************************************
+void SolutionSystem::WriteSolutionToBinaryFile(const string &filename)const{
+    PetscViewer viewer;
+    PetscViewerBinaryOpen(PETSC_COMM_WORLD,filename.c_str(),FILE_MODE_WRITE,&viewer);
+    VecView(_U,viewer);
+    VecView(_Uold,viewer);
+    VecView(_V,viewer);
+    VecView(_Vold,viewer);
+    PetscViewerDestroy(&viewer);
+}
+//*********************************************************
+void SolutionSystem::ReadSolutionFromBinaryFile(const string &filename){
+    PetscViewer viewer;
+    PetscViewerBinaryOpen(PETSC_COMM_WORLD,filename.c_str(),FILE_MODE_READ,&viewer);
+    VecLoad(_U,viewer);
+    VecLoad(_Uold,viewer);
+    VecLoad(_V,viewer);
+    VecLoad(_Vold,viewer);
+    PetscViewerDestroy(&viewer);
+    // the trial solution starts from the converged one
+    VecCopy(_U,_Unew);
+    VecCopy(_U,_Utemp);
+    _IsProjectionUpToDate=false;
+}
+//*********************************************************
+void SolutionSystem::WriteMaterialsToBinaryFile(ofstream &out)const{
+    int ngp=static_cast<int>(_ScalarMaterials.size());
+    out.write(reinterpret_cast<const char*>(&ngp),sizeof(int));
+    for(int i=0;i<ngp;i++){
+        WriteScalarMateMap(out,_ScalarMaterials[i]);
+        WriteScalarMateMap(out,_ScalarMaterialsOld[i]);
+        WriteMateMap(out,_VectorMaterials[i],3);
+        WriteMateMap(out,_VectorMaterialsOld[i],3);
+        WriteMateMap(out,_Rank2TensorMaterials[i],9);
+        WriteMateMap(out,_Rank2TensorMaterialsOld[i],9);
+        WriteMateMap(out,_Rank4TensorMaterials[i],81);
+        WriteMateMap(out,_Rank4TensorMaterialsOld[i],81);
+    }
+}
+//*********************************************************
+bool SolutionSystem::ReadMaterialsFromBinaryFile(ifstream &in){
+    int ngp;
+    in.read(reinterpret_cast<char*>(&ngp),sizeof(int));
+    if(!in.good()||ngp!=static_cast<int>(_ScalarMaterials.size())) return false;
+    for(int i=0;i<ngp;i++){
+        if(!ReadScalarMateMap(in,_ScalarMaterials[i])) return false;
+        if(!ReadScalarMateMap(in,_ScalarMaterialsOld[i])) return false;
+        if(!ReadMateMap(in,_VectorMaterials[i],3)) return false;
+        if(!ReadMateMap(in,_VectorMaterialsOld[i],3)) return false;
+        if(!ReadMateMap(in,_Rank2TensorMaterials[i],9)) return false;
+        if(!ReadMateMap(in,_Rank2TensorMaterialsOld[i],9)) return false;
+        if(!ReadMateMap(in,_Rank4TensorMaterials[i],81)) return false;
+        if(!ReadMateMap(in,_Rank4TensorMaterialsOld[i],81)) return false;
+    }
+    return true;
+}
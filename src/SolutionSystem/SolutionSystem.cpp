@@ -15,15 +15,19 @@
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
 #include "SolutionSystem/SolutionSystem.h"
+#include "Utils/MemoryUsage.h"
 
 SolutionSystem::SolutionSystem(){
 
     _IsInit=false;_IsProjection=false;
+    _IsProjectionUpToDate=false;
+    _ProjectionType=ProjectionType::LUMPED;
     _DofNameList.clear();
     _ProjectionNameList.clear();
 
     _nHistPerGPoint=6;
     _nProjPerNode=0;
+    _nProjBlockSize=1;
     _nScalarProjPerNode=0;_nVectorProjPerNode=0;_nRank2ProjPerNode=0;_nRank4ProjPerNode=0;
     _nGPointsPerBulkElmt=0;
     _nDofs=0;_nNodes=0;_nElmts=0;
@@ -37,7 +41,7 @@ SolutionSystem::SolutionSystem(){
     _ScalarMateProjectionNameList.clear();_VectorMateProjctionNameList.clear();
     _Rank2MateProjectionNameList.clear();_Rank4MateProjectionNameList.clear();
 
-    _nHistPerGPoint=6;_nProjPerNode=0;
+    _nHistPerGPoint=6;_nProjPerNode=0;_nProjBlockSize=1;
     _nScalarProjPerNode=0;_nVectorProjPerNode=0;_nRank2ProjPerNode=0;_nRank4ProjPerNode=0;
     _nGPointsPerBulkElmt=0;
     _nDofs=0;_nNodes=0;_nElmts=0;
@@ -52,6 +56,12 @@ SolutionSystem::SolutionSystem(){
 void SolutionSystem::PrintProjectionInfo()const{
     MessagePrinter::PrintNormalTxt("Projection information summary:");
     string msg;
+    if(_ProjectionType==ProjectionType::CONSISTENT){
+        MessagePrinter::PrintNormalTxt("projection type: consistent mass (L2 projection with CG solver)");
+    }
+    else{
+        MessagePrinter::PrintNormalTxt("projection type: lumped mass");
+    }
     msg="projected variables: ";
     for(const auto &it:_ProjectionNameList){
         msg+=it+" ";
@@ -88,6 +98,23 @@ void SolutionSystem::PrintProjectionInfo()const{
     MessagePrinter::PrintDashLine();
 }
 
+//*******************************************
+double SolutionSystem::GetVecMemoryUsage()const{
+    if(!_IsInit) return 0.0;
+    double bytes=0.0;
+    bytes+=MemoryUsage::Of(_Unew)+MemoryUsage::Of(_U)+MemoryUsage::Of(_Utemp)+MemoryUsage::Of(_V);
+    bytes+=MemoryUsage::Of(_Uold)+MemoryUsage::Of(_Vold);
+    bytes+=MemoryUsage::Of(_Proj);
+    return bytes;
+}
+double SolutionSystem::GetMaterialsMemoryUsage()const{
+    double bytes=0.0;
+    bytes+=MemoryUsage::Of(_ScalarMaterials)+MemoryUsage::Of(_ScalarMaterialsOld);
+    bytes+=MemoryUsage::Of(_VectorMaterials)+MemoryUsage::Of(_VectorMaterialsOld);
+    bytes+=MemoryUsage::Of(_Rank2TensorMaterials)+MemoryUsage::Of(_Rank2TensorMaterialsOld);
+    bytes+=MemoryUsage::Of(_Rank4TensorMaterials)+MemoryUsage::Of(_Rank4TensorMaterialsOld);
+    return bytes;
+}
 //*******************************************
 void SolutionSystem::ReleaseMem(){
     VecDestroy(&_Unew);
@@ -100,9 +127,4 @@ void SolutionSystem::ReleaseMem(){
 
     VecDestroy(&_Proj);
 
-    VecDestroy(&_ProjScalarMate);
-    VecDestroy(&_ProjVectorMate);
-    VecDestroy(&_ProjRank2Mate);
-    VecDestroy(&_ProjRank4Mate);
-
 }
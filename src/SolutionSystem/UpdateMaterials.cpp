@@ -19,7 +19,7 @@ void SolutionSystem::UpdateMaterials(){
         _ScalarMaterialsOld[i]=_ScalarMaterials[i];
     }
     for(int i=0;i<static_cast<int>(_VectorMaterials.size());i++){
-        _ScalarMaterialsOld[i]=_ScalarMaterials[i];
+        _VectorMaterialsOld[i]=_VectorMaterials[i];
     }
     for(int i=0;i<static_cast<int>(_Rank2TensorMaterials.size());i++){
         _Rank2TensorMaterialsOld[i]=_Rank2TensorMaterials[i];
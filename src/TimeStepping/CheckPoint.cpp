@@ -0,0 +1,155 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.05.14
+//+++ Purpose: write/read the checkpoint files for the restart of
+//+++          the transient analysis. The solution vectors are
+//+++          stored in one PETSc binary file, while the gauss
+//+++          point history and the time stepping state are
+//+++          stored in one binary file for each rank
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "TimeStepping/TimeStepping.h"
+#include "Utils/Profiler.h"
+
+static const char CheckPointMagic[8]={'A','S','F','E','M','C','H','K'};
+static const int CheckPointVersion=1;
+
+void TimeStepping::WriteCheckPoint(SolutionSystem &solutionSystem,const FEControlInfo &fectrlinfo){
+    ProfileScope profile(ProfileEvent::CHECKPOINT);
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    // CurrentStep already points to the next step
+    string filename=GetCheckPointFileName(fectrlinfo.CurrentStep-1);
+
+    // the solution vectors, collective call
+    solutionSystem.WriteSolutionToBinaryFile(filename);
+
+    // the time stepping state and the gauss point history of the local rank
+    ofstream out;
+    out.open(GetCheckPointHistFileName(filename,rank),ios::out|ios::binary);
+    if(!out.is_open()){
+        MessagePrinter::PrintErrorTxt("can\'t create the checkpoint file(="+GetCheckPointHistFileName(filename,rank)+"), please make sure you have write permission");
+        MessagePrinter::AsFem_Exit();
+    }
+    out.write(CheckPointMagic,8);
+    out.write(reinterpret_cast<const char*>(&CheckPointVersion),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&size),sizeof(PetscMPIInt));
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.CurrentStep),sizeof(int));
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.t),sizeof(double));
+    out.write(reinterpret_cast<const char*>(&fectrlinfo.dt),sizeof(double));
+    out.write(reinterpret_cast<const char*>(_IterHist),2*sizeof(int));
+    solutionSystem.WriteMaterialsToBinaryFile(out);
+    out.close();
+
+    MessagePrinter::PrintNormalTxt("Write checkpoint to "+filename);
+
+    // remove the old checkpoint files
+    _CheckPointFileList.push_back(filename);
+    while(static_cast<int>(_CheckPointFileList.size())>_CheckPointKeep){
+        filename=_CheckPointFileList.front();
+        _CheckPointFileList.pop_front();
+        if(rank==0){
+            remove(filename.c_str());
+            remove((filename+".info").c_str());
+        }
+        remove(GetCheckPointHistFileName(filename,rank).c_str());
+    }
+}
+//***************************************************************
+void TimeStepping::ReadCheckPoint(SolutionSystem &solutionSystem,FEControlInfo &fectrlinfo){
+    PetscMPIInt rank,size,oldsize=-1;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+
+    // the history file is read by each rank independently, the error code is reduced
+    // before any exit or collective call, otherwise the healthy ranks wait in VecLoad forever
+    enum {READ_OK=0,READ_NOFILE,READ_INVALID,READ_NRANKS,READ_MATERIALS};
+    int localerr=READ_OK,globalerr;
+    char magic[8];
+    int version;
+    ifstream in;
+    in.open(GetCheckPointHistFileName(_RestartFileName,rank),ios::in|ios::binary);
+    if(!in.is_open()){
+        localerr=READ_NOFILE;
+    }
+    else{
+        in.read(magic,8);
+        in.read(reinterpret_cast<char*>(&version),sizeof(int));
+        if(!in.good()||string(magic,8)!=string(CheckPointMagic,8)||version!=CheckPointVersion){
+            localerr=READ_INVALID;
+        }
+        else{
+            in.read(reinterpret_cast<char*>(&oldsize),sizeof(PetscMPIInt));
+            if(oldsize!=size){
+                localerr=READ_NRANKS;
+            }
+            else{
+                in.read(reinterpret_cast<char*>(&fectrlinfo.CurrentStep),sizeof(int));
+                in.read(reinterpret_cast<char*>(&fectrlinfo.t),sizeof(double));
+                in.read(reinterpret_cast<char*>(&fectrlinfo.dt),sizeof(double));
+                in.read(reinterpret_cast<char*>(_IterHist),2*sizeof(int));
+                if(!solutionSystem.ReadMaterialsFromBinaryFile(in)) localerr=READ_MATERIALS;
+            }
+        }
+        in.close();
+    }
+    MPI_Allreduce(&localerr,&globalerr,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    if(globalerr!=READ_OK){
+        if(globalerr==READ_NOFILE){
+            MessagePrinter::PrintErrorTxt("can\'t open the checkpoint files(="+_RestartFileName+".hist*) of all the ranks, please make sure the restart file is correct");
+        }
+        else if(globalerr==READ_INVALID){
+            MessagePrinter::PrintErrorTxt(_RestartFileName+" is not a valid checkpoint file of AsFem");
+        }
+        else if(globalerr==READ_NRANKS){
+            MessagePrinter::PrintErrorTxt("the checkpoint file is not written by "+to_string(size)+" ranks. The same number of ranks is required for the restart");
+        }
+        else{
+            MessagePrinter::PrintErrorTxt("the material history in "+_RestartFileName+" doesn\'t match the current mesh, please check your restart file");
+        }
+        MessagePrinter::AsFem_Exit();
+    }
+
+    // the solution vectors, collective call
+    solutionSystem.ReadSolutionFromBinaryFile(_RestartFileName);
+
+    SeedCheckPointFileList(fectrlinfo.CurrentStep-1);
+
+    char buff[70];
+    snprintf(buff,70,"Restart from step=%8d, time=%12.5e, dt=%12.5e",fectrlinfo.CurrentStep-1,fectrlinfo.t,fectrlinfo.dt);
+    MessagePrinter::PrintNormalTxt(string(buff));
+    MessagePrinter::PrintDashLine();
+}
+//***************************************************************
+void TimeStepping::SeedCheckPointFileList(const int &step){
+    // the checkpoints written by the previous run(with the same prefix and interval)
+    // are put back to the list, then they can be removed by the later WriteCheckPoint
+    _CheckPointFileList.clear();
+    if(_CheckPointInterval<1) return;
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    string filename;
+    int exist;
+    for(int i=_CheckPointKeep-1;i>=0;i--){
+        if(step-i*_CheckPointInterval<1) continue;
+        filename=GetCheckPointFileName(step-i*_CheckPointInterval);
+        exist=0;
+        if(rank==0){
+            ifstream in(filename,ios::in|ios::binary);
+            if(in.is_open()) exist=1;
+        }
+        // the list must be the same on all the ranks
+        MPI_Bcast(&exist,1,MPI_INT,0,PETSC_COMM_WORLD);
+        if(exist) _CheckPointFileList.push_back(filename);
+    }
+}
@@ -37,29 +37,37 @@ bool TimeStepping::Solve(Mesh &mesh,DofHandler &dofHandler,
     char buff[68];
     string str;
 
-    // apply the initial condition to the solution
-    icSystem.ApplyIC(mesh,dofHandler,solutionSystem._U);
-    VecCopy(solutionSystem._U,solutionSystem._Uold);
-    VecCopy(solutionSystem._U,solutionSystem._Unew);
-    VecCopy(solutionSystem._U,solutionSystem._Utemp);
-    
-    // initialize the history variables
-    feSystem.FormBulkFE(FECalcType::InitMaterial,0.0,_Dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
-    solutionSystem.UpdateMaterials();
-
-    // write result to the head of pvd file
-    outputSystem.WritePVDFileHeader();
-    outputSystem.WritePVDFileEnd();
-    if(fectrlinfo.IsProjection){
-        feSystem.FormBulkFE(FECalcType::Projection,0.0,_Dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
+    if(_IsRestart){
+        // restore the solution, history variables and the step info from the checkpoint
+        ReadCheckPoint(solutionSystem,fectrlinfo);
+        outputSystem.ReopenPVDFile(fectrlinfo.t);
+        postprocessSystem.RemovePPSOutputAfter(fectrlinfo.t);
+    }
+    else{
+        // apply the initial condition to the solution
+        icSystem.ApplyIC(mesh,dofHandler,solutionSystem._U);
+        VecCopy(solutionSystem._U,solutionSystem._Uold);
+        VecCopy(solutionSystem._U,solutionSystem._Unew);
+        VecCopy(solutionSystem._U,solutionSystem._Utemp);
+        
+        // initialize the history variables
+        feSystem.FormBulkFE(FECalcType::InitMaterial,0.0,_Dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
+        solutionSystem.UpdateMaterials();
+
+        // write result to the head of pvd file
+        outputSystem.WritePVDFileHeader();
+        outputSystem.WritePVDFileEnd();
+        if(fectrlinfo.IsProjection){
+            feSystem.UpdateProjection(0.0,_Dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
+        }
+        outputSystem.WriteResultToFile(0,mesh,dofHandler,solutionSystem);
+        outputSystem.WriteResultToPVDFile(0.0,outputSystem.GetOutputFileName());
+        MessagePrinter::PrintNormalTxt("Write result to "+outputSystem.GetOutputFileName());
+        MessagePrinter::PrintDashLine();
     }
-    outputSystem.WriteResultToFile(0,mesh,dofHandler,solutionSystem);
-    outputSystem.WriteResultToPVDFile(0.0,outputSystem.GetOutputFileName());
-    MessagePrinter::PrintNormalTxt("Write result to "+outputSystem.GetOutputFileName());
-    MessagePrinter::PrintDashLine();
    
     bool HasConvergeSolution; 
-    for(double currenttime=0.0;currenttime<_FinalT;){
+    for(double currenttime=fectrlinfo.t;currenttime<_FinalT;){
         HasConvergeSolution=false;
         while(fectrlinfo.dt>_DtMin){
             snprintf(buff,68,"TimeStepping: step=%8d,time=%12.5e,dt=%12.5e",fectrlinfo.CurrentStep,fectrlinfo.t+fectrlinfo.dt,fectrlinfo.dt);
@@ -82,16 +90,19 @@ bool TimeStepping::Solve(Mesh &mesh,DofHandler &dofHandler,
                 currenttime+=fectrlinfo.dt;
                 fectrlinfo.t+=fectrlinfo.dt;
 
-                // now we do the projection
-                if(fectrlinfo.IsProjection){
-                    feSystem.FormBulkFE(FECalcType::Projection,fectrlinfo.t,fectrlinfo.dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
-                }
-                // now, since the projection quantities are ready, we can do either the output or the postprocess
+                // the projection is only done when the output or the postprocess needs it,
+                // and it will be reused until the solution is updated
                 if(fectrlinfo.CurrentStep%postprocessSystem.GetOutputIntervalNum()==0){
+                    if(fectrlinfo.IsProjection&&postprocessSystem.IsProjectionRequired()){
+                        feSystem.UpdateProjection(fectrlinfo.t,fectrlinfo.dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
+                    }
                     postprocessSystem.RunPostprocess(fectrlinfo.t,mesh,dofHandler,fe,solutionSystem);
                 }
                 // for result output
                 if(fectrlinfo.CurrentStep%outputSystem.GetIntervalNum()==0){
+                    if(fectrlinfo.IsProjection){
+                        feSystem.UpdateProjection(fectrlinfo.t,fectrlinfo.dt,fectrlinfo.ctan,mesh,dofHandler,fe,elmtSystem,mateSystem,solutionSystem,equationSystem._AMATRIX,equationSystem._RHS);
+                    }
                     outputSystem.WriteResultToFile(fectrlinfo.CurrentStep,mesh,dofHandler,solutionSystem);
                     outputSystem.WriteResultToPVDFile(fectrlinfo.t,outputSystem.GetOutputFileName());
                     MessagePrinter::PrintNormalTxt("Write result to "+outputSystem.GetOutputFileName(),MessageColor::BLUE);
@@ -102,6 +113,8 @@ bool TimeStepping::Solve(Mesh &mesh,DofHandler &dofHandler,
                 fectrlinfo.CurrentStep+=1;
                 // update the materials
                 solutionSystem.UpdateMaterials();
+                // the memory usage is recorded once the process memory reaches a new peak(only for '--profile')
+                MemoryReport::UpdatePeak(fectrlinfo.CurrentStep-1,mesh,dofHandler,solutionSystem,equationSystem,nonlinearSolver,outputSystem);
 
                 // for adaptive time stepping
                 if(IsAdaptive()){
@@ -127,6 +140,11 @@ bool TimeStepping::Solve(Mesh &mesh,DofHandler &dofHandler,
                     _IterHist[1]=nonlinearSolver.GetFinalInterations();
                 }
 
+                // write the checkpoint, the step has already been updated
+                if(_CheckPointInterval>0&&(fectrlinfo.CurrentStep-1)%_CheckPointInterval==0){
+                    WriteCheckPoint(solutionSystem,fectrlinfo);
+                }
+
                 HasConvergeSolution=true;
                 // for converged case, we jump out the loop
                 break;
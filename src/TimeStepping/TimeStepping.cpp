@@ -29,6 +29,12 @@ TimeStepping::TimeStepping(){
     _DtMin=1.0e-12;
     _IterHist[0]=0;
     _IterHist[1]=1;
+    _CheckPointInterval=0;
+    _CheckPointKeep=2;
+    _CheckPointFilePrefix="asfem";
+    _RestartFileName.clear();
+    _IsRestart=false;
+    _CheckPointFileList.clear();
 }
 
 //****************************************************
@@ -44,6 +50,8 @@ void TimeStepping::SetOpitonsFromTimeSteppingBlock(TimeSteppingBlock &timeSteppi
     _GrowthFactor=timeSteppingBlock._GrowthFactor;
     _CutBackFactor=timeSteppingBlock._CutBackFactor;
     _OptIters=timeSteppingBlock._OptIters;
+    _CheckPointInterval=timeSteppingBlock._CheckPointInterval;
+    _CheckPointKeep=timeSteppingBlock._CheckPointKeep;
 }
 //*******************************************************
 void TimeStepping::PrintTimeSteppingInfo()const{
@@ -69,6 +77,12 @@ void TimeStepping::PrintTimeSteppingInfo()const{
     snprintf(buff,20,"%14.5e",_DtMin);
     str+=", min delta T="+string(buff);
     MessagePrinter::PrintNormalTxt(str);
+    if(_CheckPointInterval>0){
+        MessagePrinter::PrintNormalTxt("  checkpoint every "+to_string(_CheckPointInterval)+" steps, keep the last "+to_string(_CheckPointKeep)+" files");
+    }
+    if(_IsRestart){
+        MessagePrinter::PrintNormalTxt("  restart from "+_RestartFileName);
+    }
     MessagePrinter::PrintDashLine();
 }
 //****************************************
@@ -17,21 +17,17 @@
 
 
 // for the constructor in different purpose
-RankFourTensor::RankFourTensor()
-:_N(3),_N2(3*3),_N4(3*3*3*3){
+RankFourTensor::RankFourTensor(){
     for(int i=0;i<_N4;i++) _vals[i]=0.0;
 }
-RankFourTensor::RankFourTensor(const double &val)
-:_N(3),_N2(3*3),_N4(3*3*3*3){
+RankFourTensor::RankFourTensor(const double &val){
     for(int i=0;i<_N4;i++) _vals[i]=val;
 }
-RankFourTensor::RankFourTensor(const RankFourTensor &a)
-:_N(3),_N2(3*3),_N4(3*3*3*3){
+RankFourTensor::RankFourTensor(const RankFourTensor &a){
     for(int i=0;i<_N4;i++) _vals[i]=a._vals[i];
 }
 //*********************
-RankFourTensor::RankFourTensor(const InitMethod &method)
-:_N(3),_N2(3*3),_N4(3*3*3*3){
+RankFourTensor::RankFourTensor(const InitMethod &method){
     switch (method)
     {
     case InitMethod::InitZero:
@@ -357,18 +353,31 @@ RankFourTensor operator*(const RankTwoTensor &lhs,const RankFourTensor &a){
 RankTwoTensor RankFourTensor::DoubleDot(const RankTwoTensor &a) const{
     // A_ijkl:B_kl = Cij
     RankTwoTensor temp(0.0);
-    for(int i=1;i<=_N;i++){
-        for(int j=1;j<=_N;j++){
-            for(int k=1;k<=_N;k++){
-                for(int l=1;l<=_N;l++){
-                    temp(i,j)+=(*this)(i,j,k,l)*a(k,l);
-                }
-            }
-        }
-    }
+    DoubleDotInto(a,temp);
     return temp;
 }
 //**************************************************
+void RankFourTensor::DoubleDotInto(const RankTwoTensor &a,RankTwoTensor &result) const{
+    // A_ijkl:B_kl = Cij, the 9x9 matrix times the 9 components of a
+    double b[9],temp[9];
+    for(int K=0;K<_N2;K++) b[K]=a[K+1];
+    for(int I=0;I<_N2;I++){
+        temp[I]=0.0;
+        for(int K=0;K<_N2;K++) temp[I]+=_vals[I*_N2+K]*b[K];
+    }
+    for(int I=0;I<_N2;I++) result[I+1]=temp[I];
+}
+//**************************************************
+RankFourTensor& RankFourTensor::AddOTimes(const double &alpha,const RankTwoTensor &a,const RankTwoTensor &b){
+    // C_ijkl+=alpha*a_ij*b_kl
+    double ai;
+    for(int I=0;I<_N2;I++){
+        ai=alpha*a[I+1];
+        for(int J=0;J<_N2;J++) _vals[I*_N2+J]+=ai*b[J+1];
+    }
+    return *this;
+}
+//**************************************************
 //*** For rotation of a rank-4 tensor by the rank-2
 //*** rotation tensor
 //**************************************************
@@ -19,27 +19,23 @@
 //***************************************
 //*** the constructors for different usage!!!
 //***************************************
-RankTwoTensor::RankTwoTensor()
-:_N(3),_N2(3*3){
+RankTwoTensor::RankTwoTensor(){
     for(int i=0;i<_N2;++i){
         _vals[i]=0.0;
     }
 }
-RankTwoTensor::RankTwoTensor(const double &val)
-:_N(3),_N2(3*3){
+RankTwoTensor::RankTwoTensor(const double &val){
     for(int i=0;i<_N2;++i){
         _vals[i]=val;
     }
 }
-RankTwoTensor::RankTwoTensor(const RankTwoTensor &a)
-:_N(3),_N2(3*3){
+RankTwoTensor::RankTwoTensor(const RankTwoTensor &a){
     for(int i=0;i<_N2;++i){
         _vals[i]=a._vals[i];
     }
 }
 //***
-RankTwoTensor::RankTwoTensor(const InitMethod &method)
-:_N(3),_N2(3*3){
+RankTwoTensor::RankTwoTensor(const InitMethod &method){
     switch(method){
         case InitMethod::InitZero:
             SetToZeros();
@@ -60,8 +56,7 @@ RankTwoTensor::RankTwoTensor(const InitMethod &method)
 //***(for deformation gradient case)
 //*********************************************
 RankTwoTensor::RankTwoTensor(const Vector3d &r1,
-                             const Vector3d &r2)
-:_N(3),_N2(3*3){
+                             const Vector3d &r2){
     (*this)(1,1)=r1(1);(*this)(1,2)=r1(2);(*this)(1,3)=r1(3);
     (*this)(2,1)=r2(1);(*this)(2,2)=r2(2);(*this)(2,3)=r2(3);
 
@@ -69,29 +64,25 @@ RankTwoTensor::RankTwoTensor(const Vector3d &r1,
 }
 RankTwoTensor::RankTwoTensor(const Vector3d &r1,
                              const Vector3d &r2,
-                             const Vector3d &r3)
-:_N(3),_N2(3*3){
+                             const Vector3d &r3){
     (*this)(1,1)=r1(1);(*this)(1,2)=r1(2);(*this)(1,3)=r1(3);
     (*this)(2,1)=r2(1);(*this)(2,2)=r2(2);(*this)(2,3)=r2(3);
     (*this)(3,1)=r3(1);(*this)(3,2)=r3(2);(*this)(3,3)=r3(3);
 }
 //****(from voigt notation)
-RankTwoTensor::RankTwoTensor(const double &v11,const double &v22,const double &v12)
-:_N(3),_N2(3*3){
+RankTwoTensor::RankTwoTensor(const double &v11,const double &v22,const double &v12){
     (*this)(1,1)=v11;(*this)(1,2)=v12;(*this)(1,3)=0.0;
     (*this)(2,1)=v12;(*this)(2,2)=v22;(*this)(2,3)=0.0;
     (*this)(3,1)=0.0;(*this)(3,2)=0.0;(*this)(3,3)=0.0;
 }
 RankTwoTensor::RankTwoTensor(const double &v11,const double &v22,const double &v33,
-                             const double &v23,const double &v31,const double &v12)
-:_N(3),_N2(3*3){
+                             const double &v23,const double &v31,const double &v12){
     (*this)(1,1)=v11;(*this)(1,2)=v12;(*this)(1,3)=v31;
     (*this)(2,1)=v12;(*this)(2,2)=v22;(*this)(2,3)=v23;
     (*this)(3,1)=v31;(*this)(3,2)=v23;(*this)(3,3)=v33;
 }
 RankTwoTensor::RankTwoTensor(const double &v11,const double &v12,
-                             const double &v21,const double &v22)
-:_N(3),_N2(3*3){
+                             const double &v21,const double &v22){
     // for 2d voigt
     (*this)(1,1)=v11;(*this)(1,2)=v12;(*this)(1,3)=0.0;
     (*this)(2,1)=v21;(*this)(2,2)=v22;(*this)(2,3)=0.0;
@@ -99,8 +90,7 @@ RankTwoTensor::RankTwoTensor(const double &v11,const double &v12,
 }
 RankTwoTensor::RankTwoTensor(const double &v11,const double &v12,const double &v13,
                   const double &v21,const double &v22,const double &v23,
-                  const double &v31,const double &v32,const double &v33)
-:_N(3),_N2(3*3){
+                  const double &v31,const double &v32,const double &v33){
     // for 3d voigt
     (*this)(1,1)=v11;(*this)(1,2)=v12;(*this)(1,3)=v13;
     (*this)(2,1)=v21;(*this)(2,2)=v22;(*this)(2,3)=v23;
@@ -191,15 +181,7 @@ RankTwoTensor VecOTimes(const Vector3d &a,const Vector3d &b){
 RankFourTensor RankTwoTensor::OTimes(const RankTwoTensor &a) const{
     // return C_ijkl=a_ij*b_kl
     RankFourTensor temp(0.0);
-    for(int i=1;i<=_N;++i){
-        for(int j=1;j<=_N;++j){
-            for(int k=1;k<=_N;++k){
-                for(int l=1;l<=_N;++l){
-                    temp(i,j,k,l)=(*this)(i,j)*a(k,l);
-                }
-            }
-        }
-    }
+    temp.AddOTimes(1.0,*this,a);
     return temp;
 }
 //*** for mixed case
@@ -357,8 +339,19 @@ RankFourTensor RankTwoTensor::ODot(const RankTwoTensor &a) const{
 //*** stress and strain decomposition related functions
 //**************************************************************
 void RankTwoTensor::CalcEigenValueAndEigenVectors(double (&eigval)[3],RankTwoTensor &eigvec)const {
-    // TODO: change Eigen to Slepc?
-    // I must say, it is quite stupid, since we already have PETSc, why to call Eigen for eigen value?
+    // the strain and stress tensors are symmetric, for which the jacobi iteration is much cheaper
+    // and more robust(for the repeated eigen values) than the general eigen solver
+    double scale=0.0;
+    for(int i=0;i<_N2;++i){
+        if(abs(_vals[i])>scale) scale=abs(_vals[i]);
+    }
+    if(abs(_vals[1]-_vals[3])<=1.0e-12*scale&&
+       abs(_vals[2]-_vals[6])<=1.0e-12*scale&&
+       abs(_vals[5]-_vals[7])<=1.0e-12*scale){
+        CalcSymEigenValueAndEigenVectors(eigval,eigvec);
+        return;
+    }
+
     Eigen::Matrix3d _M;
 
     _M<<(*this)(1,1),(*this)(1,2),(*this)(1,3),
@@ -378,134 +371,129 @@ void RankTwoTensor::CalcEigenValueAndEigenVectors(double (&eigval)[3],RankTwoTen
     }
 }
 //***********************************************
-RankFourTensor RankTwoTensor::CalcPositiveProjTensor(double (&eigval)[3],RankTwoTensor &eigvec) const{
-    // remember, the eigen vec and eigen value should be used in your material
-    // code to calculate the stress and the related constitutive law
-
-    // Algorithm is taken from:
-    // C. Miehe and M. Lambrecht, Commun. Numer. Meth. Engng 2001; 17:337~353
-    // https://onlinelibrary.wiley.com/doi/epdf/10.1002/cnm.404
-
-    CalcEigenValueAndEigenVectors(eigval,eigvec);
+void RankTwoTensor::CalcSymEigenValueAndEigenVectors(double (&eigval)[3],RankTwoTensor &eigvec)const{
+    // the cyclic jacobi iteration for the symmetric 3x3 matrix, each rotation eliminates one
+    // off-diagonal term, it converges quadratically and the eigen vectors are always orthonormal,
+    // even for the repeated eigen values
+    const int pq[3][2]={{0,1},{0,2},{1,2}};
+    double a[3][3],v[3][3];
+    double scale,off,theta,t,c,s,tau,arp,arq,g;
+    int i,j,p,q,r,sweep;
 
-    // C=F^T F=lambda_i M_i where M_i=n_i x n_i
-    //         lambda_i-->eigenvalue  n_i--> the eigenvector
-
-    double epos[3],diag[3];
-    for(int i=0;i<_N;++i){
-        epos[i]=0.5*(abs(eigval[i])+eigval[i]);
-        diag[i]=0.0;
-        if(eigval[i]>0.0){
-            diag[i]=1.0;
+    scale=0.0;
+    for(i=0;i<_N;++i){
+        for(j=0;j<_N;++j){
+            a[i][j]=0.5*(_vals[i*_N+j]+_vals[j*_N+i]);
+            v[i][j]=(i==j)?1.0:0.0;
+            if(abs(a[i][j])>scale) scale=abs(a[i][j]);
         }
     }
-    RankFourTensor ProjPos(0.0);
-    RankTwoTensor Ma(0.0),Mb(0.0);
-
-    ProjPos.SetToZeros();
-
-    // calculate Ma defined in Eq.(9)-2
-    // Ma=n_a x n_a
-    for(int i=1;i<=_N;++i){
-        Ma.VectorOTimes(eigvec.IthCol(i),eigvec.IthCol(i));
-        // Eq.(19), first term on the right side
-        ProjPos+=Ma.OTimes(Ma)*diag[i-1];
-    }
-
-    // Now we calculate the Gab and Gba
-    // We need a new rank-2 tensor Mb(same defination as Ma)
-    double theta_ab;// defined in Eq.(21)-1
-    RankFourTensor Gab(0.0),Gba(0.0);
-    const double tol=1.0e-13;
-    for(int a=0;a<_N;++a){
-        for(int b=0;b<a;++b){
-            Ma.VectorOTimes(eigvec.IthCol(a+1),eigvec.IthCol(a+1));// Eq.(12)
-            Mb.VectorOTimes(eigvec.IthCol(b+1),eigvec.IthCol(b+1));// change the order of Eq.(12)
 
-            Gab=Ma.IkJlTimes(Mb)+Ma.IlJkTimes(Mb);
-            Gba=Mb.IkJlTimes(Ma)+Mb.IlJkTimes(Ma);
-            // since only positive term is involved
-            // e_a=0.5*(abs(lambda_a)+lambda_a)
-            // P is defined as: 2dE/dC in Eq.(8)-2
-            //  but 2dM/dC=(Gab+Gba)/(lambda_a-lambda_b)
-            // E(C)=sum(e_a*M_a)
-            // P=2dE(C)/dC=2(dE(C)/dM)*(dM/dC)
-            if(abs(eigval[a]-eigval[b])<=tol){
-                //if limit lambda_a to lambda_b in Eq.(24)
-                theta_ab=0.5*(diag[a]+diag[b])/2.0;
+    for(sweep=0;sweep<50&&scale>0.0;++sweep){
+        off=a[0][1]*a[0][1]+a[0][2]*a[0][2]+a[1][2]*a[1][2];
+        if(off<=1.0e-32*scale*scale) break;
+        for(r=0;r<3;++r){
+            p=pq[r][0];q=pq[r][1];
+            if(abs(a[p][q])<=1.0e-18*scale) continue;
+            theta=0.5*(a[q][q]-a[p][p])/a[p][q];
+            if(abs(theta)>1.0e150){
+                t=0.5/theta;
             }
             else{
-                // ea(lambda_a)=(1/2)*(lambda_a-1)
-                // m=2 for green strain case in Eq.(16)
-                theta_ab=0.5*(epos[a]-epos[b])/(eigval[a]-eigval[b]);// Eq.(21)-1
+                t=1.0/(abs(theta)+sqrt(theta*theta+1.0));
+                if(theta<0.0) t=-t;
+            }
+            c=1.0/sqrt(t*t+1.0);s=t*c;tau=s/(1.0+c);
+            g=a[p][q];
+            a[p][p]-=t*g;a[q][q]+=t*g;
+            a[p][q]=0.0;a[q][p]=0.0;
+            for(i=0;i<_N;++i){
+                if(i!=p&&i!=q){
+                    arp=a[i][p];arq=a[i][q];
+                    a[i][p]=arp-s*(arq+tau*arp);a[p][i]=a[i][p];
+                    a[i][q]=arq+s*(arp-tau*arq);a[q][i]=a[i][q];
+                }
+                arp=v[i][p];arq=v[i][q];
+                v[i][p]=arp-s*(arq+tau*arp);
+                v[i][q]=arq+s*(arp-tau*arq);
             }
-            ProjPos+=theta_ab*(Gab+Gba);
         }
     }
-    return ProjPos;
-}
 
-RankFourTensor RankTwoTensor::GetPositiveProjTensor() const{
-    double eigval[3];RankTwoTensor eigvec;
+    // sort the eigen values in ascending order, the columns of eigvec are the related eigen vectors
+    int order[3]={0,1,2};
+    if(a[order[0]][order[0]]>a[order[1]][order[1]]) swap(order[0],order[1]);
+    if(a[order[1]][order[1]]>a[order[2]][order[2]]) swap(order[1],order[2]);
+    if(a[order[0]][order[0]]>a[order[1]][order[1]]) swap(order[0],order[1]);
+    for(j=0;j<_N;++j){
+        eigval[j]=a[order[j]][order[j]];
+        for(i=0;i<_N;++i) eigvec._vals[i*_N+j]=v[i][order[j]];
+    }
+}
+//***********************************************
+void RankTwoTensor::FillPositiveProjTensor(const double (&eigval)[3],const RankTwoTensor &eigvec,RankFourTensor &ProjPos){
     // Algorithm is taken from:
     // C. Miehe and M. Lambrecht, Commun. Numer. Meth. Engng 2001; 17:337~353
     // https://onlinelibrary.wiley.com/doi/epdf/10.1002/cnm.404
+    // P=sum_a H(lambda_a) M_a x M_a + sum_(a>b) theta_ab (G_ab+G_ba)
+    // where M_a=n_a x n_a, G_ab(i,j,k,l)=Ma(i,k)*Mb(j,l)+Ma(i,l)*Mb(j,k), Eq.(19)
+    // all the terms are accumulated in one pass, no temporary rank-4 tensor is needed
+    const double tol=1.0e-13;
+    double M[3][3][3],diag[3],epos[3],theta[3][3];
+    double val;
+    int a,b,i,j,k,l;
 
-    CalcEigenValueAndEigenVectors(eigval,eigvec);
-
-    // C=F^T F=lambda_i M_i where M_i=n_i x n_i
-    //         lambda_i-->eigenvalue  n_i--> the eigenvector
-
-    double epos[3],diag[3];
-    for(int i=0;i<_N;++i){
-        epos[i]=0.5*(abs(eigval[i])+eigval[i]);
-        diag[i]=0.0;
-        if(eigval[i]>0.0){
-            diag[i]=1.0;
+    for(a=0;a<3;++a){
+        epos[a]=0.5*(abs(eigval[a])+eigval[a]);
+        diag[a]=(eigval[a]>0.0)?1.0:0.0;
+        for(i=0;i<3;++i){
+            for(j=0;j<3;++j) M[a][i][j]=eigvec._vals[i*3+a]*eigvec._vals[j*3+a];
         }
     }
-    RankFourTensor ProjPos(0.0);
-    RankTwoTensor Ma(0.0),Mb(0.0);
-
-    ProjPos.SetToZeros();
-
-    // calculate Ma defined in Eq.(9)-2
-    // Ma=n_a x n_a
-    for(int i=1;i<=_N;++i){
-        Ma.VectorOTimes(eigvec.IthCol(i),eigvec.IthCol(i));
-        // Eq.(19), first term on the right side
-        ProjPos+=Ma.OTimes(Ma)*diag[i-1];
-    }
-
-    // Now we calculate the Gab and Gba
-    // We need a new rank-2 tensor Mb(same defination as Ma)
-    double theta_ab;// defined in Eq.(21)-1
-    RankFourTensor Gab(0.0),Gba(0.0);
-    const double tol=1.0e-13;
-    for(int a=0;a<_N;++a){
-        for(int b=0;b<a;++b){
-            Ma.VectorOTimes(eigvec.IthCol(a+1),eigvec.IthCol(a+1));// Eq.(12)
-            Mb.VectorOTimes(eigvec.IthCol(b+1),eigvec.IthCol(b+1));// change the order of Eq.(12)
-
-            Gab=Ma.IkJlTimes(Mb)+Ma.IlJkTimes(Mb);
-            Gba=Mb.IkJlTimes(Ma)+Mb.IlJkTimes(Ma);
-            // since only positive term is involved
-            // e_a=0.5*(abs(lambda_a)+lambda_a)
-            // P is defined as: 2dE/dC in Eq.(8)-2
-            //  but 2dM/dC=(Gab+Gba)/(lambda_a-lambda_b)
-            // E(C)=sum(e_a*M_a)
-            // P=2dE(C)/dC=2(dE(C)/dM)*(dM/dC)
+    for(a=0;a<3;++a){
+        for(b=0;b<a;++b){
             if(abs(eigval[a]-eigval[b])<=tol){
                 //if limit lambda_a to lambda_b in Eq.(24)
-                theta_ab=0.5*(diag[a]+diag[b])/2.0;
+                theta[a][b]=0.5*(diag[a]+diag[b])/2.0;
             }
             else{
-                // ea(lambda_a)=(1/2)*(lambda_a-1)
-                // m=2 for green strain case in Eq.(16)
-                theta_ab=0.5*(epos[a]-epos[b])/(eigval[a]-eigval[b]);// Eq.(21)-1
+                theta[a][b]=0.5*(epos[a]-epos[b])/(eigval[a]-eigval[b]);// Eq.(21)-1
             }
-            ProjPos+=theta_ab*(Gab+Gba);
         }
     }
+    for(i=0;i<3;++i){
+        for(j=0;j<3;++j){
+            for(k=0;k<3;++k){
+                for(l=0;l<3;++l){
+                    val=diag[0]*M[0][i][j]*M[0][k][l]
+                       +diag[1]*M[1][i][j]*M[1][k][l]
+                       +diag[2]*M[2][i][j]*M[2][k][l];
+                    for(a=1;a<3;++a){
+                        for(b=0;b<a;++b){
+                            val+=theta[a][b]*(M[a][i][k]*M[b][j][l]+M[a][i][l]*M[b][j][k]
+                                             +M[b][i][k]*M[a][j][l]+M[b][i][l]*M[a][j][k]);
+                        }
+                    }
+                    ProjPos[((i*3+j)*3+k)*3+l+1]=val;
+                }
+            }
+        }
+    }
+}
+//***********************************************
+RankFourTensor RankTwoTensor::CalcPositiveProjTensor(double (&eigval)[3],RankTwoTensor &eigvec) const{
+    // remember, the eigen vec and eigen value should be used in your material
+    // code to calculate the stress and the related constitutive law
+    RankFourTensor ProjPos(0.0);
+    CalcEigenValueAndEigenVectors(eigval,eigvec);
+    FillPositiveProjTensor(eigval,eigvec,ProjPos);
+    return ProjPos;
+}
+//***********************************************
+RankFourTensor RankTwoTensor::GetPositiveProjTensor() const{
+    double eigval[3];RankTwoTensor eigvec;
+    RankFourTensor ProjPos(0.0);
+    CalcEigenValueAndEigenVectors(eigval,eigvec);
+    FillPositiveProjTensor(eigval,eigvec,ProjPos);
     return ProjPos;
 }
@@ -0,0 +1,189 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.06
+//+++ Purpose: Implement the minor-symmetric rank-4 tensor in the
+//+++          Mandel notation
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "Utils/SymmetricRankFourTensor.h"
+
+// the rank-2 index pair of each Mandel index
+const static int MandelPair[6][2]={{1,1},{2,2},{3,3},{2,3},{1,3},{1,2}};
+
+SymmetricRankFourTensor::SymmetricRankFourTensor(){
+    for(int i=0;i<_N;++i) _vals[i]=0.0;
+}
+SymmetricRankFourTensor::SymmetricRankFourTensor(const double &val){
+    for(int i=0;i<_N;++i) _vals[i]=val;
+}
+SymmetricRankFourTensor::SymmetricRankFourTensor(const SymmetricRankFourTensor &a){
+    for(int i=0;i<_N;++i) _vals[i]=a._vals[i];
+}
+SymmetricRankFourTensor::SymmetricRankFourTensor(const RankFourTensor &a){
+    int i,j,k,l;
+    for(int I=1;I<=6;++I){
+        i=MandelPair[I-1][0];j=MandelPair[I-1][1];
+        for(int J=1;J<=6;++J){
+            k=MandelPair[J-1][0];l=MandelPair[J-1][1];
+            MandelIJ(I,J)=0.25*(a(i,j,k,l)+a(j,i,k,l)+a(i,j,l,k)+a(j,i,l,k))
+                         *MandelWeight(I)*MandelWeight(J);
+        }
+    }
+}
+//***************************************************
+RankFourTensor SymmetricRankFourTensor::ToRankFourTensor()const{
+    RankFourTensor temp(0.0);
+    for(int i=1;i<=3;++i){
+        for(int j=1;j<=3;++j){
+            for(int k=1;k<=3;++k){
+                for(int l=1;l<=3;++l){
+                    temp(i,j,k,l)=(*this)(i,j,k,l);
+                }
+            }
+        }
+    }
+    return temp;
+}
+//***************************************************
+SymmetricRankFourTensor operator*(const double &lhs,const SymmetricRankFourTensor &a){
+    SymmetricRankFourTensor temp(0.0);
+    for(int i=0;i<a._N;++i) temp._vals[i]=lhs*a._vals[i];
+    return temp;
+}
+//***************************************************
+void SymmetricRankFourTensor::ToMandelVector(const RankTwoTensor &a,double (&v)[6]){
+    v[0]=a(1,1);v[1]=a(2,2);v[2]=a(3,3);
+    v[3]=M_SQRT1_2*(a(2,3)+a(3,2));
+    v[4]=M_SQRT1_2*(a(1,3)+a(3,1));
+    v[5]=M_SQRT1_2*(a(1,2)+a(2,1));
+}
+//***************************************************
+double SymmetricRankFourTensor::GetIKjlComponent(const int &i,const int &k,
+                                                 const Vector3d &grad_test,
+                                                 const Vector3d &grad_trial)const{
+    // K_ik=C_ijkl*N,j*N,l, all the 9 components are read from the Mandel matrix
+    if(i<1||i>3 || k<1 || k>3){
+        MessagePrinter::PrintErrorTxt(" your i or k is out of range for GetIKjlComponent function");
+        MessagePrinter::AsFem_Exit();
+    }
+    int I,J;
+    double sum=0.0,rowsum;
+    for(int j=1;j<=3;++j){
+        I=MandelIndex(i,j);
+        rowsum=0.0;
+        for(int l=1;l<=3;++l){
+            J=MandelIndex(k,l);
+            rowsum+=_vals[(I-1)*6+J-1]/MandelWeight(J)*grad_trial(l);
+        }
+        sum+=rowsum/MandelWeight(I)*grad_test(j);
+    }
+    return sum;
+}
+//***************************************************
+RankTwoTensor SymmetricRankFourTensor::DoubleDot(const RankTwoTensor &a) const{
+    double v[6],s[6];
+    RankTwoTensor temp(0.0);
+    ToMandelVector(a,v);
+    for(int I=0;I<6;++I){
+        s[I]=0.0;
+        for(int J=0;J<6;++J) s[I]+=_vals[I*6+J]*v[J];
+    }
+    temp(1,1)=s[0];temp(2,2)=s[1];temp(3,3)=s[2];
+    temp(2,3)=s[3]*M_SQRT1_2;temp(3,2)=temp(2,3);
+    temp(1,3)=s[4]*M_SQRT1_2;temp(3,1)=temp(1,3);
+    temp(1,2)=s[5]*M_SQRT1_2;temp(2,1)=temp(1,2);
+    return temp;
+}
+//***************************************************
+SymmetricRankFourTensor SymmetricRankFourTensor::DoubleDot(const SymmetricRankFourTensor &a) const{
+    SymmetricRankFourTensor temp(0.0);
+    for(int I=0;I<6;++I){
+        for(int K=0;K<6;++K){
+            for(int J=0;J<6;++J){
+                temp._vals[I*6+J]+=_vals[I*6+K]*a._vals[K*6+J];
+            }
+        }
+    }
+    return temp;
+}
+//***************************************************
+SymmetricRankFourTensor SymmetricRankFourTensor::Rotate(const RankTwoTensor &rotate) const{
+    // the rotation of the symmetric rank-2 tensor in Mandel notation is a 6x6 orthogonal matrix Q,
+    // then C'=Q*C*Q^T, which costs 2*6^3 instead of 3^8 for the general rank-4 tensor
+    double Q[6][6],QC[6][6];
+    int i,j,k,l;
+    for(int I=0;I<6;++I){
+        i=MandelPair[I][0];j=MandelPair[I][1];
+        for(int J=0;J<6;++J){
+            k=MandelPair[J][0];l=MandelPair[J][1];
+            if(J<3){
+                Q[I][J]=MandelWeight(I+1)*rotate(i,k)*rotate(j,k);
+            }
+            else{
+                Q[I][J]=MandelWeight(I+1)*M_SQRT1_2*(rotate(i,k)*rotate(j,l)+rotate(i,l)*rotate(j,k));
+            }
+        }
+    }
+    for(int I=0;I<6;++I){
+        for(int J=0;J<6;++J){
+            QC[I][J]=0.0;
+            for(int K=0;K<6;++K) QC[I][J]+=Q[I][K]*_vals[K*6+J];
+        }
+    }
+    SymmetricRankFourTensor temp(0.0);
+    for(int I=0;I<6;++I){
+        for(int J=0;J<6;++J){
+            for(int K=0;K<6;++K) temp._vals[I*6+J]+=QC[I][K]*Q[J][K];
+        }
+    }
+    return temp;
+}
+//***************************************************
+bool SymmetricRankFourTensor::IsMajorSymmetric(const double &tol)const{
+    double scale=0.0;
+    for(int i=0;i<_N;++i){
+        if(abs(_vals[i])>scale) scale=abs(_vals[i]);
+    }
+    for(int I=0;I<6;++I){
+        for(int J=0;J<I;++J){
+            if(abs(_vals[I*6+J]-_vals[J*6+I])>tol*scale) return false;
+        }
+    }
+    return true;
+}
+//***************************************************
+void SymmetricRankFourTensor::SetFromOTimes(const RankTwoTensor &a,const RankTwoTensor &b){
+    double va[6],vb[6];
+    ToMandelVector(a,va);
+    ToMandelVector(b,vb);
+    for(int I=0;I<6;++I){
+        for(int J=0;J<6;++J) _vals[I*6+J]=va[I]*vb[J];
+    }
+}
+//***************************************************
+void SymmetricRankFourTensor::SetFromLameandG(const double &Lame,const double &G){
+    // C_ijkl = Lame*de_ij*de_kl + G*(de_ik*de_jl + de_il*de_jk)
+    // in Mandel notation: Lame for the upper-left 3x3 block plus 2G on the diagonal
+    SetToZeros();
+    for(int I=1;I<=3;++I){
+        for(int J=1;J<=3;++J) MandelIJ(I,J)=Lame;
+    }
+    for(int I=1;I<=6;++I) MandelIJ(I,I)+=2.0*G;
+}
+void SymmetricRankFourTensor::SetFromEandNu(const double &E,const double &Nu){
+    double Lame=E*Nu/((1.0+Nu)*(1.0-2.0*Nu));
+    double G=E/(2.0*(1.0+Nu));
+    SetFromLameandG(Lame,G);
+}
+void SymmetricRankFourTensor::SetFromKandG(const double &K,const double &G){
+    double Lame=K-2.0*G/3.0;
+    SetFromLameandG(Lame,G);
+}
@@ -0,0 +1,78 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.15
+//+++ Purpose: Implement the memory usage of the PETSc objects and
+//+++          the report of all the components
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "Utils/MemoryUsage.h"
+
+double MemoryUsage::Of(const Vec &v){
+    if(v==NULL) return 0.0;
+    PetscInt n;
+    Vec lv;
+    VecGhostGetLocalForm(v,&lv);
+    if(lv){
+        // the ghosted vector, the ghost part is stored together with the local part
+        VecGetSize(lv,&n);
+        VecGhostRestoreLocalForm(v,&lv);
+    }
+    else{
+        VecGetLocalSize(v,&n);
+    }
+    return static_cast<double>(n*sizeof(PetscScalar));
+}
+//*******************************************************
+double MemoryUsage::GetMatNNZ(const Mat &A){
+    if(A==NULL) return 0.0;
+    MatInfo info;
+    MatGetInfo(A,MAT_LOCAL,&info);
+    return info.nz_allocated;
+}
+//*******************************************************
+double MemoryUsage::Of(const Mat &A){
+    if(A==NULL) return 0.0;
+    PetscInt nrows,ncols;
+    MatGetLocalSize(A,&nrows,&ncols);
+    // the AIJ(CSR) format: the values, the column indices and the row offsets
+    return GetMatNNZ(A)*(sizeof(PetscScalar)+sizeof(PetscInt))+(nrows+1)*sizeof(PetscInt);
+}
+//*******************************************************
+double MemoryUsage::GetCurrentUsage(){
+    PetscLogDouble mem;
+    PetscMemoryGetCurrentUsage(&mem);
+    return mem;
+}
+//*******************************************************
+void MemoryUsage::ReduceRecords(const vector<MemoryRecord> &records,vector<double> &maxbytes,vector<double> &sumbytes){
+    const int n=static_cast<int>(records.size());
+    vector<double> local(n,0.0);
+    maxbytes.resize(n,0.0);
+    sumbytes.resize(n,0.0);
+    for(int i=0;i<n;i++) local[i]=records[i].Bytes;
+    if(n<1) return;
+    MPI_Allreduce(local.data(),maxbytes.data(),n,MPI_DOUBLE,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(local.data(),sumbytes.data(),n,MPI_DOUBLE,MPI_SUM,PETSC_COMM_WORLD);
+}
+//*******************************************************
+void MemoryUsage::PrintReport(const string &title,const vector<MemoryRecord> &records,
+                              const vector<double> &maxbytes,const vector<double> &sumbytes,
+                              MessageColor color){
+    char buff[70];
+    MessagePrinter::PrintNormalTxt(title,color);
+    snprintf(buff,70,"  %-22s%18s%18s","Component","Max/rank[MB]","Sum[MB]");
+    MessagePrinter::PrintNormalTxt(buff,color);
+    for(int i=0;i<static_cast<int>(records.size());i++){
+        snprintf(buff,70,"  %-22s%18.3f%18.3f",records[i].Name.substr(0,22).c_str(),
+                 maxbytes[i]/1.0e6,sumbytes[i]/1.0e6);
+        MessagePrinter::PrintNormalTxt(buff,color);
+    }
+}
@@ -0,0 +1,213 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.10
+//+++ Purpose: Implement the per-subsystem profiler
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <fstream>
+
+#include "Utils/Profiler.h"
+
+bool Profiler::_IsActive=false;
+double Profiler::_StartTime=0.0;
+long int Profiler::_nSolves=0;
+long int Profiler::_nFailedSolves=0;
+long int Profiler::_SNESIters=0;
+long int Profiler::_KSPIters=0;
+double Profiler::_MaxPeakMemory=0.0;
+double Profiler::_SumPeakMemory=0.0;
+vector<Profiler::MemoryStage> Profiler::_MemoryStages;
+PetscClassId Profiler::_ClassId=0;
+PetscLogEvent Profiler::_Events[Profiler::_nEvents]={0,0,0,0,0,0,0,0};
+const char *Profiler::_EventNames[Profiler::_nEvents]={"FormResidual","FormJacobian","UpdateMaterial",
+                                                       "ApplyBC","Projection","Output",
+                                                       "Postprocess","CheckPoint"};
+
+// the PETSc built-in events to be reported together with the AsFem ones
+const static int nPetscEvents=6;
+const static char *PetscEventNames[nPetscEvents]={"SNESSolve","KSPSolve","PCSetUp",
+                                                  "PCApply","MatAssemblyEnd","VecScatterBegin"};
+
+//*******************************************************
+void Profiler::Init(const bool &enable){
+    // the events must be registered even if the profiling is disabled, then the Begin/End calls are
+    // just the cheap checks inside PETSc
+    PetscClassIdRegister("AsFem",&_ClassId);
+    for(int i=0;i<_nEvents;i++){
+        PetscLogEventRegister(_EventNames[i],_ClassId,&_Events[i]);
+    }
+    // make sure all the built-in events are registered, even in the read-only mode
+    SNESInitializePackage();
+    _IsActive=enable;
+    if(_IsActive){
+        PetscLogDefaultBegin();
+        // the peak memory is only tracked after this call
+        PetscMemorySetGetMaximumUsage();
+        _StartTime=MPI_Wtime();
+    }
+}
+//*******************************************************
+void Profiler::CollectRecord(const string &name,const PetscLogEvent &event,vector<ProfileRecord> &records){
+    PetscEventPerfInfo info;
+    double local[5],global[5];
+    int count;
+    // all the events are logged in the main stage
+    PetscLogEventGetPerfInfo(0,event,&info);
+    local[0]=info.time;
+    local[1]=info.flops;
+    local[2]=info.numMessages;
+    local[3]=info.messageLength;
+    local[4]=info.numReductions;
+    MPI_Allreduce(&local[0],&global[0],1,MPI_DOUBLE,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(&local[1],&global[1],4,MPI_DOUBLE,MPI_SUM,PETSC_COMM_WORLD);
+    MPI_Allreduce(&info.count,&count,1,MPI_INT,MPI_MAX,PETSC_COMM_WORLD);
+    // the reductions are collective, the summed one is the number of ranks times the real one
+    int size;
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    global[4]/=size;
+
+    records.push_back(ProfileRecord{name,count,global[0],global[1],global[2],global[3],global[4]});
+}
+//*******************************************************
+void Profiler::SetMemoryRecords(const string &stage,const int &step,const vector<MemoryRecord> &records){
+    for(auto &it:_MemoryStages){
+        if(it.Name==stage){
+            it.Step=step;
+            it.Records=records;
+            return;
+        }
+    }
+    _MemoryStages.push_back(MemoryStage{stage,step,records,{},{}});
+}
+//*******************************************************
+void Profiler::Finalize(const string &jsonfilename){
+    if(!_IsActive) return;
+
+    vector<ProfileRecord> records;
+    PetscLogEvent event;
+    double localtime,totaltime;
+
+    localtime=MPI_Wtime()-_StartTime;
+    MPI_Allreduce(&localtime,&totaltime,1,MPI_DOUBLE,MPI_MAX,PETSC_COMM_WORLD);
+    records.push_back(ProfileRecord{"Total",1,totaltime,0.0,0.0,0.0,0.0});
+
+    // the peak resident set size of each rank, in bytes
+    PetscLogDouble localmem;
+    PetscMemoryGetMaximumUsage(&localmem);
+    MPI_Allreduce(&localmem,&_MaxPeakMemory,1,MPI_DOUBLE,MPI_MAX,PETSC_COMM_WORLD);
+    MPI_Allreduce(&localmem,&_SumPeakMemory,1,MPI_DOUBLE,MPI_SUM,PETSC_COMM_WORLD);
+    for(auto &it:_MemoryStages){
+        MemoryUsage::ReduceRecords(it.Records,it.MaxBytes,it.SumBytes);
+    }
+
+    for(int i=0;i<_nEvents;i++){
+        CollectRecord(_EventNames[i],_Events[i],records);
+    }
+    for(int i=0;i<nPetscEvents;i++){
+        PetscLogEventGetId(PetscEventNames[i],&event);
+        CollectRecord(PetscEventNames[i],event,records);
+    }
+
+    PrintSummary(records);
+    if(jsonfilename.size()>0) WriteJsonFile(jsonfilename,records);
+    _IsActive=false;
+}
+//*******************************************************
+void Profiler::PrintSummary(const vector<ProfileRecord> &records){
+    char buff[80];
+    const double totaltime=records[0].Time;
+
+    MessagePrinter::PrintStars(MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("Profiling summary(max time over the ranks, the others are summed)",MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("the time of each event includes the ones of its nested events",MessageColor::BLUE);
+    MessagePrinter::PrintDashLine(MessageColor::BLUE);
+    snprintf(buff,80,"%-16s%7s%11s%6s%10s%9s%9s","Event","Count","Time[s]","%T","MFlops","Msgs","Msg[MB]");
+    MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    MessagePrinter::PrintDashLine(MessageColor::BLUE);
+    for(const auto &it:records){
+        // skip the events which are never triggered, i.e. the projection for the problems without [projection]
+        if(it.Count<1) continue;
+        snprintf(buff,80,"%-16s%7d%11.3e%6.1f%10.3e%9.2e%9.2e",
+                 it.Name.c_str(),it.Count,it.Time,
+                 totaltime>0.0?100.0*it.Time/totaltime:0.0,
+                 it.Flops/1.0e6,it.Messages,it.MessageLength/1.0e6);
+        MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    }
+    MessagePrinter::PrintDashLine(MessageColor::BLUE);
+    snprintf(buff,80,"solves=%ld, failed=%ld, SNES iters=%ld, KSP iters=%ld",
+             _nSolves,_nFailedSolves,_SNESIters,_KSPIters);
+    MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    snprintf(buff,80,"peak memory: max=%10.3e MB(per rank), sum=%10.3e MB",
+             _MaxPeakMemory/1.0e6,_SumPeakMemory/1.0e6);
+    MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    for(const auto &it:_MemoryStages){
+        MessagePrinter::PrintDashLine(MessageColor::BLUE);
+        snprintf(buff,80,"memory usage at %s(step=%d)",it.Name.c_str(),it.Step);
+        MemoryUsage::PrintReport(buff,it.Records,it.MaxBytes,it.SumBytes,MessageColor::BLUE);
+    }
+    MessagePrinter::PrintStars(MessageColor::BLUE);
+}
+//*******************************************************
+void Profiler::WriteJsonFile(const string &jsonfilename,const vector<ProfileRecord> &records){
+    int rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    if(rank!=0) return;
+
+    ofstream out;
+    out.open(jsonfilename,ios::out);
+    if(!out.is_open()){
+        MessagePrinter::PrintWarningTxt("can\'t write the profiling result to "+jsonfilename);
+        return;
+    }
+    out<<scientific<<setprecision(9);
+    out<<"{\n";
+    out<<"  \"nprocs\": "<<size<<",\n";
+    out<<"  \"total_time\": "<<records[0].Time<<",\n";
+    out<<"  \"solves\": "<<_nSolves<<",\n";
+    out<<"  \"failed_solves\": "<<_nFailedSolves<<",\n";
+    out<<"  \"snes_iterations\": "<<_SNESIters<<",\n";
+    out<<"  \"ksp_iterations\": "<<_KSPIters<<",\n";
+    out<<"  \"max_peak_memory\": "<<_MaxPeakMemory<<",\n";
+    out<<"  \"sum_peak_memory\": "<<_SumPeakMemory<<",\n";
+    out<<"  \"memory\": [\n";
+    for(int k=0;k<static_cast<int>(_MemoryStages.size());k++){
+        const MemoryStage &stage=_MemoryStages[k];
+        out<<"    {\"stage\": \""<<stage.Name<<"\", \"step\": "<<stage.Step<<", \"components\": [\n";
+        for(int i=0;i<static_cast<int>(stage.Records.size());i++){
+            out<<"      {\"name\": \""<<stage.Records[i].Name<<"\", "
+               <<"\"max\": "<<stage.MaxBytes[i]<<", "
+               <<"\"sum\": "<<stage.SumBytes[i]<<"}";
+            if(i<static_cast<int>(stage.Records.size())-1) out<<",";
+            out<<"\n";
+        }
+        out<<"    ]}";
+        if(k<static_cast<int>(_MemoryStages.size())-1) out<<",";
+        out<<"\n";
+    }
+    out<<"  ],\n";
+    out<<"  \"events\": [\n";
+    for(int i=1;i<static_cast<int>(records.size());i++){
+        out<<"    {\"name\": \""<<records[i].Name<<"\", "
+           <<"\"count\": "<<records[i].Count<<", "
+           <<"\"time\": "<<records[i].Time<<", "
+           <<"\"flops\": "<<records[i].Flops<<", "
+           <<"\"messages\": "<<records[i].Messages<<", "
+           <<"\"message_length\": "<<records[i].MessageLength<<", "
+           <<"\"reductions\": "<<records[i].Reductions<<"}";
+        if(i<static_cast<int>(records.size())-1) out<<",";
+        out<<"\n";
+    }
+    out<<"  ]\n";
+    out<<"}\n";
+    out.close();
+    MessagePrinter::PrintNormalTxt("Profiling result is written to "+jsonfilename);
+}
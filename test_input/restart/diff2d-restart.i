@@ -0,0 +1,71 @@
+// this is a test input file for the checkpoint/restart, see scripts/RestartTest.py
+// the zero initial condition and the fixed step size are used, so the restarted run can be compared with the full one
+
+[mesh]
+  type=asfem
+  dim=2
+  nx=20
+  ny=20
+  meshtype=quad4
+[end]
+
+[dofs]
+name=c
+[end]
+
+[elmts]
+  [elmt1]
+    type=diffusion
+    dofs=c
+    mate=mate1
+  [end]
+[end]
+
+[mates]
+  [mate1]
+    type=constdiffusion
+    params=1.0
+  [end]
+[end]
+
+[timestepping]
+  type=be
+  dt=1.0e-3
+  time=1.45e-2
+  adaptive=false
+  checkpointinterval=2
+  checkpointkeep=4
+[end]
+
+[bcs]
+  [fixleft]
+    type=dirichlet
+    dofs=c
+    value=1.0
+    boundary=left
+  [end]
+  [fixright]
+    type=dirichlet
+    dofs=c
+    value=0.0
+    boundary=right
+  [end]
+[end]
+
+[postprocess]
+  [totalc]
+    type=elementalintegral
+    dof=c
+    domain=alldomain
+  [end]
+  [nodec]
+    type=nodevalue
+    dof=c
+    nodeid=200
+  [end]
+[end]
+
+[job]
+  type=transient
+  debug=dep
+[end]
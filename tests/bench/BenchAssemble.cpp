@@ -0,0 +1,137 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: the macrobenchmarks of FormBulkFE, the problem is
+//+++          set up from a generated input file by FEProblem, so
+//+++          all the components are initialized in the same way
+//+++          as the simulation
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <fstream>
+#include <cstdio>
+
+#include "BenchSuites.h"
+
+#include "FEProblem/FEProblem.h"
+
+/**
+ * write the input file of the mechanics problem on a [0,1]^dim mesh
+ */
+static void WriteBenchInputFile(const string &filename,const int &dim,const int &n,
+                                const string &matetype,const string &params){
+    ofstream out;
+    out.open(filename,ios::out);
+    out<<"[mesh]\n";
+    out<<"  type=asfem\n";
+    out<<"  dim="<<dim<<"\n";
+    out<<"  nx="<<n<<"\n";
+    out<<"  ny="<<n<<"\n";
+    if(dim==3) out<<"  nz="<<n<<"\n";
+    out<<"  meshtype="<<(dim==2?"quad4":"hex8")<<"\n";
+    out<<"[end]\n";
+    out<<"[dofs]\n";
+    out<<(dim==2?"name=ux uy\n":"name=ux uy uz\n");
+    out<<"[end]\n";
+    out<<"[elmts]\n";
+    out<<"  [elmt1]\n";
+    out<<"    type=mechanics\n";
+    out<<(dim==2?"    dofs=ux uy\n":"    dofs=ux uy uz\n");
+    out<<"    mate=mate1\n";
+    out<<"  [end]\n";
+    out<<"[end]\n";
+    out<<"[mates]\n";
+    out<<"  [mate1]\n";
+    out<<"    type="<<matetype<<"\n";
+    out<<"    params="<<params<<"\n";
+    out<<"  [end]\n";
+    out<<"[end]\n";
+    out<<"[bcs]\n";
+    out<<"  [fixux]\n";
+    out<<"    type=dirichlet\n";
+    out<<"    dofs=ux\n";
+    out<<"    value=0.0\n";
+    out<<"    boundary=left\n";
+    out<<"  [end]\n";
+    out<<"[end]\n";
+    out<<"[job]\n";
+    out<<"  type=static\n";
+    out<<"[end]\n";
+    out.close();
+}
+
+/**
+ * run the residual and jacobian sweep of one problem
+ */
+static void RunFormBulkFEBenchmark(Benchmark &bench,const string &name,const int &dim,const int &n,
+                                   const string &matetype,const string &params){
+    if(!bench.IsSelected("assemble",name+"-residual")&&
+       !bench.IsSelected("assemble",name+"-jacobian")) return;
+
+    const string inputfilename="asfem-bench-"+name+".i";
+    PetscMPIInt rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    if(rank==0) WriteBenchInputFile(inputfilename,dim,n,matetype,params);
+    MPI_Barrier(PETSC_COMM_WORLD);
+
+    // the problem is set up by FEProblem, then the bulk element loop runs in the same way as the simulation
+    FEProblem feProblem;
+    char arg0[]="asfem-bench",arg1[]="-i";
+    vector<char> arg2(inputfilename.begin(),inputfilename.end());
+    arg2.push_back('\0');
+    char *argv[3]={arg0,arg1,arg2.data()};
+    feProblem.InitFEProblem(3,argv);
+    feProblem.Setup();
+    MPI_Barrier(PETSC_COMM_WORLD);
+    if(rank==0) remove(inputfilename.c_str());
+
+    // a random displacement field, so the plastic materials are in the plastic state
+    SolutionSystem &solutionSystem=feProblem.GetSolutionSystem();
+    PetscRandom rnd;
+    PetscRandomCreate(PETSC_COMM_WORLD,&rnd);
+    PetscRandomSetSeed(rnd,2022);
+    PetscRandomSeed(rnd);
+    VecSetRandom(solutionSystem._Utemp,rnd);
+    VecScale(solutionSystem._Utemp,1.0e-2/n);
+    VecCopy(solutionSystem._Utemp,solutionSystem._U);
+    VecCopy(solutionSystem._Utemp,solutionSystem._Unew);
+    PetscRandomDestroy(&rnd);
+
+    const double nElmts=feProblem.GetMesh().GetBulkMeshBulkElmtsNum();
+    feProblem.FormBulkSystem(FECalcType::InitMaterial,0.0,1.0);
+    solutionSystem.UpdateMaterials();
+
+    // the scratch arrays of the element loop are allocated once in InitBulkFESystem, so there should be no
+    // operator new at all during the assembly(PETSc allocates through PetscMalloc, which is not counted)
+    auto CheckAllocations=[&](const string &benchname){
+        if(!bench.IsSelected("assemble",benchname)) return;
+        if(bench.GetLastAllocsPerOp()>0.0){
+            MessagePrinter::PrintWarningTxt("heap allocations are found inside the element loop of assemble/"+benchname
+                                            +"("+to_string(bench.GetLastAllocsPerOp())+" per element)");
+        }
+    };
+    bench.Run("assemble",name+"-residual",nElmts,"elmt",[&](){
+        feProblem.FormBulkSystem(FECalcType::ComputeResidual,1.0,1.0);
+    });
+    CheckAllocations(name+"-residual");
+    bench.Run("assemble",name+"-jacobian",nElmts,"elmt",[&](){
+        feProblem.FormBulkSystem(FECalcType::ComputeJacobian,1.0,1.0);
+    });
+    CheckAllocations(name+"-jacobian");
+
+    feProblem.Finalize();
+}
+
+void RunAssembleBenchmarks(Benchmark &bench,const int &n2d,const int &n3d){
+    RunFormBulkFEBenchmark(bench,"quad4-linearelastic",2,n2d,"linearelastic","210.0 0.3");
+    RunFormBulkFEBenchmark(bench,"quad4-neohookean",2,n2d,"neohookean","210.0 0.3");
+    RunFormBulkFEBenchmark(bench,"hex8-linearelastic",3,n3d,"linearelastic","210.0 0.3");
+    RunFormBulkFEBenchmark(bench,"hex8-j2plasticity",3,n3d,"j2plasticity","210.0 0.3 0.55 5.0");
+}
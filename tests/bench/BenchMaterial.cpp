@@ -0,0 +1,132 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: the microbenchmarks of the built-in materials, the
+//+++          materials are called via RunBulkMateLibs, which is
+//+++          the same path used by FormBulkFE
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "BenchSuites.h"
+
+#include "MateSystem/MateSystem.h"
+#include "Utils/ScratchArena.h"
+
+/**
+ * the material system with the access to the old materials, then the history variables can be initialized
+ */
+class BenchMateSystem:public MateSystem{
+public:
+    void UpdateOldMaterials(){_MaterialsOld=_Materials;}
+};
+
+/**
+ * the settings of one built-in material
+ */
+struct BenchMateInfo{
+    string Name;
+    MateType Type;
+    int nDim;
+    vector<double> Params;
+};
+
+void RunMaterialBenchmarks(Benchmark &bench){
+    const vector<BenchMateInfo> matelist={
+        {"ConstPoisson",MateType::CONSTPOISSONMATE,2,{1.0,1.0}},
+        {"ConstDiffusion",MateType::CONSTDIFFUSIONMATE,2,{1.0}},
+        {"DoubleWellFreeEnergy",MateType::DOUBLEWELLFREENERGYMATE,2,{1.0,0.0,1.0,1.0,0.01}},
+        {"IdealSolutionFreeEnergy",MateType::IDEALSOLUTIONFREENERGYMATE,2,{1.0,2.5,0.01}},
+        {"LinearElastic",MateType::LINEARELASTICMATE,3,{210.0,0.3}},
+        {"IncrementSmallStrain",MateType::INCREMENTSMALLSTRAINMATE,3,{210.0,0.3}},
+        {"SaintVenant",MateType::SAINTVENANTMATE,3,{210.0,0.3}},
+        {"NeoHookean",MateType::NEOHOOKEANMATE,3,{210.0,0.3}},
+        {"Plastic1D",MateType::PLASTIC1DMATE,1,{210.0,0.55,5.0}},
+        {"J2Plasticity",MateType::J2PLASTICITYMATE,3,{210.0,0.3,0.55,5.0}},
+        {"MieheFracture",MateType::MIEHEFRACTUREMATE,3,{121.15,80.77,2.7e-3,0.02,1.0e-6}},
+        {"StressDecomposition",MateType::STRESSDECOMPOSITIONMATE,3,{198.0,138.0,138.0,198.0,138.0,198.0,125.0,125.0,125.0,
+                                                                    2.7e-3,0.02,1.0e-6}},
+        {"NeoHookeanPFFracture",MateType::NEOHOOKEANPFFRACTUREMATE,3,{121.15,80.77,2.7e-3,0.02,1.0e-6}},
+        {"Kobayashi",MateType::KOBAYASHIMATE,2,{1.0,0.01,0.04,6.0}},
+        {"DiffNeoHookean",MateType::DIFFNEOHOOKEANMATE,3,{1.0,0.1,210.0,0.3}},
+        {"DiffusionFracture",MateType::DIFFUSIONFRACTUREMATE,3,{1.0,0.1,2.7e-3,0.02,1.0e-6,210.0,0.3}},
+        {"LinearElasticCH",MateType::LINEARELASTICCHMATE,3,{1.0,2.5,0.01,210.0,0.3,0.1,0.5}},
+        {"Wave",MateType::WAVEMATE,2,{1.0,0.0,0.1}},
+        {"Thermal",MateType::THERMALMATE,2,{1.0,1.0,1.0,0.0}}
+    };
+
+    // the pool of the local solutions, each one has 5 dofs, which is enough for all the built-in materials,
+    // the strain level(~5e-3) is large enough to trigger the plastic flow of the J2 model
+    const int n=32;
+    ScratchArena arena;
+    vector<LocalElmtSolution> soln(n);
+    arena.Reserve(n*(4*ScratchArena::BytesOf<double>(6)+4*ScratchArena::BytesOf<Vector3d>(6)));
+    for(int k=0;k<n;k++){
+        soln[k].gpU=arena.Allocate<double>(6,0.0);soln[k].gpUold=arena.Allocate<double>(6,0.0);
+        soln[k].gpV=arena.Allocate<double>(6,0.0);soln[k].gpVold=arena.Allocate<double>(6,0.0);
+        soln[k].gpGradU=arena.Allocate<Vector3d>(6,Vector3d(0.0));soln[k].gpGradUold=arena.Allocate<Vector3d>(6,Vector3d(0.0));
+        soln[k].gpGradV=arena.Allocate<Vector3d>(6,Vector3d(0.0));soln[k].gpGradVold=arena.Allocate<Vector3d>(6,Vector3d(0.0));
+        for(int i=1;i<=5;i++){
+            soln[k].gpU[i]=Benchmark::Random(0.2,0.6);
+            soln[k].gpV[i]=Benchmark::Random(-0.1,0.1);
+            for(int j=1;j<=3;j++){
+                soln[k].gpGradU[i](j)=Benchmark::Random(-5.0e-3,5.0e-3);
+                soln[k].gpGradV[i](j)=Benchmark::Random(-1.0e-3,1.0e-3);
+            }
+        }
+    }
+    LocalElmtInfo elmtinfo;
+    elmtinfo.nNodes=8;elmtinfo.nDofs=5;
+    elmtinfo.t=1.0;elmtinfo.dt=1.0e-2;
+    elmtinfo.gpCoords(1)=0.5;elmtinfo.gpCoords(2)=0.5;elmtinfo.gpCoords(3)=0.5;
+
+    BenchMateSystem mateSystem;
+    MateBlock mateblock;
+    int mateindex=0;
+    for(const auto &it:matelist){
+        // all the materials are added, so the index of each one is fixed no matter which one is selected
+        mateblock.Init();
+        mateblock._MateBlockName=it.Name;
+        mateblock._MateTypeName=it.Name;
+        mateblock._MateType=it.Type;
+        mateblock._Parameters=it.Params;
+        mateSystem.AddBulkMateBlock2List(mateblock);
+    }
+    for(const auto &it:matelist){
+        mateindex+=1;
+        if(!bench.IsSelected("material",it.Name)) continue;
+
+        elmtinfo.nDim=it.nDim;
+        mateSystem.InitBulkMateSystem();
+        mateSystem.InitBulkMateLibs(it.Type,mateindex,elmtinfo,soln[0]);
+        mateSystem.UpdateOldMaterials();
+
+        bench.Run("material",it.Name,n,"op",[&](){
+            for(int k=0;k<n;k++) mateSystem.RunBulkMateLibs(it.Type,mateindex,elmtinfo,soln[k]);
+            Benchmark::Sink+=mateSystem.GetScalarMatePtr().size();
+        });
+
+        // the batched kernel on one hex27 element(27 gauss points)
+        if(BulkMateSystem::IsBatchMateType(it.Type)){
+            const int npoints=27;
+            MateBatch batch;
+            batch.Resize(npoints,BulkMateSystem::GetBatchMateHistNum(it.Type));
+            for(int q=0;q<npoints;q++){
+                for(int i=0;i<3;i++){
+                    for(int j=0;j<3;j++) batch.GradU[(i*3+j)*npoints+q]=soln[q].gpGradU[i+1](j+1);
+                }
+            }
+            for(auto &val:batch.HistOld) val=0.0;
+            bench.Run("material",it.Name+"-batch",npoints,"op",[&](){
+                mateSystem.RunBulkMateBatchLibs(it.Type,mateindex,batch);
+                Benchmark::Sink+=batch.Stress[0];
+            });
+        }
+    }
+}
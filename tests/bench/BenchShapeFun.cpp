@@ -0,0 +1,74 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: the microbenchmarks of LagrangeShapeFun::Calc
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "BenchSuites.h"
+
+#include "Mesh/Mesh.h"
+#include "FE/LagrangeShapeFun.h"
+
+void RunShapeFunBenchmarks(Benchmark &bench){
+    // the element types supported by the built-in mesh generator, the tri/tet ones are only available from
+    // the external meshes
+    const vector<pair<int,string>> typelist={{1,"edge2"},{1,"edge3"},{1,"edge4"},
+                                             {2,"quad4"},{2,"quad8"},{2,"quad9"},
+                                             {3,"hex8"},{3,"hex20"},{3,"hex27"}};
+    const int n=16;// the number of evaluation points per call
+    for(const auto &it:typelist){
+        const int dim=it.first;
+        const string name=it.second;
+        if(!bench.IsSelected("shapefun",name)) continue;
+
+        // the nodal coordinates are taken from the first element of a distorted 2x2(x2) mesh
+        Mesh mesh;
+        mesh.SetBulkMeshDim(dim);
+        mesh.SetBulkMeshNx(2);
+        mesh.SetBulkMeshXmin(0.0);mesh.SetBulkMeshXmax(1.0);
+        if(dim>=2){mesh.SetBulkMeshNy(2);mesh.SetBulkMeshYmin(0.0);mesh.SetBulkMeshYmax(1.2);}
+        if(dim>=3){mesh.SetBulkMeshNz(2);mesh.SetBulkMeshZmin(0.0);mesh.SetBulkMeshZmax(0.8);}
+        mesh.SetBulkMeshMeshTypeName(name);
+        mesh.CreateMesh();
+
+        const int nNodes=mesh.GetBulkMeshIthBulkElmtNodesNum(1);
+        Nodes nodes(nNodes);
+        mesh.GetBulkMeshIthBulkElmtNodes(1,nodes);
+        for(int i=1;i<=nNodes;i++){
+            for(int j=1;j<=dim;j++) nodes(i,j)+=Benchmark::Random(-0.02,0.02);
+        }
+
+        vector<double> xi(n),eta(n),zeta(n);
+        for(int k=0;k<n;k++){
+            xi[k]=Benchmark::Random(-0.9,0.9);
+            eta[k]=Benchmark::Random(-0.9,0.9);
+            zeta[k]=Benchmark::Random(-0.9,0.9);
+        }
+
+        LagrangeShapeFun shp(dim,mesh.GetBulkMeshBulkElmtType());
+        shp.PreCalc();
+        if(dim==1){
+            bench.Run("shapefun",name,n,"op",[&](){
+                for(int k=0;k<n;k++){shp.Calc(xi[k],nodes,true);Benchmark::Sink+=shp.GetDetJac();}
+            });
+        }
+        else if(dim==2){
+            bench.Run("shapefun",name,n,"op",[&](){
+                for(int k=0;k<n;k++){shp.Calc(xi[k],eta[k],nodes,true);Benchmark::Sink+=shp.GetDetJac();}
+            });
+        }
+        else{
+            bench.Run("shapefun",name,n,"op",[&](){
+                for(int k=0;k<n;k++){shp.Calc(xi[k],eta[k],zeta[k],nodes,true);Benchmark::Sink+=shp.GetDetJac();}
+            });
+        }
+    }
+}
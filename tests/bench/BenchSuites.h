@@ -0,0 +1,36 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: list all the benchmark suites of asfem-bench
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include "Benchmark.h"
+
+/**
+ * the rank-2/rank-4 tensor operations, the eigen decomposition and the inverse
+ */
+void RunTensorBenchmarks(Benchmark &bench);
+/**
+ * LagrangeShapeFun::Calc for each element type supported by the built-in mesh generator
+ */
+void RunShapeFunBenchmarks(Benchmark &bench);
+/**
+ * each built-in material of MateSystem, and the batched kernels
+ */
+void RunMaterialBenchmarks(Benchmark &bench);
+/**
+ * the residual and jacobian sweep of FormBulkFE on the generated 2D/3D meshes
+ * @param n2d the elements number along each direction of the 2D mesh
+ * @param n3d the elements number along each direction of the 3D mesh
+ */
+void RunAssembleBenchmarks(Benchmark &bench,const int &n2d,const int &n3d);
@@ -0,0 +1,107 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: the microbenchmarks of the rank-2 and rank-4 tensors
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include "BenchSuites.h"
+
+#include "Utils/RankTwoTensor.h"
+#include "Utils/RankFourTensor.h"
+#include "Utils/SymmetricRankFourTensor.h"
+
+void RunTensorBenchmarks(Benchmark &bench){
+    // a small pool of inputs is used, so the compiler can't fold the operations into constants
+    const int n=64;
+    vector<RankTwoTensor> A(n),B(n),S(n);
+    vector<RankFourTensor> C(n);
+    vector<SymmetricRankFourTensor> SC(n);
+    RankTwoTensor I;
+    I.SetToIdentity();
+    for(int k=0;k<n;k++){
+        for(int i=1;i<=9;i++){
+            A[k][i]=Benchmark::Random(-1.0,1.0);
+            B[k][i]=Benchmark::Random(-1.0,1.0);
+        }
+        // keep A well conditioned for the inverse
+        A[k]+=I*3.0;
+        S[k].SetFromSymmetricPart(B[k]);
+        C[k].SetFromEandNu(Benchmark::Random(100.0,200.0),Benchmark::Random(0.1,0.4));
+        SC[k].SetFromEandNu(Benchmark::Random(100.0,200.0),Benchmark::Random(0.1,0.4));
+    }
+
+    RankTwoTensor r2;
+    RankFourTensor r4;
+    SymmetricRankFourTensor sr4;
+    double eigval[3];
+
+    //*****************************************
+    //*** rank-2 tensor
+    //*****************************************
+    bench.Run("tensor","RankTwo-Add",n,"op",[&](){
+        for(int k=0;k<n;k++){r2=A[k]+B[k];Benchmark::Sink+=r2(1,1);}
+    });
+    bench.Run("tensor","RankTwo-Axpy",n,"op",[&](){
+        for(int k=0;k<n;k++){r2.Axpy(0.5,A[k]);}
+        Benchmark::Sink+=r2(1,1);
+    });
+    bench.Run("tensor","RankTwo-Mult",n,"op",[&](){
+        for(int k=0;k<n;k++){r2=A[k]*B[k];Benchmark::Sink+=r2(1,1);}
+    });
+    bench.Run("tensor","RankTwo-DoubleDot",n,"op",[&](){
+        double sum=0.0;
+        for(int k=0;k<n;k++) sum+=A[k].DoubleDot(B[k]);
+        Benchmark::Sink+=sum;
+    });
+    bench.Run("tensor","RankTwo-Det",n,"op",[&](){
+        double sum=0.0;
+        for(int k=0;k<n;k++) sum+=A[k].Det();
+        Benchmark::Sink+=sum;
+    });
+    bench.Run("tensor","RankTwo-Inverse",n,"op",[&](){
+        for(int k=0;k<n;k++){r2=A[k].Inverse();Benchmark::Sink+=r2(1,1);}
+    });
+    bench.Run("tensor","RankTwo-Eigen",n,"op",[&](){
+        for(int k=0;k<n;k++){A[k].CalcEigenValueAndEigenVectors(eigval,r2);Benchmark::Sink+=eigval[0];}
+    });
+    bench.Run("tensor","RankTwo-SymEigen",n,"op",[&](){
+        for(int k=0;k<n;k++){S[k].CalcSymEigenValueAndEigenVectors(eigval,r2);Benchmark::Sink+=eigval[0];}
+    });
+    bench.Run("tensor","RankTwo-PositiveProj",n,"op",[&](){
+        for(int k=0;k<n;k++){
+            S[k].CalcSymEigenValueAndEigenVectors(eigval,r2);
+            RankTwoTensor::FillPositiveProjTensor(eigval,r2,r4);
+            Benchmark::Sink+=r4(1,1,1,1);
+        }
+    });
+
+    //*****************************************
+    //*** rank-4 tensor
+    //*****************************************
+    bench.Run("tensor","RankFour-OTimes",n,"op",[&](){
+        for(int k=0;k<n;k++){r4=A[k].OTimes(B[k]);Benchmark::Sink+=r4(1,1,1,1);}
+    });
+    bench.Run("tensor","RankFour-DoubleDotRankTwo",n,"op",[&](){
+        for(int k=0;k<n;k++){C[k].DoubleDotInto(A[k],r2);Benchmark::Sink+=r2(1,1);}
+    });
+    bench.Run("tensor","RankFour-DoubleDotRankFour",n,"op",[&](){
+        for(int k=0;k<n;k++){C[k].DoubleDotInto(C[n-1-k],r4);Benchmark::Sink+=r4(1,1,1,1);}
+    });
+    bench.Run("tensor","RankFour-Rotate",n,"op",[&](){
+        for(int k=0;k<n;k++){r4=C[k].Rotate(A[k]);Benchmark::Sink+=r4(1,1,1,1);}
+    });
+    bench.Run("tensor","SymRankFour-DoubleDotRankTwo",n,"op",[&](){
+        for(int k=0;k<n;k++){r2=SC[k].DoubleDot(S[k]);Benchmark::Sink+=r2(1,1);}
+    });
+    bench.Run("tensor","SymRankFour-DoubleDotSymRankFour",n,"op",[&](){
+        for(int k=0;k<n;k++){sr4=SC[k].DoubleDot(SC[n-1-k]);Benchmark::Sink+=sr4.MandelIJ(1,1);}
+    });
+}
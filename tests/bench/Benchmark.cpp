@@ -0,0 +1,227 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: Implement the timing driver of asfem-bench
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "Benchmark.h"
+
+volatile double Benchmark::Sink=0.0;
+
+//******************************************************
+//*** the global operator new is replaced, then the heap
+//*** allocations of the measured code can be counted
+//******************************************************
+static atomic<long> AllocationsNum(0);
+
+void* operator new(size_t size){
+    AllocationsNum.fetch_add(1,memory_order_relaxed);
+    void *ptr=malloc(size>0?size:1);
+    if(!ptr) throw bad_alloc();
+    return ptr;
+}
+void* operator new[](size_t size){
+    return operator new(size);
+}
+void operator delete(void *ptr)noexcept{
+    free(ptr);
+}
+void operator delete[](void *ptr)noexcept{
+    free(ptr);
+}
+void operator delete(void *ptr,size_t)noexcept{
+    free(ptr);
+}
+void operator delete[](void *ptr,size_t)noexcept{
+    free(ptr);
+}
+
+Benchmark::Benchmark(){
+    _Records.clear();
+    _Filter.clear();
+    _MinTime=0.1;
+    _nRepeats=5;
+}
+//******************************************************
+double Benchmark::NowInSeconds()const{
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+//******************************************************
+double Benchmark::GetCurrentMemory(){
+    PetscLogDouble mem;
+    PetscMemoryGetCurrentUsage(&mem);
+    return mem/1.0e6;
+}
+//******************************************************
+long Benchmark::GetAllocationsNum(){
+    return AllocationsNum.load(memory_order_relaxed);
+}
+//******************************************************
+double Benchmark::Random(const double &a,const double &b){
+    static mt19937 generator(2022);
+    static uniform_real_distribution<double> uniform(0.0,1.0);
+    return a+(b-a)*uniform(generator);
+}
+//******************************************************
+bool Benchmark::IsSelected(const string &group,const string &name)const{
+    if(_Filter.size()<1) return true;
+    return (group+"/"+name).find(_Filter)!=string::npos;
+}
+//******************************************************
+void Benchmark::Run(const string &group,const string &name,const double &nops,const string &unit,
+                    const function<void()> &func){
+    if(!IsSelected(group,name)) return;
+
+    double t0,t1,elapse;
+    long ncalls=1,nallocs;
+    // the first call is the warm-up one, then the number of calls is doubled until one repeat is long enough
+    func();
+    while(true){
+        t0=NowInSeconds();
+        for(long i=0;i<ncalls;i++) func();
+        t1=NowInSeconds();
+        elapse=t1-t0;
+        if(elapse>=_MinTime||ncalls>=(1L<<40)) break;
+        ncalls*=2;
+    }
+    vector<double> times(_nRepeats,0.0);
+    times[0]=elapse;
+    nallocs=GetAllocationsNum();
+    for(int r=1;r<_nRepeats;r++){
+        t0=NowInSeconds();
+        for(long i=0;i<ncalls;i++) func();
+        t1=NowInSeconds();
+        times[r]=t1-t0;
+    }
+    nallocs=GetAllocationsNum()-nallocs;
+    sort(times.begin(),times.end());
+
+    BenchRecord record;
+    record.Group=group;
+    record.Name=name;
+    record.Unit=unit;
+    record.Calls=ncalls;
+    record.NsPerOp=1.0e9*times[_nRepeats/2]/(ncalls*nops);
+    record.OpsPerSec=record.NsPerOp>0.0?1.0e9/record.NsPerOp:0.0;
+    record.AllocsPerOp=_nRepeats>1?1.0*nallocs/((_nRepeats-1)*ncalls*nops):0.0;
+    record.MemoryMB=GetCurrentMemory();
+    _Records.push_back(record);
+
+    char buff[70];
+    snprintf(buff,70,"%-36s%12.3e ns/%-4s%8.1f MB",(group+"/"+name).substr(0,35).c_str(),
+             record.NsPerOp,unit.c_str(),record.MemoryMB);
+    MessagePrinter::PrintNormalTxt(buff);
+}
+//******************************************************
+void Benchmark::PrintSummary()const{
+    char buff[70];
+    MessagePrinter::PrintStars(MessageColor::BLUE);
+    snprintf(buff,70,"%-30s%11s%11s%8s%8s","Benchmark","ns/op","ops/s","allocs","MB");
+    MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    MessagePrinter::PrintDashLine(MessageColor::BLUE);
+    for(const auto &it:_Records){
+        snprintf(buff,70,"%-30s%11.3e%11.3e%8.2f%8.1f",(it.Group+"/"+it.Name).substr(0,29).c_str(),
+                 it.NsPerOp,it.OpsPerSec,it.AllocsPerOp,it.MemoryMB);
+        MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    }
+    MessagePrinter::PrintStars(MessageColor::BLUE);
+}
+//******************************************************
+void Benchmark::WriteJsonFile(const string &filename)const{
+    PetscMPIInt rank,size;
+    MPI_Comm_rank(PETSC_COMM_WORLD,&rank);
+    MPI_Comm_size(PETSC_COMM_WORLD,&size);
+    if(rank!=0) return;
+
+    PetscLogDouble peak;
+    PetscMemoryGetMaximumUsage(&peak);
+
+    ofstream out;
+    out.open(filename,ios::out);
+    if(!out.is_open()){
+        MessagePrinter::PrintWarningTxt("can\'t write the benchmark result to "+filename);
+        return;
+    }
+    // one record per line, then the file can be diffed and read back by CompareWithJsonFile
+    out<<scientific<<setprecision(6);
+    out<<"{\n";
+    out<<"  \"nprocs\": "<<size<<",\n";
+    out<<"  \"peak_memory_mb\": "<<peak/1.0e6<<",\n";
+    out<<"  \"benchmarks\": [\n";
+    for(int i=0;i<static_cast<int>(_Records.size());i++){
+        out<<"    {\"group\": \""<<_Records[i].Group<<"\", "
+           <<"\"name\": \""<<_Records[i].Name<<"\", "
+           <<"\"unit\": \""<<_Records[i].Unit<<"\", "
+           <<"\"calls\": "<<_Records[i].Calls<<", "
+           <<"\"ns_per_op\": "<<_Records[i].NsPerOp<<", "
+           <<"\"ops_per_sec\": "<<_Records[i].OpsPerSec<<", "
+           <<"\"allocs_per_op\": "<<_Records[i].AllocsPerOp<<", "
+           <<"\"memory_mb\": "<<_Records[i].MemoryMB<<"}";
+        if(i<static_cast<int>(_Records.size())-1) out<<",";
+        out<<"\n";
+    }
+    out<<"  ]\n";
+    out<<"}\n";
+    out.close();
+    MessagePrinter::PrintNormalTxt("Benchmark result is written to "+filename);
+}
+//******************************************************
+void Benchmark::CompareWithJsonFile(const string &filename)const{
+    ifstream in;
+    in.open(filename,ios::in);
+    if(!in.is_open()){
+        MessagePrinter::PrintWarningTxt("can\'t read the previous benchmark result from "+filename);
+        return;
+    }
+    // only the files written by WriteJsonFile are supported, i.e. one benchmark per line
+    auto GetString=[](const string &line,const string &key)->string{
+        size_t i=line.find("\""+key+"\": \"");
+        if(i==string::npos) return "";
+        i+=key.size()+5;
+        return line.substr(i,line.find("\"",i)-i);
+    };
+    auto GetNumber=[](const string &line,const string &key)->double{
+        size_t i=line.find("\""+key+"\": ");
+        if(i==string::npos) return -1.0;
+        return atof(line.substr(i+key.size()+4).c_str());
+    };
+    vector<pair<string,double>> oldlist;
+    string line;
+    while(getline(in,line)){
+        if(line.find("\"ns_per_op\"")==string::npos) continue;
+        oldlist.push_back(make_pair(GetString(line,"group")+"/"+GetString(line,"name"),GetNumber(line,"ns_per_op")));
+    }
+    in.close();
+
+    char buff[70];
+    MessagePrinter::PrintStars(MessageColor::BLUE);
+    MessagePrinter::PrintNormalTxt("Compare with "+filename+" (speedup>1 means faster)",MessageColor::BLUE);
+    snprintf(buff,70,"%-34s%11s%11s%9s","Benchmark","old[ns]","new[ns]","speedup");
+    MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    MessagePrinter::PrintDashLine(MessageColor::BLUE);
+    for(const auto &it:_Records){
+        string name=it.Group+"/"+it.Name;
+        auto old=find_if(oldlist.begin(),oldlist.end(),
+                         [&name](const pair<string,double> &p){return p.first==name;});
+        if(old==oldlist.end()||old->second<=0.0) continue;
+        snprintf(buff,70,"%-34s%11.3e%11.3e%9.3f",name.substr(0,33).c_str(),
+                 old->second,it.NsPerOp,old->second/it.NsPerOp);
+        MessagePrinter::PrintNormalTxt(buff,MessageColor::BLUE);
+    }
+    MessagePrinter::PrintStars(MessageColor::BLUE);
+}
@@ -0,0 +1,106 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: the timing driver of asfem-bench, each benchmark is
+//+++          a function which does 'nops' operations per call,
+//+++          the number of calls is calibrated to the minimum
+//+++          time, then the median of several repeats is taken
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+#include <random>
+
+#include "petsc.h"
+
+#include "Utils/MessagePrinter.h"
+
+using namespace std;
+
+class Benchmark{
+public:
+    Benchmark();
+
+    /**
+     * only the benchmarks whose 'group/name' contains the filter are executed
+     */
+    void SetFilter(const string &filter){_Filter=filter;}
+    /**
+     * set the minimum time(in seconds) of one repeat
+     */
+    void SetMinTime(const double &t){_MinTime=t;}
+    /**
+     * return true if the benchmark should be executed, the expensive setup can be skipped if false
+     */
+    bool IsSelected(const string &group,const string &name)const;
+
+    /**
+     * run one benchmark
+     * @param group the group name, i.e. tensor, shapefun, material, assemble
+     * @param name the name of the benchmark
+     * @param nops the number of operations(i.e. elements) done by one call of func
+     * @param unit the name of one operation, i.e. 'op' or 'elmt'
+     * @param func the function to be measured
+     */
+    void Run(const string &group,const string &name,const double &nops,const string &unit,
+             const function<void()> &func);
+
+    void PrintSummary()const;
+    void WriteJsonFile(const string &filename)const;
+    /**
+     * print the speedup with respect to the results of a previous run
+     * @param filename the json file written by a previous run
+     */
+    void CompareWithJsonFile(const string &filename)const;
+
+    /**
+     * the current resident memory in MB(1MB=1e6 bytes, the same as Profiler)
+     */
+    static double GetCurrentMemory();
+    /**
+     * the number of the heap allocations(operator new) since the start of the program
+     */
+    static long GetAllocationsNum();
+    /**
+     * the heap allocations per operation of the last benchmark, it should be 0 for the element loop
+     */
+    double GetLastAllocsPerOp()const{return _Records.size()>0?_Records.back().AllocsPerOp:0.0;}
+    /**
+     * the uniform random number in [a,b], the seed is fixed, so all the runs use the same inputs
+     */
+    static double Random(const double &a,const double &b);
+
+    /**
+     * the results should be accumulated here, otherwise the compiler may remove the measured code
+     */
+    static volatile double Sink;
+
+private:
+    struct BenchRecord{
+        string Group,Name,Unit;
+        long Calls;/**< the number of calls in one repeat*/
+        double NsPerOp;/**< the median time per operation*/
+        double OpsPerSec;/**< the operations(i.e. elements) per second*/
+        double AllocsPerOp;/**< the heap allocations per operation*/
+        double MemoryMB;/**< the resident memory after the benchmark*/
+    };
+    double NowInSeconds()const;
+
+private:
+    vector<BenchRecord> _Records;
+    string _Filter;
+    double _MinTime;
+    int _nRepeats;
+};
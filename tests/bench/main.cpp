@@ -0,0 +1,79 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.12
+//+++ Purpose: the main function of asfem-bench, the usage is:
+//+++            ./asfem-bench [--output file.json]
+//+++                          [--compare previous.json]
+//+++                          [--filter tensor/RankTwo]
+//+++                          [--min-time 0.1]
+//+++                          [--size2d 200] [--size3d 30]
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include "petsc.h"
+
+#include "BenchSuites.h"
+
+int main(int args,char *argv[]){
+    PetscErrorCode ierr;
+    ierr=PetscInitialize(&args,&argv,NULL,NULL);if (ierr) return ierr;
+    PetscMemorySetGetMaximumUsage();
+
+    string outputfilename="asfem-bench.json";
+    string comparefilename;
+    int n2d=200,n3d=30;
+    Benchmark bench;
+
+    for(int i=1;i<args;i++){
+        string str=argv[i];
+        if(i+1>=args){
+            if(str.find("--")==0){
+                MessagePrinter::PrintErrorTxt("no value is given after '"+str+"'");
+                MessagePrinter::AsFem_Exit();
+            }
+            continue;
+        }
+        if(str=="--output"){
+            outputfilename=argv[++i];
+        }
+        else if(str=="--compare"){
+            comparefilename=argv[++i];
+        }
+        else if(str=="--filter"){
+            bench.SetFilter(argv[++i]);
+        }
+        else if(str=="--min-time"){
+            bench.SetMinTime(atof(argv[++i]));
+        }
+        else if(str=="--size2d"){
+            n2d=atoi(argv[++i]);
+        }
+        else if(str=="--size3d"){
+            n3d=atoi(argv[++i]);
+        }
+    }
+
+    MessagePrinter::PrintStars();
+    MessagePrinter::PrintNormalTxt("Start the benchmarks of AsFem ...");
+    MessagePrinter::PrintStars();
+
+    RunTensorBenchmarks(bench);
+    RunShapeFunBenchmarks(bench);
+    RunMaterialBenchmarks(bench);
+    RunAssembleBenchmarks(bench,n2d,n3d);
+
+    bench.PrintSummary();
+    bench.WriteJsonFile(outputfilename);
+    if(comparefilename.size()>0) bench.CompareWithJsonFile(comparefilename);
+
+    ierr=PetscFinalize();CHKERRQ(ierr);
+    return ierr;
+}
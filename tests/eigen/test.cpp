@@ -0,0 +1,166 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.05
+//+++ Purpose: microbenchmark of the eigen decomposition and the
+//+++          positive projection tensor, the symmetric jacobi
+//+++          path is compared with the general Eigen solver
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include <chrono>
+#include <random>
+#include "petsc.h"
+
+#include "Utils/RankTwoTensor.h"
+#include "Utils/RankFourTensor.h"
+
+// the general(non-symmetric) eigen solver, which is the previous path of RankTwoTensor
+void GeneralEigen(const RankTwoTensor &a,double (&eigval)[3],RankTwoTensor &eigvec){
+    Eigen::Matrix3d M;
+    M<<a(1,1),a(1,2),a(1,3),
+       a(2,1),a(2,2),a(2,3),
+       a(3,1),a(3,2),a(3,3);
+    Eigen::EigenSolver<Eigen::Matrix3d> solver;
+    solver.compute(M);
+    for(int i=0;i<3;++i){
+        eigval[i]=solver.eigenvalues()(i).real();
+        eigvec(1,i+1)=solver.eigenvectors()(0,i).real();
+        eigvec(2,i+1)=solver.eigenvectors()(1,i).real();
+        eigvec(3,i+1)=solver.eigenvectors()(2,i).real();
+    }
+}
+// the previous positive projection, which is built by the general rank-4 tensor operations
+RankFourTensor GeneralPositiveProj(const RankTwoTensor &a){
+    double eigval[3],epos[3],diag[3],theta;
+    RankTwoTensor eigvec(0.0),Ma(0.0),Mb(0.0);
+    RankFourTensor ProjPos(0.0),Gab(0.0),Gba(0.0);
+    GeneralEigen(a,eigval,eigvec);
+    for(int i=0;i<3;++i){
+        epos[i]=0.5*(abs(eigval[i])+eigval[i]);
+        diag[i]=(eigval[i]>0.0)?1.0:0.0;
+    }
+    for(int i=1;i<=3;++i){
+        Ma.VectorOTimes(eigvec.IthCol(i),eigvec.IthCol(i));
+        ProjPos+=Ma.OTimes(Ma)*diag[i-1];
+    }
+    for(int i=0;i<3;++i){
+        for(int j=0;j<i;++j){
+            Ma.VectorOTimes(eigvec.IthCol(i+1),eigvec.IthCol(i+1));
+            Mb.VectorOTimes(eigvec.IthCol(j+1),eigvec.IthCol(j+1));
+            Gab=Ma.IkJlTimes(Mb)+Ma.IlJkTimes(Mb);
+            Gba=Mb.IkJlTimes(Ma)+Mb.IlJkTimes(Ma);
+            if(abs(eigval[i]-eigval[j])<=1.0e-13){
+                theta=0.5*(diag[i]+diag[j])/2.0;
+            }
+            else{
+                theta=0.5*(epos[i]-epos[j])/(eigval[i]-eigval[j]);
+            }
+            ProjPos+=theta*(Gab+Gba);
+        }
+    }
+    return ProjPos;
+}
+
+int main(int args,char *argv[]){
+    PetscErrorCode ierr;
+    ierr=PetscInitialize(&args,&argv,NULL,NULL);if (ierr) return ierr;
+
+    const int n=20000;
+    const int nrepeat=5;
+    std::mt19937 rng(2022);
+    std::uniform_real_distribution<double> dist(-1.0,1.0);
+    vector<RankTwoTensor> strains(n,RankTwoTensor(0.0));
+    for(int i=0;i<n;++i){
+        for(int j=1;j<=3;++j){
+            for(int k=j;k<=3;++k){
+                strains[i](j,k)=dist(rng);
+                strains[i](k,j)=strains[i](j,k);
+            }
+        }
+        // the repeated eigen values, i.e. the uniaxial and the hydrostatic state
+        if(i%10==0){
+            strains[i].SetToZeros();
+            strains[i](1,1)=dist(rng);
+        }
+        else if(i%10==1){
+            strains[i].SetToIdentity();
+            strains[i]*=dist(rng);
+        }
+    }
+
+    // the accuracy check: A.n_a=lambda_a*n_a, and the projection of both paths
+    double eigval[3],errEigen=0.0,errProj=0.0,err;
+    RankTwoTensor eigvec(0.0);
+    RankFourTensor P1(0.0),P2(0.0);
+    for(int i=0;i<n;++i){
+        strains[i].CalcSymEigenValueAndEigenVectors(eigval,eigvec);
+        for(int a=1;a<=3;++a){
+            for(int j=1;j<=3;++j){
+                err=-eigval[a-1]*eigvec(j,a);
+                for(int k=1;k<=3;++k) err+=strains[i](j,k)*eigvec(k,a);
+                if(abs(err)>errEigen) errEigen=abs(err);
+            }
+        }
+        P1=strains[i].GetPositiveProjTensor();
+        P2=GeneralPositiveProj(strains[i]);
+        for(int j=1;j<=81;++j){
+            if(abs(P1[j]-P2[j])>errProj) errProj=abs(P1[j]-P2[j]);
+        }
+    }
+    cout<<"max residual of A.n-lambda*n ="<<errEigen<<endl;
+    cout<<"max difference of projection ="<<errProj<<endl;
+
+    // the timing of both paths
+    double sum=0.0,told,tnew;
+    auto t0=chrono::high_resolution_clock::now();
+    for(int r=0;r<nrepeat;++r){
+        for(int i=0;i<n;++i){
+            GeneralEigen(strains[i],eigval,eigvec);
+            sum+=eigval[0];
+        }
+    }
+    auto t1=chrono::high_resolution_clock::now();
+    told=chrono::duration<double,nano>(t1-t0).count()/(n*nrepeat);
+    t0=chrono::high_resolution_clock::now();
+    for(int r=0;r<nrepeat;++r){
+        for(int i=0;i<n;++i){
+            strains[i].CalcSymEigenValueAndEigenVectors(eigval,eigvec);
+            sum+=eigval[0];
+        }
+    }
+    t1=chrono::high_resolution_clock::now();
+    tnew=chrono::duration<double,nano>(t1-t0).count()/(n*nrepeat);
+    cout<<"eigen decomposition: general="<<told<<" ns/op, symmetric="<<tnew<<" ns/op, speedup="<<told/tnew<<endl;
+
+    t0=chrono::high_resolution_clock::now();
+    for(int r=0;r<nrepeat;++r){
+        for(int i=0;i<n;++i){
+            P2=GeneralPositiveProj(strains[i]);
+            sum+=P2[1];
+        }
+    }
+    t1=chrono::high_resolution_clock::now();
+    told=chrono::duration<double,nano>(t1-t0).count()/(n*nrepeat);
+    t0=chrono::high_resolution_clock::now();
+    for(int r=0;r<nrepeat;++r){
+        for(int i=0;i<n;++i){
+            P1=strains[i].GetPositiveProjTensor();
+            sum+=P1[1];
+        }
+    }
+    t1=chrono::high_resolution_clock::now();
+    tnew=chrono::duration<double,nano>(t1-t0).count()/(n*nrepeat);
+    cout<<"positive projection: general="<<told<<" ns/op, fused="<<tnew<<" ns/op, speedup="<<told/tnew<<endl;
+    cout<<"checksum="<<sum<<endl;
+
+    ierr=PetscFinalize();CHKERRQ(ierr);
+    return ierr;
+}
@@ -0,0 +1,153 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.20
+//+++ Purpose: compare the Mandel storage of SymmetricRankFourTensor
+//+++          with the full-index RankFourTensor, i.e. the 6x6<->full
+//+++          round-trip, Rotate and DoubleDot must be the same
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include "petsc.h"
+
+#include "Utils/RankTwoTensor.h"
+#include "Utils/RankFourTensor.h"
+#include "Utils/SymmetricRankFourTensor.h"
+
+using namespace std;
+
+/**
+ * a general tensor with both minor symmetries but without the major symmetry, the values are deterministic
+ */
+RankFourTensor CreateMinorSymmetricTensor(){
+    RankFourTensor a(0.0),b(0.0);
+    for(int i=1;i<=3;i++){
+        for(int j=1;j<=3;j++){
+            for(int k=1;k<=3;k++){
+                for(int l=1;l<=3;l++){
+                    a(i,j,k,l)=sin(1.0*i+2.0*j+3.0*k+5.0*l)+0.1*i*l;
+                }
+            }
+        }
+    }
+    for(int i=1;i<=3;i++){
+        for(int j=1;j<=3;j++){
+            for(int k=1;k<=3;k++){
+                for(int l=1;l<=3;l++){
+                    b(i,j,k,l)=0.25*(a(i,j,k,l)+a(j,i,k,l)+a(i,j,l,k)+a(j,i,l,k));
+                }
+            }
+        }
+    }
+    return b;
+}
+
+double MaxDiff(const RankFourTensor &a,const RankFourTensor &b){
+    double err=0.0;
+    for(int i=1;i<=3;i++){
+        for(int j=1;j<=3;j++){
+            for(int k=1;k<=3;k++){
+                for(int l=1;l<=3;l++){
+                    err=max(err,abs(a(i,j,k,l)-b(i,j,k,l)));
+                }
+            }
+        }
+    }
+    return err;
+}
+
+double MaxDiff(const RankTwoTensor &a,const RankTwoTensor &b){
+    double err=0.0;
+    for(int i=1;i<=3;i++){
+        for(int j=1;j<=3;j++){
+            err=max(err,abs(a(i,j)-b(i,j)));
+        }
+    }
+    return err;
+}
+
+bool CheckError(const string &name,const double &err,const double &tol){
+    cout<<scientific<<setprecision(3);
+    cout<<setw(28)<<left<<name<<": max err="<<err<<(err<tol?" ... passed":" ... failed")<<endl;
+    return err<tol;
+}
+
+int main(int args,char *argv[]){
+    PetscErrorCode ierr;
+    ierr=PetscInitialize(&args,&argv,NULL,NULL);if (ierr) return ierr;
+
+    const double tol=1.0e-12;
+    bool passed=true;
+    double err;
+
+    //*** the full->6x6->full round-trip
+    RankFourTensor full=CreateMinorSymmetricTensor();
+    SymmetricRankFourTensor mandel(full);
+    passed=CheckError("full->Mandel->full",MaxDiff(mandel.ToRankFourTensor(),full),tol)&&passed;
+
+    //*** the 6x6->full->6x6 round-trip
+    SymmetricRankFourTensor mandel2(mandel.ToRankFourTensor());
+    err=0.0;
+    for(int I=1;I<=6;I++){
+        for(int J=1;J<=6;J++){
+            err=max(err,abs(mandel2.MandelIJ(I,J)-mandel.MandelIJ(I,J)));
+        }
+    }
+    passed=CheckError("Mandel->full->Mandel",err,tol)&&passed;
+
+    //*** the full-index access
+    err=0.0;
+    for(int i=1;i<=3;i++){
+        for(int j=1;j<=3;j++){
+            for(int k=1;k<=3;k++){
+                for(int l=1;l<=3;l++){
+                    err=max(err,abs(mandel(i,j,k,l)-full(i,j,k,l)));
+                }
+            }
+        }
+    }
+    passed=CheckError("Mandel(i,j,k,l)",err,tol)&&passed;
+
+    //*** the isotropic elasticity tensor
+    RankFourTensor fullelastic(0.0);
+    SymmetricRankFourTensor mandelelastic(0.0);
+    fullelastic.SetFromEandNu(210.0,0.3);
+    mandelelastic.SetFromEandNu(210.0,0.3);
+    passed=CheckError("SetFromEandNu",MaxDiff(mandelelastic.ToRankFourTensor(),fullelastic),tol)&&passed;
+
+    //*** the rotation of the general and the isotropic tensors
+    RankTwoTensor rotate(0.0);
+    rotate.SetRotationTensorFromEulerAngle(30.0,45.0,60.0);
+    passed=CheckError("Rotate",MaxDiff(mandel.Rotate(rotate).ToRankFourTensor(),full.Rotate(rotate)),tol)&&passed;
+    passed=CheckError("Rotate(isotropic)",MaxDiff(mandelelastic.Rotate(rotate).ToRankFourTensor(),fullelastic),1.0e-10)&&passed;
+
+    //*** the double dot with a symmetric rank-2 tensor and another rank-4 tensor
+    RankTwoTensor strain(0.0);
+    for(int i=1;i<=3;i++){
+        for(int j=1;j<=3;j++){
+            strain(i,j)=0.01*(i+j)+0.001*i*j;
+        }
+    }
+    passed=CheckError("DoubleDot(rank-2)",MaxDiff(mandel.DoubleDot(strain),full.DoubleDot(strain)),tol)&&passed;
+    passed=CheckError("DoubleDot(rank-4)",MaxDiff(mandel.DoubleDot(mandelelastic).ToRankFourTensor(),
+                                                  full.DoubleDot(fullelastic)),1.0e-10)&&passed;
+
+    if(passed){
+        cout<<"all the symmetric rank-4 tensor tests are passed !"<<endl;
+    }
+    else{
+        cout<<"the Mandel storage doesn't match the full-index rank-4 tensor !"<<endl;
+    }
+
+    ierr=PetscFinalize();CHKERRQ(ierr);
+    return passed?0:1;
+}
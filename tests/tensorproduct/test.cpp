@@ -0,0 +1,192 @@
+//****************************************************************
+//* This file is part of the AsFem framework
+//* A Simple Finite Element Method program (AsFem)
+//* All rights reserved, Yang Bai/M3 Group @ CopyRight 2022
+//* https://github.com/M3Group/AsFem
+//* Licensed under GNU GPLv3, please see LICENSE for details
+//* https://www.gnu.org/licenses/gpl-3.0.en.html
+//****************************************************************
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++ Author : Yang Bai
+//+++ Date   : 2022.06.20
+//+++ Purpose: compare the sum-factorization kernel with the shape
+//+++          functions on the distorted quad4/quad9/hex8/hex27
+//+++          elements, i.e. the interpolated values, the gradients
+//+++          and the transpose one(Integrate) must be the same
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+#include "petsc.h"
+
+#include "FE/QPoint.h"
+#include "FE/ShapeFun.h"
+#include "FE/TensorProductKernel.h"
+
+using namespace std;
+
+/**
+ * the reference coordinates of the nodes, the node order is the same as the one of the mesh
+ */
+void GetReferenceNodes(const MeshType &meshtype,vector<double> &xi,vector<double> &eta,vector<double> &zeta){
+    xi.clear();eta.clear();zeta.clear();
+    if(meshtype==MeshType::QUAD4||meshtype==MeshType::QUAD9){
+        xi ={-1.0, 1.0, 1.0,-1.0};
+        eta={-1.0,-1.0, 1.0, 1.0};
+        if(meshtype==MeshType::QUAD9){
+            xi.insert(xi.end(),{ 0.0, 1.0, 0.0,-1.0, 0.0});
+            eta.insert(eta.end(),{-1.0, 0.0, 1.0, 0.0, 0.0});
+        }
+        zeta.resize(xi.size(),0.0);
+    }
+    else{
+        xi  ={-1.0, 1.0, 1.0,-1.0,-1.0, 1.0, 1.0,-1.0};
+        eta ={-1.0,-1.0, 1.0, 1.0,-1.0,-1.0, 1.0, 1.0};
+        zeta={-1.0,-1.0,-1.0,-1.0, 1.0, 1.0, 1.0, 1.0};
+        if(meshtype==MeshType::HEX27){
+            // edges on the bottom, the top and the vertical ones
+            xi.insert(xi.end(),  { 0.0, 1.0, 0.0,-1.0, 0.0, 1.0, 0.0,-1.0,-1.0, 1.0, 1.0,-1.0});
+            eta.insert(eta.end(),{-1.0, 0.0, 1.0, 0.0,-1.0, 0.0, 1.0, 0.0,-1.0,-1.0, 1.0, 1.0});
+            zeta.insert(zeta.end(),{-1.0,-1.0,-1.0,-1.0, 1.0, 1.0, 1.0, 1.0, 0.0, 0.0, 0.0, 0.0});
+            // faces(left,right,front,back,bottom,top) and the center
+            xi.insert(xi.end(),  {-1.0, 1.0, 0.0, 0.0, 0.0, 0.0, 0.0});
+            eta.insert(eta.end(),{ 0.0, 0.0,-1.0, 1.0, 0.0, 0.0, 0.0});
+            zeta.insert(zeta.end(),{ 0.0, 0.0, 0.0, 0.0,-1.0, 1.0, 0.0});
+        }
+    }
+}
+
+/**
+ * map the reference nodes to a distorted element, the map is a smooth but non-affine one
+ */
+void CreateDistortedNodes(const int &dim,const vector<double> &xi,const vector<double> &eta,const vector<double> &zeta,Nodes &nodes){
+    nodes.InitNodes(static_cast<int>(xi.size()));
+    for(int i=1;i<=static_cast<int>(xi.size());i++){
+        const double x=xi[i-1],y=eta[i-1],z=zeta[i-1];
+        nodes(i,0)=1.0;
+        nodes(i,1)=1.3*x+0.2*y+0.15*x*y+0.05*y*y;
+        nodes(i,2)=0.9*y-0.1*x+0.10*x*x+0.08*x*y;
+        nodes(i,3)=0.0;
+        if(dim==3){
+            nodes(i,1)+=0.1*z+0.05*x*z;
+            nodes(i,2)+=0.07*y*z;
+            nodes(i,3)=1.1*z+0.1*x+0.06*x*y*z+0.04*y*y;
+        }
+    }
+}
+
+/**
+ * compare the kernel with the shape functions, return true if all the differences are smaller than the tolerance
+ */
+bool CompareKernelWithShapeFun(const int &dim,const MeshType &meshtype,const int &qporder,const string &name){
+    const double tol=1.0e-11;
+    QPoint qpoint;
+    qpoint.SetQPointType(QPointType::GAUSSLEGENDRE);
+    qpoint.SetQPointOrder(qporder);
+    qpoint.SetDim(dim);
+    qpoint.CreateQpoints(meshtype);
+
+    ShapeFun shp(dim,meshtype);
+    shp.PreCalc();
+
+    TensorProductKernel kernel;
+    if(!kernel.Init(dim,meshtype,qpoint)){
+        cout<<name<<": the kernel is inactive !"<<endl;
+        return false;
+    }
+
+    vector<double> xi,eta,zeta;
+    GetReferenceNodes(meshtype,xi,eta,zeta);
+    Nodes elNodes;
+    CreateDistortedNodes(dim,xi,eta,zeta,elNodes);
+    const int nNodes=elNodes.GetNodesNum();
+    const int nQp=qpoint.GetQpPointsNum();
+    if(!kernel.CalcGeometry(elNodes)){
+        cout<<name<<": the jacobian of the distorted element is not positive !"<<endl;
+        return false;
+    }
+
+    // a smooth nodal field stored with stride 2, the other slot must not be touched by the kernel
+    const int stride=2;
+    vector<double> nodal(nNodes*stride,-1.0e10);
+    for(int a=1;a<=nNodes;a++){
+        const double x=elNodes(a,1),y=elNodes(a,2),z=elNodes(a,3);
+        nodal[(a-1)*stride]=sin(x)+0.3*y*y-0.7*x*z+cos(z);
+    }
+    vector<double> val(nQp,0.0);
+    vector<Vector3d> grad(nQp,0.0);
+    kernel.Interpolate(nodal.data(),stride,val.data(),grad.data());
+
+    // the weighted gauss point values and fluxes for the transpose one
+    vector<double> gpval(nQp);
+    vector<double> resKernel(nNodes*stride,0.0),resShp(nNodes,0.0);
+    vector<Vector3d> gpfluxvec(nQp,0.0);
+
+    double valerr=0.0,graderr=0.0,detjacerr=0.0,coorderr=0.0,reserr=0.0;
+    double u,x;
+    Vector3d gradu;
+    for(int qp=1;qp<=nQp;qp++){
+        if(dim==2){
+            shp.Calc(qpoint(qp,1),qpoint(qp,2),elNodes,true);
+        }
+        else{
+            shp.Calc(qpoint(qp,1),qpoint(qp,2),qpoint(qp,3),elNodes,true);
+        }
+        u=0.0;gradu=0.0;
+        for(int a=1;a<=nNodes;a++){
+            u+=shp.shape_value(a)*nodal[(a-1)*stride];
+            gradu+=shp.shape_grad(a)*nodal[(a-1)*stride];
+        }
+        valerr=max(valerr,abs(u-val[qp-1]));
+        for(int k=1;k<=3;k++) graderr=max(graderr,abs(gradu(k)-grad[qp-1](k)));
+        detjacerr=max(detjacerr,abs(shp.GetDetJac()-kernel.GetIthQpDetJac(qp)));
+        for(int k=1;k<=dim;k++){
+            x=0.0;
+            for(int a=1;a<=nNodes;a++) x+=shp.shape_value(a)*elNodes(a,k);
+            coorderr=max(coorderr,abs(x-kernel.GetIthQpJthCoord(qp,k)));
+        }
+
+        // the transpose one, R_a=sum_q(N_a*v_q+grad(N_a).f_q)*JxW
+        gpval[qp-1]=(u*u+1.0)*shp.GetDetJac()*qpoint(qp,0);
+        gpfluxvec[qp-1]=gradu*(1.0+u)*shp.GetDetJac()*qpoint(qp,0);
+        for(int a=1;a<=nNodes;a++){
+            resShp[a-1]+=shp.shape_value(a)*gpval[qp-1]+(shp.shape_grad(a)*gpfluxvec[qp-1]);
+        }
+    }
+    kernel.Integrate(gpval.data(),gpfluxvec.data(),stride,resKernel.data());
+    for(int a=1;a<=nNodes;a++){
+        reserr=max(reserr,abs(resKernel[(a-1)*stride]-resShp[a-1]));
+        if(resKernel[(a-1)*stride+1]!=0.0) reserr=max(reserr,1.0);
+    }
+
+    bool passed=(valerr<tol&&graderr<tol&&detjacerr<tol&&coorderr<tol&&reserr<tol);
+    cout<<scientific<<setprecision(3);
+    cout<<name<<"(nQp="<<setw(2)<<nQp<<"): value err="<<valerr<<", grad err="<<graderr
+        <<", detjac err="<<detjacerr<<", coord err="<<coorderr<<", integrate err="<<reserr
+        <<(passed?" ... passed":" ... failed")<<endl;
+    return passed;
+}
+
+int main(int args,char *argv[]){
+    PetscErrorCode ierr;
+    ierr=PetscInitialize(&args,&argv,NULL,NULL);if (ierr) return ierr;
+
+    bool passed=true;
+    passed=CompareKernelWithShapeFun(2,MeshType::QUAD4,2,"quad4")&&passed;
+    passed=CompareKernelWithShapeFun(2,MeshType::QUAD9,3,"quad9")&&passed;
+    passed=CompareKernelWithShapeFun(2,MeshType::QUAD9,4,"quad9")&&passed;
+    passed=CompareKernelWithShapeFun(3,MeshType::HEX8,2,"hex8 ")&&passed;
+    passed=CompareKernelWithShapeFun(3,MeshType::HEX27,4,"hex27")&&passed;
+
+    if(passed){
+        cout<<"all the sum-factorization tests are passed !"<<endl;
+    }
+    else{
+        cout<<"the sum-factorization kernel doesn't match the shape functions !"<<endl;
+    }
+
+    ierr=PetscFinalize();CHKERRQ(ierr);
+    return passed?0:1;
+}